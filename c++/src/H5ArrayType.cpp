@@ -82,6 +82,75 @@ ArrayType::ArrayType( const ArrayType& original ) : DataType( original )
 	dimensions[i] = original.dimensions[i];
 }
 
+#ifdef H5_CXX_HAVE_MOVE
+//--------------------------------------------------------------------------
+// Function:	ArrayType move constructor
+///\brief	Move constructor: takes over the id and the array dimensions
+///		of the original ArrayType object.
+///\param	original - IN: ArrayType object to move from
+//--------------------------------------------------------------------------
+ArrayType::ArrayType(ArrayType&& original) noexcept : DataType(std::move(original))
+{
+    rank = original.rank;
+    dimensions = original.dimensions;
+    original.rank = -1;
+    original.dimensions = NULL;
+}
+
+//--------------------------------------------------------------------------
+// Function:	ArrayType::operator= (move)
+///\brief	Move assignment operator: closes this array datatype and
+///		takes over the id and the array dimensions of \a rhs.
+///\param	rhs - IN: ArrayType object to move from
+///\return	Reference to ArrayType instance
+///\exception	H5::DataTypeIException
+//--------------------------------------------------------------------------
+ArrayType& ArrayType::operator=(ArrayType&& rhs)
+{
+    if (this != &rhs)
+    {
+	DataType::operator=(std::move(rhs));
+
+	if (dimensions != NULL)
+	    delete []dimensions;
+	rank = rhs.rank;
+	dimensions = rhs.dimensions;
+	rhs.rank = -1;
+	rhs.dimensions = NULL;
+    }
+    return(*this);
+}
+#endif // H5_CXX_HAVE_MOVE
+
+//--------------------------------------------------------------------------
+// Function:	ArrayType::operator=
+///\brief	Assignment operator: makes a copy of the ArrayType object on
+///		the right hand side, including its array dimensions.
+///\param	rhs - IN: ArrayType object to copy
+///\return	Reference to ArrayType instance
+///\exception	H5::DataTypeIException
+//--------------------------------------------------------------------------
+ArrayType& ArrayType::operator=(const ArrayType& rhs)
+{
+    if (this != &rhs)
+    {
+	DataType::operator=(rhs);
+
+	// Replace the dimensions with a copy of the rhs' dimensions
+	if (dimensions != NULL)
+	    delete []dimensions;
+	rank = rhs.rank;
+	dimensions = NULL;
+	if (rhs.dimensions != NULL)
+	{
+	    dimensions = new hsize_t[rank];
+	    for (int i = 0; i < rank; i++)
+		dimensions[i] = rhs.dimensions[i];
+	}
+    }
+    return(*this);
+}
+
 //--------------------------------------------------------------------------
 // Function:	ArrayType overloaded constructor
 ///\brief	Creates a new array data type based on the specified
@@ -17,6 +17,10 @@
 #ifndef __H5ArrayType_H
 #define __H5ArrayType_H
 
+#ifdef H5_CXX_HAVE_MOVE
+#include <array>
+#endif
+
 #ifndef H5_NO_NAMESPACE
 namespace H5 {
 #endif
@@ -43,6 +47,20 @@ class H5_DLLCPP ArrayType : public DataType {
 	// Copy constructor: makes copy of the original object.
 	ArrayType( const ArrayType& original );
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor: takes over the id of the original ArrayType object
+	// without changing its reference count.
+	ArrayType(ArrayType&& original) noexcept;
+
+	// Move assignment operator: closes this object and takes over the
+	// id of rhs.
+	ArrayType& operator=(ArrayType&& rhs);
+#endif
+
+	// Assignment operator: makes a copy of the rhs object, including
+	// its array dimensions.
+	ArrayType& operator=(const ArrayType& rhs);
+
 	// Constructor that takes an existing id
 	ArrayType( const hid_t existing_id );
 
@@ -56,6 +74,17 @@ class H5_DLLCPP ArrayType : public DataType {
 	int rank;		// Rank of the array
 	hsize_t* dimensions;	// Sizes of the array dimensions
 };
+
+#ifdef H5_CXX_HAVE_MOVE
+// A std::array element is stored as an HDF5 array of its element type.
+template <typename T, std::size_t N> struct NativeType< std::array<T, N> > {
+    static ArrayType type()
+    {
+	hsize_t dims[1] = {N};
+	return ArrayType(NativeType<T>::type(), 1, dims);
+    }
+};
+#endif
 #ifndef H5_NO_NAMESPACE
 }
 #endif
@@ -66,6 +66,14 @@ class H5_DLLCPP AtomType : public DataType {
 	// Copy constructor - makes copy of the original object
 	AtomType( const AtomType& original );
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor and assignment operators; the id is held and
+	// transferred by the base class.
+	AtomType(AtomType&& original) = default;
+	AtomType& operator=(AtomType&& rhs) = default;
+	AtomType& operator=(const AtomType& rhs) = default;
+#endif
+
 	// Noop destructor
 	virtual ~AtomType();
 #endif // DOXYGEN_SHOULD_SKIP_THIS
@@ -64,6 +64,42 @@ Attribute::Attribute(const Attribute& original) : AbstractDs(), IdComponent()
     incRefCount(); // increment number of references to this id
 }
 
+#ifdef H5_CXX_HAVE_MOVE
+//--------------------------------------------------------------------------
+// Function:	Attribute move constructor
+///\brief	Move constructor: takes over the id of the original Attribute
+///		object without changing its reference count.
+///\param	original - IN: Attribute object to move from
+// Description
+//		The original object is left without an id, so that its
+//		destructor does not close the transferred attribute.
+//--------------------------------------------------------------------------
+Attribute::Attribute(Attribute&& original) noexcept : AbstractDs(), IdComponent()
+{
+    id = original.id;
+    original.id = H5I_INVALID_HID;
+}
+
+//--------------------------------------------------------------------------
+// Function:	Attribute::operator= (move)
+///\brief	Move assignment operator: closes this attribute and takes over
+///		the id of \a rhs without changing its reference count.
+///\param	rhs - IN: Attribute object to move from
+///\return	Reference to Attribute instance
+///\exception	H5::AttributeIException
+//--------------------------------------------------------------------------
+Attribute& Attribute::operator=(Attribute&& rhs)
+{
+    if (this != &rhs)
+    {
+	close();
+	id = rhs.id;
+	rhs.id = H5I_INVALID_HID;
+    }
+    return(*this);
+}
+#endif // H5_CXX_HAVE_MOVE
+
 //--------------------------------------------------------------------------
 // Function:	Attribute overloaded constructor
 ///\brief	Creates an Attribute object using the id of an existing
@@ -35,6 +35,19 @@ class H5_DLLCPP Attribute : public AbstractDs, public IdComponent {
 	// Copy constructor: makes a copy of an existing Attribute object.
 	Attribute( const Attribute& original );
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor: takes over the id of the original Attribute object
+	// without changing its reference count.
+	Attribute(Attribute&& original) noexcept;
+
+	// Move assignment operator: closes this object and takes over the
+	// id of rhs.
+	Attribute& operator=(Attribute&& rhs);
+
+	// Assignment operator, otherwise suppressed by the move operations.
+	Attribute& operator=(const Attribute& rhs) = default;
+#endif
+
 	// Default constructor
 	Attribute();
 
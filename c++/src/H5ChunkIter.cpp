@@ -0,0 +1,356 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <string>
+#include <vector>
+
+#include "H5Include.h"
+#include "H5Exception.h"
+#include "H5IdComponent.h"
+#include "H5PropList.h"
+#include "H5Object.h"
+#include "H5DxferProp.h"
+#include "H5DcreatProp.h"
+#include "H5CommonFG.h"
+#include "H5DataType.h"
+#include "H5DataSpace.h"
+#include "H5AbstractDs.h"
+#include "H5DataSet.h"
+#include "H5ChunkIter.h"
+
+#ifndef H5_NO_NAMESPACE
+namespace H5 {
+#endif
+
+// Approximate size of the blocks of rows that datasets which are not
+// chunked are read in
+#define CHUNK_ITER_BLOCK_SIZE	(1024 * 1024)
+
+//--------------------------------------------------------------------------
+// Function:	read_chunk (local)
+// Purpose:	Reads the block of a dataset at offset with the given count
+//		into buf.
+//--------------------------------------------------------------------------
+static herr_t read_chunk(hid_t dset_id, hid_t mem_type_id, hid_t file_space_id, int rank, const hsize_t* offset, const hsize_t* count, void* buf)
+{
+    if (rank == 0)
+	return(H5Dread(dset_id, mem_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf));
+
+    if (H5Sselect_hyperslab(file_space_id, H5S_SELECT_SET, offset, NULL, count, NULL) < 0)
+	return(-1);
+    hid_t mem_space_id = H5Screate_simple(rank, count, NULL);
+    if (mem_space_id < 0)
+	return(-1);
+    herr_t ret_value = H5Dread(dset_id, mem_type_id, mem_space_id, file_space_id, H5P_DEFAULT, buf);
+    if (H5Sclose(mem_space_id) < 0)
+	ret_value = -1;
+    return(ret_value);
+}
+
+// Returns the coordinates in pos, or NULL for a scalar dataset
+static const hsize_t* coords(const std::vector<hsize_t>& pos)
+{
+    return(pos.empty() ? NULL : &pos[0]);
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator overloaded constructor
+///\brief	Opens a dataset and creates an iterator over its chunks.
+///\param	loc      - IN: Location of the dataset
+///\param	name     - IN: Name of the dataset
+///\param	mem_type - IN: Memory datatype of the chunk buffer
+///\exception	H5::DataSetIException
+///\par Description
+///		The dataset is opened with a chunk cache that holds at most
+///		one chunk: filtered chunks, which always pass through the
+///		cache, replace each other there, and other chunks are read
+///		directly into the iterator's buffer.  If the dataset is
+///		already open, the library keeps its existing chunk cache.
+//--------------------------------------------------------------------------
+ChunkIterator::ChunkIterator(const H5Location& loc, const H5std_string& name, const DataType& mem_type) : dataset(p_open(loc, name)), mem_type(mem_type)
+{
+    p_init();
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator overloaded constructor
+///\brief	Creates an iterator over the chunks of an open dataset.
+///\param	dataset  - IN: Dataset to iterate
+///\param	mem_type - IN: Memory datatype of the chunk buffer
+///\exception	H5::DataSetIException
+//--------------------------------------------------------------------------
+ChunkIterator::ChunkIterator(const DataSet& dataset, const DataType& mem_type) : dataset(dataset), mem_type(mem_type)
+{
+    p_init();
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator::p_open (private)
+// Purpose:	Opens a dataset with a chunk cache sized for reading it
+//		once, chunk by chunk.
+// Description
+//		The dataset is opened once to find the size of its chunks,
+//		then reopened with a one-slot cache.  Filtered chunks always
+//		go through the cache, so it holds one of them; unfiltered
+//		chunks bypass a cache that is too small to hold them, which
+//		saves copying them out of it.
+//--------------------------------------------------------------------------
+DataSet ChunkIterator::p_open(const H5Location& loc, const H5std_string& name)
+{
+    hid_t dset_id = H5Dopen2(loc.getId(), name.c_str(), H5P_DEFAULT);
+    if (dset_id < 0)
+	throw DataSetIException("ChunkIterator constructor", "H5Dopen2 failed");
+
+    DataSet dset;
+    f_DataSet_setId(&dset, dset_id);
+
+    DSetCreatPropList dcpl = dset.getCreatePlist();
+    if (dcpl.getLayout() != H5D_CHUNKED)
+	return(dset);
+
+    int ndims = dset.getSpace().getSimpleExtentNdims();
+    std::vector<hsize_t> chunk_dims(ndims);
+    dcpl.getChunk(ndims, &chunk_dims[0]);
+    size_t cache_size = 0;
+    if (dcpl.getNfilters() > 0)
+    {
+	cache_size = dset.getDataType().getSize();
+	for (int i = 0; i < ndims; i++)
+	    cache_size *= (size_t)chunk_dims[i];
+    }
+    dset.close();
+
+    hid_t dapl_id = H5Pcreate(H5P_DATASET_ACCESS);
+    if (dapl_id < 0)
+	throw DataSetIException("ChunkIterator constructor", "H5Pcreate failed");
+    if (H5Pset_chunk_cache(dapl_id, (size_t)1, cache_size, 1.0) < 0)
+    {
+	H5Pclose(dapl_id);
+	throw DataSetIException("ChunkIterator constructor", "H5Pset_chunk_cache failed");
+    }
+    dset_id = H5Dopen2(loc.getId(), name.c_str(), dapl_id);
+    H5Pclose(dapl_id);
+    if (dset_id < 0)
+	throw DataSetIException("ChunkIterator constructor", "H5Dopen2 failed");
+    f_DataSet_setId(&dset, dset_id);
+    return(dset);
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator::p_init (private)
+// Purpose:	Gets the shape of the dataset and of its chunks, allocates
+//		the chunk buffer and positions the iterator at the start.
+//--------------------------------------------------------------------------
+void ChunkIterator::p_init()
+{
+    file_space = dataset.getSpace();
+    rank = file_space.getSimpleExtentNdims();
+    type_size = mem_type.getSize();
+    dims.resize(rank);
+    block.resize(rank);
+    if (rank > 0)
+    {
+	file_space.getSimpleExtentDims(&dims[0]);
+
+	DSetCreatPropList dcpl = dataset.getCreatePlist();
+	if (dcpl.getLayout() == H5D_CHUNKED)
+	    dcpl.getChunk(rank, &block[0]);
+	else
+	{
+	    // Use blocks of whole rows of about CHUNK_ITER_BLOCK_SIZE bytes
+	    size_t row_size = type_size;
+	    for (int i = 1; i < rank; i++)
+	    {
+		block[i] = dims[i];
+		row_size *= (size_t)dims[i];
+	    }
+	    block[0] = row_size > 0 ? CHUNK_ITER_BLOCK_SIZE / row_size : 1;
+	    if (block[0] == 0)
+		block[0] = 1;
+	}
+    }
+
+    // Size the buffer for the largest chunk
+    size_t buf_size = type_size;
+    for (int i = 0; i < rank; i++)
+	buf_size *= (size_t)(block[i] < dims[i] ? block[i] : dims[i]);
+    buf.resize(buf_size);
+
+    offset.resize(rank);
+    count.resize(rank);
+    next_offset.resize(rank);
+    next_count.resize(rank);
+    reset();
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator::reset
+///\brief	Restarts the iteration at the first chunk.
+///\exception	H5::DataSetIException
+//--------------------------------------------------------------------------
+void ChunkIterator::reset()
+{
+    has_current = false;
+    has_next = true;
+    for (int i = 0; i < rank; i++)
+    {
+	next_offset[i] = 0;
+	if (dims[i] == 0)
+	    has_next = false;
+    }
+    p_set_count(next_offset, next_count);
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator::next
+///\brief	Reads the next chunk of the dataset.
+///\return	\c true if a chunk was read, and \c false if all chunks
+///		have already been read
+///\exception	H5::DataSetIException
+///\par Description
+///		The previous chunk's data is no longer valid once this
+///		returns.
+//--------------------------------------------------------------------------
+bool ChunkIterator::next()
+{
+    if (!has_next)
+    {
+	has_current = false;
+	return(false);
+    }
+
+    herr_t status = read_chunk(dataset.getId(), mem_type.getId(), file_space.getId(), rank, coords(next_offset), coords(next_count), &buf[0]);
+    if (status < 0)
+    {
+	has_current = false;
+	throw DataSetIException("ChunkIterator::next", "reading chunk failed");
+    }
+
+    offset = next_offset;
+    count = next_count;
+    has_current = true;
+
+    has_next = p_advance(next_offset);
+    if (has_next)
+	p_set_count(next_offset, next_count);
+    return(true);
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator::getBuffer
+///\brief	Returns the data of the current chunk.
+///\return	Pointer to the data, or NULL before the first or after the
+///		last call to next()
+//--------------------------------------------------------------------------
+const void* ChunkIterator::getBuffer() const
+{
+    return(has_current ? &buf[0] : NULL);
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator::getNumElements
+///\brief	Returns the number of elements in the current chunk.
+///\return	Number of elements, or 0 when there is no current chunk
+//--------------------------------------------------------------------------
+size_t ChunkIterator::getNumElements() const
+{
+    if (!has_current)
+	return(0);
+
+    size_t nelmts = 1;
+    for (int i = 0; i < rank; i++)
+	nelmts *= (size_t)count[i];
+    return(nelmts);
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator::getRank
+///\brief	Returns the rank of the dataset.
+///\return	Rank of the dataset
+//--------------------------------------------------------------------------
+int ChunkIterator::getRank() const
+{
+    return(rank);
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator::getOffset
+///\brief	Returns the position of the current chunk in the dataset.
+///\return	Array of getRank() coordinates
+//--------------------------------------------------------------------------
+const hsize_t* ChunkIterator::getOffset() const
+{
+    return(coords(offset));
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator::getCount
+///\brief	Returns the size of the current chunk in each dimension,
+///		after clipping it to the dataset's extent.
+///\return	Array of getRank() sizes
+//--------------------------------------------------------------------------
+const hsize_t* ChunkIterator::getCount() const
+{
+    return(coords(count));
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator::getDataSet
+///\brief	Returns the dataset being iterated.
+///\return	DataSet instance
+//--------------------------------------------------------------------------
+const DataSet& ChunkIterator::getDataSet() const
+{
+    return(dataset);
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator::p_set_count (private)
+// Purpose:	Computes the size of the chunk at pos, clipped to the
+//		dataset's extent.
+//--------------------------------------------------------------------------
+void ChunkIterator::p_set_count(const std::vector<hsize_t>& pos, std::vector<hsize_t>& cnt) const
+{
+    for (int i = 0; i < rank; i++)
+	cnt[i] = pos[i] + block[i] <= dims[i] ? block[i] : dims[i] - pos[i];
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator::p_advance (private)
+// Purpose:	Moves pos to the next chunk in row-major order of the chunk
+//		grid, which is the order of the chunk index.
+// Return	false if pos was at the last chunk
+//--------------------------------------------------------------------------
+bool ChunkIterator::p_advance(std::vector<hsize_t>& pos) const
+{
+    for (int i = rank - 1; i >= 0; i--)
+    {
+	pos[i] += block[i];
+	if (pos[i] < dims[i])
+	    return(true);
+	pos[i] = 0;
+    }
+    return(false);
+}
+
+//--------------------------------------------------------------------------
+// Function:	ChunkIterator destructor
+///\brief	Noop destructor.
+//--------------------------------------------------------------------------
+ChunkIterator::~ChunkIterator() {}
+
+#ifndef H5_NO_NAMESPACE
+} // end namespace
+#endif
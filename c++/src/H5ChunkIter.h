@@ -0,0 +1,112 @@
+// C++ informative line for the emacs editor: -*- C++ -*-
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef __H5ChunkIter_H
+#define __H5ChunkIter_H
+
+#include <vector>
+
+#ifndef H5_NO_NAMESPACE
+namespace H5 {
+#endif
+
+/*! \class ChunkIterator
+    \brief ChunkIterator streams a dataset through memory one chunk at a
+    time.
+
+    Each call to next() reads the next chunk of the dataset, in the order
+    of the chunk index, into a buffer that is reused for the whole
+    iteration.  Chunks at the edges of the dataset are clipped to its
+    extent, and the data of each chunk is packed in row-major order of
+    its count.  Datasets that are not chunked are walked in blocks of
+    whole rows.
+*/
+class H5_DLLCPP ChunkIterator {
+   public:
+	// Opens a dataset with a chunk cache of at most one chunk and
+	// creates an iterator over it.
+	ChunkIterator(const H5Location& loc, const H5std_string& name, const DataType& mem_type);
+
+	// Creates an iterator over an already open dataset.
+	ChunkIterator(const DataSet& dataset, const DataType& mem_type);
+
+	// Reads the next chunk; returns false when all chunks have been read.
+	bool next();
+
+	// Restarts the iteration at the first chunk.
+	void reset();
+
+	// Returns the data of the current chunk.
+	const void* getBuffer() const;
+
+	///\brief Returns the data of the current chunk as elements of type T.
+	template <typename T>
+	const T* getData() const { return(static_cast<const T*>(getBuffer())); }
+
+	// Returns the number of elements in the current chunk.
+	size_t getNumElements() const;
+
+	// Returns the rank of the dataset.
+	int getRank() const;
+
+	// Returns the position of the current chunk in the dataset.
+	const hsize_t* getOffset() const;
+
+	// Returns the size of the current chunk in each dimension.
+	const hsize_t* getCount() const;
+
+	// Returns the dataset being iterated.
+	const DataSet& getDataSet() const;
+
+	// Noop destructor.
+	virtual ~ChunkIterator();
+
+   private:
+	DataSet dataset;	// Dataset being iterated
+	DataType mem_type;	// Memory datatype of the chunks
+	DataSpace file_space;	// Dataspace used to select each chunk
+	int rank;		// Rank of the dataset
+	size_t type_size;	// Size of an element in memory
+	std::vector<hsize_t> dims;	// Dimensions of the dataset
+	std::vector<hsize_t> block;	// Dimensions of a chunk
+	std::vector<hsize_t> offset;	// Position of the current chunk
+	std::vector<hsize_t> count;	// Size of the current chunk
+	std::vector<hsize_t> next_offset;	// Position of the next chunk
+	std::vector<hsize_t> next_count;	// Size of the next chunk
+	bool has_current;	// Whether next() has read a chunk
+	bool has_next;		// Whether there is a chunk left to read
+	std::vector<char> buf;	// Buffer holding the current chunk
+
+	// Opens a dataset with a chunk cache sized for streaming.
+	static DataSet p_open(const H5Location& loc, const H5std_string& name);
+
+	// Sets up the chunk shape and buffer.
+	void p_init();
+
+	// Computes the size of the chunk at pos, clipped to the dataset.
+	void p_set_count(const std::vector<hsize_t>& pos, std::vector<hsize_t>& cnt) const;
+
+	// Moves pos to the next chunk; returns false after the last one.
+	bool p_advance(std::vector<hsize_t>& pos) const;
+
+	// Iterators are not copyable.
+	ChunkIterator(const ChunkIterator&);
+	ChunkIterator& operator=(const ChunkIterator&);
+};
+#ifndef H5_NO_NAMESPACE
+}
+#endif
+#endif // __H5ChunkIter_H
@@ -42,10 +42,12 @@ namespace H5 {
 	//class RefType;
 	class AbstractDs;
 	class DataSet;
+	class ChunkIterator;
 	class Group;
 	class H5File;
 	class Attribute;
 	class H5Library;
+	template <typename T> struct NativeType;
 #ifndef H5_NO_NAMESPACE
 }
 #endif
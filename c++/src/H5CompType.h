@@ -42,6 +42,14 @@ class H5_DLLCPP CompType : public DataType {
 	// Copy constructor - makes a copy of original object
 	CompType( const CompType& original );
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor and assignment operators; the id is held and
+	// transferred by the base class.
+	CompType(CompType&& original) = default;
+	CompType& operator=(CompType&& rhs) = default;
+	CompType& operator=(const CompType& rhs) = default;
+#endif
+
 	// Returns the type class of the specified member of this compound
 	// datatype.  It provides to the user a way of knowing what type
 	// to create another datatype of the same class
@@ -19,6 +19,8 @@
 #include <iostream>
 #endif
 #include <string>
+#include <vector>
+#include <new>
 
 #include "H5Include.h"
 #include "H5Exception.h"
@@ -47,6 +49,62 @@ namespace H5 {
 #endif  // H5_NO_STD
 #endif
 
+// Size of the blocks that back variable-length strings read into a vector
+#define VLEN_STR_BLOCK_SIZE	(64 * 1024)
+
+//--------------------------------------------------------------------------
+// Arena used by DataSet::read for vectors of variable-length strings.  The
+// library allocates each string through vlen_str_alloc, which carves it out
+// of a few large blocks instead of calling malloc once per string; the
+// strings are copied out after the read and the blocks released together.
+//--------------------------------------------------------------------------
+struct VlenStrArena {
+    std::vector<char*> blocks;	// Blocks allocated so far
+    size_t used;		// Bytes used in the last block
+    size_t avail;		// Size of the last block
+
+    VlenStrArena() : used(0), avail(0) {}
+    ~VlenStrArena()
+    {
+	for (size_t i = 0; i < blocks.size(); i++)
+	    delete []blocks[i];
+    }
+};
+
+static void* vlen_str_alloc(size_t size, void* info)
+{
+    VlenStrArena* arena = static_cast<VlenStrArena*>(info);
+
+    // Keep each string aligned, as malloc would
+    size = (size + 7) & ~(size_t)7;
+    if (arena->used + size > arena->avail)
+    {
+	size_t block_size = size > VLEN_STR_BLOCK_SIZE ? size : VLEN_STR_BLOCK_SIZE;
+
+	// Report failures to the library rather than throwing through it
+	char* block = new(std::nothrow) char[block_size];
+	if (block == NULL)
+	    return(NULL);
+	try {
+	    arena->blocks.push_back(block);
+	}
+	catch (...) {
+	    delete []block;
+	    return(NULL);
+	}
+	arena->used = 0;
+	arena->avail = block_size;
+    }
+    void* ret_value = arena->blocks.back() + arena->used;
+    arena->used += size;
+    return(ret_value);
+}
+
+static void vlen_str_free(void* /* mem */, void* /* info */)
+{
+    // The arena releases all strings at once
+}
+
 //--------------------------------------------------------------------------
 // Function:	DataSet default constructor
 ///\brief	Default constructor: creates a stub DataSet.
@@ -78,6 +136,42 @@ DataSet::DataSet(const DataSet& original) : H5Object(), AbstractDs()
     incRefCount(); // increment number of references to this id
 }
 
+#ifdef H5_CXX_HAVE_MOVE
+//--------------------------------------------------------------------------
+// Function:	DataSet move constructor
+///\brief	Move constructor: takes over the id of the original DataSet
+///		object without changing its reference count.
+///\param	original - IN: DataSet object to move from
+// Description
+//		The original object is left without an id, so that its
+//		destructor does not close the transferred dataset.
+//--------------------------------------------------------------------------
+DataSet::DataSet(DataSet&& original) noexcept : H5Object(), AbstractDs()
+{
+    id = original.id;
+    original.id = H5I_INVALID_HID;
+}
+
+//--------------------------------------------------------------------------
+// Function:	DataSet::operator= (move)
+///\brief	Move assignment operator: closes this dataset and takes over
+///		the id of \a rhs without changing its reference count.
+///\param	rhs - IN: DataSet object to move from
+///\return	Reference to DataSet instance
+///\exception	H5::DataSetIException
+//--------------------------------------------------------------------------
+DataSet& DataSet::operator=(DataSet&& rhs)
+{
+    if (this != &rhs)
+    {
+	close();
+	id = rhs.id;
+	rhs.id = H5I_INVALID_HID;
+    }
+    return(*this);
+}
+#endif // H5_CXX_HAVE_MOVE
+
 //--------------------------------------------------------------------------
 // Function:	DataSet overload constructor - dereference
 ///\brief	Given a reference, ref, to an hdf5 location, creates a
@@ -456,6 +550,90 @@ void DataSet::read(H5std_string& strg, const DataType& mem_type, const DataSpace
     }
 }
 
+//--------------------------------------------------------------------------
+// Function:	DataSet::read
+///\brief	This is an overloaded member function, provided for convenience.
+///		It reads a vector of \c H5std_string, one string per element.
+///\param	strgs - OUT: Strings read, resized to the number of elements
+///			     in the memory dataspace
+///\exception	H5::DataSetIException
+// Description
+//		Fixed-length strings are read into a single buffer and split.
+//		Variable-length strings are allocated by the library from an
+//		arena, so that there is no malloc and free for each string.
+//--------------------------------------------------------------------------
+void DataSet::read(std::vector<H5std_string>& strgs, const DataType& mem_type, const DataSpace& mem_space, const DataSpace& file_space, const DSetMemXferPropList& xfer_plist) const
+{
+    htri_t is_variable_len = H5Tis_variable_str(mem_type.getId());
+    if (is_variable_len < 0)
+    {
+        throw DataSetIException("DataSet::read", "H5Tis_variable_str failed");
+    }
+
+    size_t npoints = p_get_mem_npoints(mem_space, file_space);
+    strgs.resize(npoints);
+    if (npoints == 0)
+	return;
+
+    // Obtain identifiers for C API
+    hid_t mem_type_id = mem_type.getId();
+    hid_t mem_space_id = mem_space.getId();
+    hid_t file_space_id = file_space.getId();
+    hid_t xfer_plist_id = xfer_plist.getId();
+
+    if (!is_variable_len)
+    {
+	// Read all the strings at once, then split them at their null
+	// terminators or at the string size
+	size_t str_size = mem_type.getSize();
+	std::vector<char> buf(npoints * str_size);
+	herr_t ret_value = H5Dread(id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id, &buf[0]);
+	if (ret_value < 0)
+	{
+	    throw DataSetIException("DataSet::read", "H5Dread failed for fixed length strings");
+	}
+	for (size_t i = 0; i < npoints; i++)
+	{
+	    const char* str = &buf[i * str_size];
+	    const char* end = static_cast<const char*>(HDmemchr(str, '\0', str_size));
+	    strgs[i].assign(str, end != NULL ? (size_t)(end - str) : str_size);
+	}
+    }
+    else
+    {
+	// Use a copy of the transfer property list that allocates the
+	// strings from the arena
+	hid_t plist_id;
+	if (xfer_plist_id == H5P_DEFAULT)
+	    plist_id = H5Pcreate(H5P_DATASET_XFER);
+	else
+	    plist_id = H5Pcopy(xfer_plist_id);
+	if (plist_id < 0)
+	{
+	    throw DataSetIException("DataSet::read", "creating transfer property list failed");
+	}
+
+	VlenStrArena arena;
+	std::vector<char*> strgs_C(npoints);
+	herr_t ret_value = H5Pset_vlen_mem_manager(plist_id, vlen_str_alloc, &arena, vlen_str_free, &arena);
+	if (ret_value >= 0)
+	    ret_value = H5Dread(id, mem_type_id, mem_space_id, file_space_id, plist_id, &strgs_C[0]);
+	H5Pclose(plist_id);
+	if (ret_value < 0)
+	{
+	    throw DataSetIException("DataSet::read", "H5Dread failed for variable length strings");
+	}
+
+	for (size_t i = 0; i < npoints; i++)
+	{
+	    if (strgs_C[i] != NULL)
+		strgs[i].assign(strgs_C[i]);
+	    else
+		strgs[i].clear();
+	}
+    }
+}
+
 //--------------------------------------------------------------------------
 // Function:	DataSet::write
 ///\brief	Writes raw data from an application buffer to a dataset.
@@ -534,6 +712,65 @@ void DataSet::write( const H5std_string& strg, const DataType& mem_type, const D
     }
 }
 
+//--------------------------------------------------------------------------
+// Function:	DataSet::write
+///\brief	This is an overloaded member function, provided for convenience.
+///		It writes a vector of \c H5std_string, one string per element.
+///\param	strgs - IN: Strings to write; there must be at least as many
+///			    as elements in the memory dataspace
+///\exception	H5::DataSetIException
+// Description
+//		Fixed-length strings are packed into a single buffer,
+//		truncated or null padded to the string size.  Variable-length
+//		strings are passed to the library by pointer, without copying.
+//--------------------------------------------------------------------------
+void DataSet::write(const std::vector<H5std_string>& strgs, const DataType& mem_type, const DataSpace& mem_space, const DataSpace& file_space, const DSetMemXferPropList& xfer_plist) const
+{
+    htri_t is_variable_len = H5Tis_variable_str(mem_type.getId());
+    if (is_variable_len < 0)
+    {
+        throw DataSetIException("DataSet::write", "H5Tis_variable_str failed");
+    }
+
+    size_t npoints = p_get_mem_npoints(mem_space, file_space);
+    if (strgs.size() < npoints)
+    {
+	throw DataSetIException("DataSet::write", "vector is smaller than the memory dataspace");
+    }
+    if (npoints == 0)
+	return;
+
+    // Obtain identifiers for C API
+    hid_t mem_type_id = mem_type.getId();
+    hid_t mem_space_id = mem_space.getId();
+    hid_t file_space_id = file_space.getId();
+    hid_t xfer_plist_id = xfer_plist.getId();
+
+    herr_t ret_value;
+    if (!is_variable_len)
+    {
+	size_t str_size = mem_type.getSize();
+	std::vector<char> buf(npoints * str_size, '\0');
+	for (size_t i = 0; i < npoints; i++)
+	{
+	    size_t len = strgs[i].size() < str_size ? strgs[i].size() : str_size;
+	    HDmemcpy(&buf[i * str_size], strgs[i].data(), len);
+	}
+	ret_value = H5Dwrite(id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id, &buf[0]);
+    }
+    else
+    {
+	std::vector<const char*> strgs_C(npoints);
+	for (size_t i = 0; i < npoints; i++)
+	    strgs_C[i] = strgs[i].c_str();
+	ret_value = H5Dwrite(id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id, &strgs_C[0]);
+    }
+    if (ret_value < 0)
+    {
+        throw DataSetIException("DataSet::write", "H5Dwrite failed");
+    }
+}
+
 //--------------------------------------------------------------------------
 // Function:	DataSet::iterateElems
 ///\brief	Iterates over all selected elements in a dataspace.
@@ -689,31 +926,30 @@ hid_t DataSet::getId() const
 // Modification
 //	Jul 2009
 //		Added in follow to the change in Attribute::read
+//	Oct 2026
+//		Reads directly into strg instead of a temporary buffer
 //--------------------------------------------------------------------------
 void DataSet::p_read_fixed_len(const hid_t mem_type_id, const hid_t mem_space_id, const hid_t file_space_id, const hid_t xfer_plist_id, H5std_string& strg) const
 {
-    // Only allocate for fixed-len string.
-
     // Get the size of the dataset's data
     size_t data_size = getInMemDataSize();
 
-    // If there is data, allocate buffer and read it.
+    // If there is data, size the string to hold it and read into it.
     if (data_size > 0)
     {
-	char *strg_C = new char [data_size+1];
-	HDmemset(strg_C, 0, data_size+1); // clear buffer
+	strg.resize(data_size);
 
-	herr_t ret_value = H5Dread(id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id, strg_C);
+	herr_t ret_value = H5Dread(id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id, &strg[0]);
 
 	if( ret_value < 0 )
 	{
-	    delete []strg_C;	// de-allocate for fixed-len string
 	    throw DataSetIException("DataSet::read", "H5Dread failed for fixed length string");
 	}
 
-	// Get string from the C char* and release resource allocated locally
-	strg = strg_C;
-	delete []strg_C;
+	// Drop anything after the null terminator, as a C string would
+	H5std_string::size_type len = strg.find('\0');
+	if (len != H5std_string::npos)
+	    strg.resize(len);
     }
 }
 
@@ -746,6 +982,30 @@ void DataSet::p_read_variable_len(const hid_t mem_type_id, const hid_t mem_space
     HDfree(strg_C);
 }
 
+//--------------------------------------------------------------------------
+// Function:	DataSet::p_get_mem_npoints (private)
+// brief	Returns the number of elements that the memory buffer of a
+//		read or write must hold.
+// param	mem_space  - IN: Memory dataspace
+// param	file_space - IN: Dataset's dataspace in the file
+// Description
+//		This is the extent of the memory dataspace.  When it is
+//		DataSpace::ALL, the file dataspace, or this dataset's
+//		dataspace, is used for memory as well.
+//--------------------------------------------------------------------------
+size_t DataSet::p_get_mem_npoints(const DataSpace& mem_space, const DataSpace& file_space) const
+{
+    hssize_t npoints;
+
+    if (mem_space.getId() != H5S_ALL)
+	npoints = mem_space.getSimpleExtentNpoints();
+    else if (file_space.getId() != H5S_ALL)
+	npoints = file_space.getSimpleExtentNpoints();
+    else
+	npoints = getSpace().getSimpleExtentNpoints();
+    return(static_cast<size_t>(npoints));
+}
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 //--------------------------------------------------------------------------
 // Function:    DataSet::p_setId (protected)
@@ -17,6 +17,8 @@
 #ifndef __H5DataSet_H
 #define __H5DataSet_H
 
+#include <vector>
+
 #ifndef H5_NO_NAMESPACE
 namespace H5 {
 #endif
@@ -83,6 +85,33 @@ class H5_DLLCPP DataSet : public H5Object, public AbstractDs {
 	void write( const void* buf, const DataType& mem_type, const DataSpace& mem_space = DataSpace::ALL, const DataSpace& file_space = DataSpace::ALL, const DSetMemXferPropList& xfer_plist = DSetMemXferPropList::DEFAULT ) const;
         void write( const H5std_string& buf, const DataType& mem_type, const DataSpace& mem_space = DataSpace::ALL, const DataSpace& file_space = DataSpace::ALL, const DSetMemXferPropList& xfer_plist = DSetMemXferPropList::DEFAULT ) const;
 
+	// Reads and writes vectors of strings, fixed- or variable-length.
+	void read( std::vector<H5std_string>& buf, const DataType& mem_type, const DataSpace& mem_space = DataSpace::ALL, const DataSpace& file_space = DataSpace::ALL, const DSetMemXferPropList& xfer_plist = DSetMemXferPropList::DEFAULT ) const;
+	void write( const std::vector<H5std_string>& buf, const DataType& mem_type, const DataSpace& mem_space = DataSpace::ALL, const DataSpace& file_space = DataSpace::ALL, const DSetMemXferPropList& xfer_plist = DSetMemXferPropList::DEFAULT ) const;
+
+	// Reads the data of this dataset directly into a vector, which is
+	// resized to the number of elements in the memory dataspace.  The
+	// memory datatype is deduced from the element type by NativeType.
+	template <typename T>
+	void read( std::vector<T>& buf, const DataSpace& mem_space = DataSpace::ALL, const DataSpace& file_space = DataSpace::ALL, const DSetMemXferPropList& xfer_plist = DSetMemXferPropList::DEFAULT ) const
+	{
+	    buf.resize(p_get_mem_npoints(mem_space, file_space));
+	    if (!buf.empty())
+		read(static_cast<void*>(&buf[0]), NativeType<T>::type(), mem_space, file_space, xfer_plist);
+	}
+
+	// Writes the data in a vector to this dataset.  The memory datatype
+	// is deduced from the element type by NativeType.
+	template <typename T>
+	void write( const std::vector<T>& buf, const DataSpace& mem_space = DataSpace::ALL, const DataSpace& file_space = DataSpace::ALL, const DSetMemXferPropList& xfer_plist = DSetMemXferPropList::DEFAULT ) const
+	{
+	    size_t npoints = p_get_mem_npoints(mem_space, file_space);
+	    if (buf.size() < npoints)
+		throw DataSetIException("DataSet::write", "vector is smaller than the memory dataspace");
+	    if (npoints > 0)
+		write(static_cast<const void*>(&buf[0]), NativeType<T>::type(), mem_space, file_space, xfer_plist);
+	}
+
 	// Iterates the selected elements in the specified dataspace - not implemented in C++ style yet
         int iterateElems( void* buf, const DataType& type, const DataSpace& space, H5D_operator_t op, void* op_data = NULL );
 
@@ -99,6 +128,19 @@ class H5_DLLCPP DataSet : public H5Object, public AbstractDs {
 	// Copy constructor.
 	DataSet( const DataSet& original );
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor: takes over the id of the original DataSet object
+	// without changing its reference count.
+	DataSet(DataSet&& original) noexcept;
+
+	// Move assignment operator: closes this object and takes over the
+	// id of rhs.
+	DataSet& operator=(DataSet&& rhs);
+
+	// Assignment operator, otherwise suppressed by the move operations.
+	DataSet& operator=(const DataSet& rhs) = default;
+#endif
+
 	// Creates a copy of an existing DataSet using its id.
 	DataSet(const hid_t existing_id);
 
@@ -127,6 +169,10 @@ class H5_DLLCPP DataSet : public H5Object, public AbstractDs {
 	void p_read_fixed_len(const hid_t mem_type_id, const hid_t mem_space_id, const hid_t file_space_id, const hid_t xfer_plist_id, H5std_string& strg) const;
 	void p_read_variable_len(const hid_t mem_type_id, const hid_t mem_space_id, const hid_t file_space_id, const hid_t xfer_plist_id, H5std_string& strg) const;
 
+	// Returns the number of elements the memory buffer of a read or
+	// write must hold.
+	size_t p_get_mem_npoints(const DataSpace& mem_space, const DataSpace& file_space) const;
+
 	// Friend function to set DataSet id.  For library use only.
 	friend void f_DataSet_setId(DataSet* dset, hid_t new_id);
 
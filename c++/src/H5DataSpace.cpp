@@ -100,6 +100,42 @@ DataSpace::DataSpace(const DataSpace& original) : IdComponent()
     incRefCount(); // increment number of references to this id
 }
 
+#ifdef H5_CXX_HAVE_MOVE
+//--------------------------------------------------------------------------
+// Function:	DataSpace move constructor
+///\brief	Move constructor: takes over the id of the original DataSpace
+///		object without changing its reference count.
+///\param	original - IN: DataSpace object to move from
+// Description
+//		The original object is left without an id, so that its
+//		destructor does not close the transferred dataspace.
+//--------------------------------------------------------------------------
+DataSpace::DataSpace(DataSpace&& original) noexcept : IdComponent()
+{
+    id = original.id;
+    original.id = H5I_INVALID_HID;
+}
+
+//--------------------------------------------------------------------------
+// Function:	DataSpace::operator= (move)
+///\brief	Move assignment operator: closes this dataspace and takes over
+///		the id of \a rhs without changing its reference count.
+///\param	rhs - IN: DataSpace object to move from
+///\return	Reference to DataSpace instance
+///\exception	H5::DataSpaceIException
+//--------------------------------------------------------------------------
+DataSpace& DataSpace::operator=(DataSpace&& rhs)
+{
+    if (this != &rhs)
+    {
+	close();
+	id = rhs.id;
+	rhs.id = H5I_INVALID_HID;
+    }
+    return(*this);
+}
+#endif // H5_CXX_HAVE_MOVE
+
 //--------------------------------------------------------------------------
 // Function:	DataSpace::copy
 ///\brief	Makes a copy of an existing dataspace.
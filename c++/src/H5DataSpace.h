@@ -39,6 +39,16 @@ class H5_DLLCPP DataSpace : public IdComponent {
 	// Copy constructor: makes a copy of the original DataSpace object.
 	DataSpace(const DataSpace& original);
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor: takes over the id of the original DataSpace object
+	// without changing its reference count.
+	DataSpace(DataSpace&& original) noexcept;
+
+	// Move assignment operator: closes this object and takes over the
+	// id of rhs.
+	DataSpace& operator=(DataSpace&& rhs);
+#endif
+
 	// Assignment operator
 	DataSpace& operator=( const DataSpace& rhs );
 
@@ -141,6 +141,42 @@ DataType::DataType(const DataType& original) : H5Object()
     incRefCount(); // increment number of references to this id
 }
 
+#ifdef H5_CXX_HAVE_MOVE
+//--------------------------------------------------------------------------
+// Function:	DataType move constructor
+///\brief	Move constructor: takes over the id of the original DataType
+///		object without changing its reference count.
+///\param	original - IN: DataType object to move from
+// Description
+//		The original object is left without an id, so that its
+//		destructor does not close the transferred datatype.
+//--------------------------------------------------------------------------
+DataType::DataType(DataType&& original) noexcept : H5Object()
+{
+    id = original.id;
+    original.id = H5I_INVALID_HID;
+}
+
+//--------------------------------------------------------------------------
+// Function:	DataType::operator= (move)
+///\brief	Move assignment operator: closes this datatype and takes over
+///		the id of \a rhs without changing its reference count.
+///\param	rhs - IN: DataType object to move from
+///\return	Reference to DataType instance
+///\exception	H5::DataTypeIException
+//--------------------------------------------------------------------------
+DataType& DataType::operator=(DataType&& rhs)
+{
+    if (this != &rhs)
+    {
+	close();
+	id = rhs.id;
+	rhs.id = H5I_INVALID_HID;
+    }
+    return(*this);
+}
+#endif // H5_CXX_HAVE_MOVE
+
 //--------------------------------------------------------------------------
 // Function:    DataType overloaded constructor
 ///\brief       Creates a integer type using a predefined type
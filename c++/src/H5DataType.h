@@ -36,6 +36,16 @@ class H5_DLLCPP DataType : public H5Object {
 	// Copy constructor: makes a copy of the original object
 	DataType( const DataType& original );
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor: takes over the id of the original DataType object
+	// without changing its reference count.
+	DataType(DataType&& original) noexcept;
+
+	// Move assignment operator: closes this object and takes over the
+	// id of rhs.
+	DataType& operator=(DataType&& rhs);
+#endif
+
 	// Creates a copy of a predefined type
 	DataType(const PredType& pred_type);
 
@@ -120,6 +120,14 @@ class H5_DLLCPP DSetCreatPropList : public PropList {
 	// Copy constructor: creates a copy of a DSetCreatPropList object.
 	DSetCreatPropList(const DSetCreatPropList& orig);
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor and assignment operators; the id is held and
+	// transferred by the base class.
+	DSetCreatPropList(DSetCreatPropList&& original) = default;
+	DSetCreatPropList& operator=(DSetCreatPropList&& rhs) = default;
+	DSetCreatPropList& operator=(const DSetCreatPropList& rhs) = default;
+#endif
+
 	// Creates a copy of an existing dataset creation property list
 	// using the property list id.
 	DSetCreatPropList(const hid_t plist_id);
@@ -107,6 +107,14 @@ class H5_DLLCPP DSetMemXferPropList : public PropList {
 	// Copy constructor: makes a copy of a DSetMemXferPropList object.
 	DSetMemXferPropList(const DSetMemXferPropList& orig);
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor and assignment operators; the id is held and
+	// transferred by the base class.
+	DSetMemXferPropList(DSetMemXferPropList&& original) = default;
+	DSetMemXferPropList& operator=(DSetMemXferPropList&& rhs) = default;
+	DSetMemXferPropList& operator=(const DSetMemXferPropList& rhs) = default;
+#endif
+
 	// Creates a copy of an existing dataset memory and transfer
 	// property list using the property list id.
 	DSetMemXferPropList(const hid_t plist_id);
@@ -70,6 +70,14 @@ class H5_DLLCPP EnumType : public DataType {
 	// Copy constructor: makes a copy of the original EnumType object.
 	EnumType( const EnumType& original );
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor and assignment operators; the id is held and
+	// transferred by the base class.
+	EnumType(EnumType&& original) = default;
+	EnumType& operator=(EnumType&& rhs) = default;
+	EnumType& operator=(const EnumType& rhs) = default;
+#endif
+
 	virtual ~EnumType();
 };
 #ifndef H5_NO_NAMESPACE
@@ -139,6 +139,14 @@ class H5_DLLCPP FileAccPropList : public PropList {
 	// Copy constructor: creates a copy of a FileAccPropList object.
 	FileAccPropList( const FileAccPropList& original );
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor and assignment operators; the id is held and
+	// transferred by the base class.
+	FileAccPropList(FileAccPropList&& original) = default;
+	FileAccPropList& operator=(FileAccPropList&& rhs) = default;
+	FileAccPropList& operator=(const FileAccPropList& rhs) = default;
+#endif
+
 	// Creates a copy of an existing file access property list
 	// using the property list id.
 	FileAccPropList (const hid_t plist_id);
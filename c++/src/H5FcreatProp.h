@@ -68,6 +68,14 @@ class H5_DLLCPP FileCreatPropList : public PropList {
 	// Copy constructor: creates a copy of a FileCreatPropList object.
 	FileCreatPropList(const FileCreatPropList& orig);
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor and assignment operators; the id is held and
+	// transferred by the base class.
+	FileCreatPropList(FileCreatPropList&& original) = default;
+	FileCreatPropList& operator=(FileCreatPropList&& rhs) = default;
+	FileCreatPropList& operator=(const FileCreatPropList& rhs) = default;
+#endif
+
 	// Creates a copy of an existing file create property list
 	// using the property list id.
 	FileCreatPropList (const hid_t plist_id);
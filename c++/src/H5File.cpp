@@ -186,6 +186,42 @@ H5File::H5File(const H5File& original) : H5Location(), CommonFG()
     incRefCount(); // increment number of references to this id
 }
 
+#ifdef H5_CXX_HAVE_MOVE
+//--------------------------------------------------------------------------
+// Function:	H5File move constructor
+///\brief	Move constructor: takes over the id of the original H5File
+///		object without changing its reference count.
+///\param	original - IN: H5File object to move from
+// Description
+//		The original object is left without an id, so that its
+//		destructor does not close the transferred file.
+//--------------------------------------------------------------------------
+H5File::H5File(H5File&& original) noexcept : H5Location(), CommonFG()
+{
+    id = original.id;
+    original.id = H5I_INVALID_HID;
+}
+
+//--------------------------------------------------------------------------
+// Function:	H5File::operator= (move)
+///\brief	Move assignment operator: closes this file and takes over
+///		the id of \a rhs without changing its reference count.
+///\param	rhs - IN: H5File object to move from
+///\return	Reference to H5File instance
+///\exception	H5::FileIException
+//--------------------------------------------------------------------------
+H5File& H5File::operator=(H5File&& rhs)
+{
+    if (this != &rhs)
+    {
+	close();
+	id = rhs.id;
+	rhs.id = H5I_INVALID_HID;
+    }
+    return(*this);
+}
+#endif // H5_CXX_HAVE_MOVE
+
 //--------------------------------------------------------------------------
 // Function:	H5File::isHdf5 (static)
 ///\brief	Determines whether a file in HDF5 format. (Static)
@@ -101,6 +101,19 @@ class H5_DLLCPP H5File : public H5Location, public CommonFG {
 	// Copy constructor: makes a copy of the original H5File object.
 	H5File(const H5File& original);
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor: takes over the id of the original H5File object
+	// without changing its reference count.
+	H5File(H5File&& original) noexcept;
+
+	// Move assignment operator: closes this object and takes over the
+	// id of rhs.
+	H5File& operator=(H5File&& rhs);
+
+	// Assignment operator, otherwise suppressed by the move operations.
+	H5File& operator=(const H5File& rhs) = default;
+#endif
+
 	// Gets the HDF5 file id.
 	virtual hid_t getId() const;
 
@@ -66,6 +66,14 @@ class H5_DLLCPP FloatType : public AtomType {
 	// Copy constructor: makes a copy of the original FloatType object.
 	FloatType( const FloatType& original );
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor and assignment operators; the id is held and
+	// transferred by the base class.
+	FloatType(FloatType&& original) = default;
+	FloatType& operator=(FloatType&& rhs) = default;
+	FloatType& operator=(const FloatType& rhs) = default;
+#endif
+
 	// Noop destructor.
 	virtual ~FloatType();
 };
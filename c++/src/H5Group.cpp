@@ -65,6 +65,42 @@ Group::Group(const Group& original) : H5Object(), CommonFG()
     incRefCount(); // increment number of references to this id
 }
 
+#ifdef H5_CXX_HAVE_MOVE
+//--------------------------------------------------------------------------
+// Function:	Group move constructor
+///\brief	Move constructor: takes over the id of the original Group
+///		object without changing its reference count.
+///\param	original - IN: Group object to move from
+// Description
+//		The original object is left without an id, so that its
+//		destructor does not close the transferred group.
+//--------------------------------------------------------------------------
+Group::Group(Group&& original) noexcept : H5Object(), CommonFG()
+{
+    id = original.id;
+    original.id = H5I_INVALID_HID;
+}
+
+//--------------------------------------------------------------------------
+// Function:	Group::operator= (move)
+///\brief	Move assignment operator: closes this group and takes over
+///		the id of \a rhs without changing its reference count.
+///\param	rhs - IN: Group object to move from
+///\return	Reference to Group instance
+///\exception	H5::GroupIException
+//--------------------------------------------------------------------------
+Group& Group::operator=(Group&& rhs)
+{
+    if (this != &rhs)
+    {
+	close();
+	id = rhs.id;
+	rhs.id = H5I_INVALID_HID;
+    }
+    return(*this);
+}
+#endif // H5_CXX_HAVE_MOVE
+
 //--------------------------------------------------------------------------
 // Function:	Group::getLocId
 ///\brief	Returns the id of this group.
@@ -50,6 +50,19 @@ class H5_DLLCPP Group : public H5Object, public CommonFG {
 	// Copy constructor: makes a copy of the original object
 	Group(const Group& original);
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor: takes over the id of the original Group object
+	// without changing its reference count.
+	Group(Group&& original) noexcept;
+
+	// Move assignment operator: closes this object and takes over the
+	// id of rhs.
+	Group& operator=(Group&& rhs);
+
+	// Assignment operator, otherwise suppressed by the move operations.
+	Group& operator=(const Group& rhs) = default;
+#endif
+
 	// Gets the group id.
 	virtual hid_t getId() const;
 
@@ -40,3 +40,12 @@ const bool  true  = 1;
  */
 #define H5O_VERSION_2	2
 
+
+// Move constructors and move assignment operators, which transfer an HDF5
+// id between objects without touching its reference count, are provided
+// when configure finds that the compiler supports rvalue references
+// (H5_CXX_HAVE_MOVE in H5pubconf.h).  The same check enables the
+// std::array support of the typed read and write overloads.
+#ifdef H5_CXX_HAVE_MOVE
+#include <utility>
+#endif
@@ -48,6 +48,14 @@ class H5_DLLCPP IntType : public AtomType {
 	// Copy constructor: makes copy of IntType object
 	IntType(const IntType& original);
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor and assignment operators; the id is held and
+	// transferred by the base class.
+	IntType(IntType&& original) = default;
+	IntType& operator=(IntType&& rhs) = default;
+	IntType& operator=(const IntType& rhs) = default;
+#endif
+
 	// Noop destructor.
 	virtual ~IntType();
 };
@@ -260,6 +260,58 @@ class H5_DLLCPP PredType : public AtomType {
 	static const PredType AtExit;
 
 };
+
+/*! \class NativeType
+    \brief NativeType maps a C++ element type to the HDF5 memory datatype
+    used by the typed DataSet::read and DataSet::write overloads.
+
+    Specializations are provided for the arithmetic types, and for
+    \c std::array in H5ArrayType.h.  Applications can specialize it for
+    their own structures, with a \c type() function that returns the
+    CompType describing the structure.
+*/
+template <> struct NativeType<char> {
+    static const PredType& type() { return PredType::NATIVE_CHAR; }
+};
+template <> struct NativeType<signed char> {
+    static const PredType& type() { return PredType::NATIVE_SCHAR; }
+};
+template <> struct NativeType<unsigned char> {
+    static const PredType& type() { return PredType::NATIVE_UCHAR; }
+};
+template <> struct NativeType<short> {
+    static const PredType& type() { return PredType::NATIVE_SHORT; }
+};
+template <> struct NativeType<unsigned short> {
+    static const PredType& type() { return PredType::NATIVE_USHORT; }
+};
+template <> struct NativeType<int> {
+    static const PredType& type() { return PredType::NATIVE_INT; }
+};
+template <> struct NativeType<unsigned int> {
+    static const PredType& type() { return PredType::NATIVE_UINT; }
+};
+template <> struct NativeType<long> {
+    static const PredType& type() { return PredType::NATIVE_LONG; }
+};
+template <> struct NativeType<unsigned long> {
+    static const PredType& type() { return PredType::NATIVE_ULONG; }
+};
+template <> struct NativeType<long long> {
+    static const PredType& type() { return PredType::NATIVE_LLONG; }
+};
+template <> struct NativeType<unsigned long long> {
+    static const PredType& type() { return PredType::NATIVE_ULLONG; }
+};
+template <> struct NativeType<float> {
+    static const PredType& type() { return PredType::NATIVE_FLOAT; }
+};
+template <> struct NativeType<double> {
+    static const PredType& type() { return PredType::NATIVE_DOUBLE; }
+};
+template <> struct NativeType<long double> {
+    static const PredType& type() { return PredType::NATIVE_LDOUBLE; }
+};
 #ifndef H5_NO_NAMESPACE
 }
 #endif
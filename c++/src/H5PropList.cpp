@@ -60,6 +60,42 @@ PropList::PropList(const PropList& original) : IdComponent()
     incRefCount(); // increment number of references to this id
 }
 
+#ifdef H5_CXX_HAVE_MOVE
+//--------------------------------------------------------------------------
+// Function:	PropList move constructor
+///\brief	Move constructor: takes over the id of the original PropList
+///		object without changing its reference count.
+///\param	original - IN: PropList object to move from
+// Description
+//		The original object is left without an id, so that its
+//		destructor does not close the transferred property list.
+//--------------------------------------------------------------------------
+PropList::PropList(PropList&& original) noexcept : IdComponent()
+{
+    id = original.id;
+    original.id = H5I_INVALID_HID;
+}
+
+//--------------------------------------------------------------------------
+// Function:	PropList::operator= (move)
+///\brief	Move assignment operator: closes this property list and takes over
+///		the id of \a rhs without changing its reference count.
+///\param	rhs - IN: PropList object to move from
+///\return	Reference to PropList instance
+///\exception	H5::PropListIException
+//--------------------------------------------------------------------------
+PropList& PropList::operator=(PropList&& rhs)
+{
+    if (this != &rhs)
+    {
+	close();
+	id = rhs.id;
+	rhs.id = H5I_INVALID_HID;
+    }
+    return(*this);
+}
+#endif // H5_CXX_HAVE_MOVE
+
 //--------------------------------------------------------------------------
 // Function:	PropList overloaded constructor
 ///\brief	Creates a property list using the id of an existing property.
@@ -104,6 +104,16 @@ class H5_DLLCPP PropList : public IdComponent {
 	// Copy constructor: creates a copy of a PropList object.
 	PropList(const PropList& original);
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor: takes over the id of the original PropList object
+	// without changing its reference count.
+	PropList(PropList&& original) noexcept;
+
+	// Move assignment operator: closes this object and takes over the
+	// id of rhs.
+	PropList& operator=(PropList&& rhs);
+#endif
+
 	// Gets the property list id.
 	virtual hid_t getId() const;
 
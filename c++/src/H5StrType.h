@@ -60,6 +60,14 @@ class H5_DLLCPP StrType : public AtomType {
 	// Copy constructor - makes a copy of the original object
 	StrType(const StrType& original);
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor and assignment operators; the id is held and
+	// transferred by the base class.
+	StrType(StrType&& original) = default;
+	StrType& operator=(StrType&& rhs) = default;
+	StrType& operator=(const StrType& rhs) = default;
+#endif
+
 	// Noop destructor.
 	virtual ~StrType();
 };
@@ -34,6 +34,14 @@ class H5_DLLCPP VarLenType : public DataType {
 	// Copy constructor: makes copy of the original object.
 	VarLenType( const VarLenType& original );
 
+#ifdef H5_CXX_HAVE_MOVE
+	// Move constructor and assignment operators; the id is held and
+	// transferred by the base class.
+	VarLenType(VarLenType&& original) = default;
+	VarLenType& operator=(VarLenType&& rhs) = default;
+	VarLenType& operator=(const VarLenType& rhs) = default;
+#endif
+
 	// Constructor that takes an existing id
 	VarLenType( const hid_t existing_id );
 
@@ -31,6 +31,7 @@
 #include <iostream>
 #endif
 #include <string>
+#include <vector>
 
 #ifndef H5_NO_NAMESPACE
 #ifndef H5_NO_STD
@@ -52,6 +53,7 @@ const H5std_string	DSET_DEFAULT_NAME("default");
 const H5std_string	DSET_DEFAULT_NAME_PATH("/default");
 const H5std_string	DSET_CHUNKED_NAME("chunked");
 const H5std_string	DSET_SIMPLE_IO_NAME("simple_io");
+const H5std_string	DSET_TYPED_IO_NAME("typed_io");
 const H5std_string	DSET_TCONV_NAME	("tconv");
 const H5std_string	DSET_COMPRESS_NAME("compressed");
 const H5std_string	DSET_BOGUS_NAME	("bogus");
@@ -279,6 +281,249 @@ test_simple_io( H5File& file)
     }
 }   // test_simple_io
 
+/*-------------------------------------------------------------------------
+ * Function:	test_typed_io
+ *
+ * Purpose:	Tests the typed DataSet::read and DataSet::write overloads,
+ *		which deduce the memory datatype from the element type and
+ *		read into vectors and strings directly.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1
+ *
+ * Modifications:
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_typed_io( H5File& file)
+{
+    SUBTEST("typed I/O with vectors and strings");
+
+    try
+    {
+	// Write a vector of doubles and read it back, whole and through a
+	// hyperslab of the file with a memory dataspace
+	hsize_t	dims[2] = {10, 20};
+	DataSpace space (2, dims, NULL);
+	DataSet dataset (file.createDataSet (DSET_TYPED_IO_NAME, PredType::NATIVE_DOUBLE, space));
+
+	std::vector<double> points(200);
+	for (size_t i = 0; i < points.size(); i++)
+	    points[i] = i * 0.5;
+	dataset.write (points);
+
+	std::vector<double> check;
+	dataset.read (check);
+	verify_val(check.size(), points.size(), "DataSet::read", __LINE__, __FILE__);
+	for (size_t i = 0; i < points.size(); i++)
+	    verify_val(check[i], points[i], "DataSet::read", __LINE__, __FILE__);
+
+	// Read a 2x3 block at (4,5), converted to int, into a 6-element vector
+	hsize_t	start[2] = {4, 5};
+	hsize_t	count[2] = {2, 3};
+	DataSpace fspace = dataset.getSpace();
+	fspace.selectHyperslab(H5S_SELECT_SET, count, start);
+	DataSpace mspace (2, count, NULL);
+	std::vector<int> block;
+	dataset.read (block, mspace, fspace);
+	verify_val(block.size(), (size_t)6, "DataSet::read", __LINE__, __FILE__);
+	for (hsize_t i = 0; i < count[0]; i++)
+	    for (hsize_t j = 0; j < count[1]; j++)
+		verify_val(block[i * count[1] + j], (int)points[(start[0] + i) * dims[1] + start[1] + j], "DataSet::read", __LINE__, __FILE__);
+
+	// Writing a vector that is too short must fail
+	std::vector<double> short_points(10);
+	try {
+	    dataset.write (short_points);
+
+	    // continuation here, that means no exception has been thrown
+	    throw InvalidActionException("DataSet::write", "Wrote from a vector smaller than the dataset");
+	}
+	catch (DataSetIException E) // exception expected
+	{}
+
+#ifdef H5_CXX_HAVE_MOVE
+	// Elements that are std::array become HDF5 array types
+	std::vector<std::array<float, 3> > vecs(4);
+	for (size_t i = 0; i < vecs.size(); i++)
+	    for (size_t j = 0; j < 3; j++)
+		vecs[i][j] = (float)(i * 3 + j);
+	hsize_t	nvecs = vecs.size();
+	DataSpace vspace (1, &nvecs, NULL);
+	DataSet vdset (file.createDataSet ("typed_io_array", NativeType<std::array<float, 3> >::type(), vspace));
+	vdset.write (vecs);
+	std::vector<std::array<float, 3> > vcheck;
+	vdset.read (vcheck);
+	verify_val(vcheck.size(), vecs.size(), "DataSet::read", __LINE__, __FILE__);
+	for (size_t i = 0; i < vecs.size(); i++)
+	    for (size_t j = 0; j < 3; j++)
+		verify_val(vcheck[i][j], vecs[i][j], "DataSet::read", __LINE__, __FILE__);
+#endif
+
+	// Vectors of fixed- and variable-length strings; the fixed-length
+	// strings are truncated to the string size
+	const char* words[] = {"alpha", "", "gamma", "a much longer string"};
+	std::vector<H5std_string> strgs(words, words + 4);
+	hsize_t	nstrgs = strgs.size();
+	DataSpace sspace (1, &nstrgs, NULL);
+
+	StrType fixed_type(PredType::C_S1, 8);
+	DataSet fdset (file.createDataSet ("typed_io_fixed_str", fixed_type, sspace));
+	fdset.write (strgs, fixed_type);
+	std::vector<H5std_string> fcheck;
+	fdset.read (fcheck, fixed_type);
+	verify_val(fcheck.size(), strgs.size(), "DataSet::read", __LINE__, __FILE__);
+	for (size_t i = 0; i < strgs.size(); i++)
+	    verify_val(fcheck[i], strgs[i].substr(0, 8), "DataSet::read", __LINE__, __FILE__);
+
+	StrType vlen_type(PredType::C_S1, H5T_VARIABLE);
+	DataSet vldset (file.createDataSet ("typed_io_vlen_str", vlen_type, sspace));
+	vldset.write (strgs, vlen_type);
+	std::vector<H5std_string> vlcheck(1, "to be replaced");
+	vldset.read (vlcheck, vlen_type);
+	verify_val(vlcheck.size(), strgs.size(), "DataSet::read", __LINE__, __FILE__);
+	for (size_t i = 0; i < strgs.size(); i++)
+	    verify_val(vlcheck[i], strgs[i], "DataSet::read", __LINE__, __FILE__);
+
+	// A scalar fixed-length string is read in place
+	DataSpace scalar;
+	StrType str_type(PredType::C_S1, 16);
+	DataSet sdset (file.createDataSet ("typed_io_scalar_str", str_type, scalar));
+	sdset.write (H5std_string("scalar"), str_type);
+	H5std_string strg("previous contents");
+	sdset.read (strg, str_type);
+	verify_val(strg, H5std_string("scalar"), "DataSet::read", __LINE__, __FILE__);
+
+	PASSED();
+	return 0;
+    }  // end try
+
+    catch (InvalidActionException E)
+    {
+	cerr << " FAILED" << endl;
+	cerr << "    <<<  " << E.getDetailMsg() << "  >>>" << endl << endl;
+	return -1;
+    }
+    // catch all other exceptions
+    catch (Exception E)
+    {
+	issue_fail_msg("test_typed_io", __LINE__, __FILE__);
+	return -1;
+    }
+}   // test_typed_io
+
+/*-------------------------------------------------------------------------
+ * Function:	test_chunk_iter
+ *
+ * Purpose:	Tests ChunkIterator on chunked, compressed and contiguous
+ *		datasets, including chunks clipped at the dataset's edges.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1
+ *
+ * Modifications:
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_iter( H5File& file)
+{
+    SUBTEST("ChunkIterator");
+
+    try
+    {
+	// A 10x7 dataset of 4x3 chunks has partial chunks on both edges
+	const hsize_t	nrows = 10, ncols = 7;
+	hsize_t	dims[2] = {nrows, ncols};
+	hsize_t	chunk_dims[2] = {4, 3};
+	DataSpace space (2, dims, NULL);
+	std::vector<int> points(nrows * ncols);
+	for (size_t i = 0; i < points.size(); i++)
+	    points[i] = (int)i;
+
+	DSetCreatPropList chunked;
+	chunked.setChunk(2, chunk_dims);
+	DSetCreatPropList compressed;
+	compressed.setChunk(2, chunk_dims);
+#ifdef H5_HAVE_FILTER_DEFLATE
+	compressed.setDeflate(6);
+#endif
+	const char* names[] = {"chunk_iter", "chunk_iter_compressed", "chunk_iter_contiguous"};
+	const DSetCreatPropList* dcpls[] = {&chunked, &compressed, &DSetCreatPropList::DEFAULT};
+
+	for (int d = 0; d < 3; d++)
+	{
+	    DataSet dataset (file.createDataSet (names[d], PredType::NATIVE_INT, space, *dcpls[d]));
+	    dataset.write (points);
+
+	    // Open the first by name, with the streaming chunk cache
+	    ChunkIterator* it;
+	    if (d == 0)
+		it = new ChunkIterator(file, names[d], PredType::NATIVE_INT);
+	    else
+		it = new ChunkIterator(dataset, PredType::NATIVE_INT);
+
+	    // Every element must be seen once, at its position, and the
+	    // chunks must come in row-major order
+	    for (int pass = 0; pass < 2; pass++)
+	    {
+		std::vector<int> seen(points.size(), 0);
+		hsize_t	prev_row = 0, prev_col = 0;
+		int	nchunks = 0;
+		while (it->next())
+		{
+		    const hsize_t* offset = it->getOffset();
+		    const hsize_t* count = it->getCount();
+		    const int* data = it->getData<int>();
+		    verify_val(it->getNumElements(), (size_t)(count[0] * count[1]), "ChunkIterator::getNumElements", __LINE__, __FILE__);
+		    if (nchunks > 0 && !(offset[0] > prev_row || (offset[0] == prev_row && offset[1] > prev_col)))
+			throw InvalidActionException("ChunkIterator::next", "chunks out of order");
+		    prev_row = offset[0];
+		    prev_col = offset[1];
+
+		    for (hsize_t i = 0; i < count[0]; i++)
+			for (hsize_t j = 0; j < count[1]; j++)
+			{
+			    size_t pos = (size_t)((offset[0] + i) * ncols + offset[1] + j);
+			    verify_val(data[i * count[1] + j], points[pos], "ChunkIterator::next", __LINE__, __FILE__);
+			    seen[pos]++;
+			}
+		    nchunks++;
+		}
+		for (size_t i = 0; i < seen.size(); i++)
+		    verify_val(seen[i], 1, "ChunkIterator::next", __LINE__, __FILE__);
+		if (d < 2)
+		    verify_val(nchunks, 9, "ChunkIterator::next", __LINE__, __FILE__);
+		if (it->getBuffer() != NULL)
+		    throw InvalidActionException("ChunkIterator::getBuffer", "buffer after the last chunk");
+
+		// Go around again
+		it->reset();
+	    }
+	    delete it;
+	}
+
+	PASSED();
+	return 0;
+    }  // end try
+
+    catch (InvalidActionException E)
+    {
+	cerr << " FAILED" << endl;
+	cerr << "    <<<  " << E.getDetailMsg() << "  >>>" << endl << endl;
+	return -1;
+    }
+    // catch all other exceptions
+    catch (Exception E)
+    {
+	issue_fail_msg("test_chunk_iter", __LINE__, __FILE__);
+	return -1;
+    }
+}   // test_chunk_iter
+
 /*-------------------------------------------------------------------------
  * Function:	test_datasize
  *
@@ -1071,6 +1316,8 @@ void test_dset()
 
 	nerrors += test_create(file) < 0 ? 1:0;
 	nerrors += test_simple_io(file) < 0 ? 1:0;
+	nerrors += test_typed_io(file) < 0 ? 1:0;
+	nerrors += test_chunk_iter(file) < 0 ? 1:0;
 	nerrors += test_tconv(file) < 0 ? 1:0;
 	nerrors += test_compression(file) < 0 ? 1:0;
 	nerrors += test_multiopen (file) < 0 ? 1:0;
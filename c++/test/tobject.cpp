@@ -25,6 +25,7 @@
 #include <iostream>
 #endif
 #include <string>
+#include <vector>
 
 #ifndef H5_NO_NAMESPACE
 #ifndef H5_NO_STD
@@ -304,6 +305,86 @@ static void test_get_objtype()
     }
 }   // test_get_objtype
 
+#ifdef H5_CXX_HAVE_MOVE
+/*-------------------------------------------------------------------------
+ * Function:	test_move_objects
+ *
+ * Purpose:	Tests that moving objects transfers their ids without
+ *		changing the ids' reference counts.
+ *
+ * Return:	Success:	0
+ *		Failure:	-1
+ *
+ * Modifications:
+ *
+ *-------------------------------------------------------------------------
+ */
+static void test_move_objects()
+{
+    SUBTEST("Move constructors and move assignment");
+
+    try {
+	// Open file
+	H5File file(FILE_OBJECTS, H5F_ACC_RDWR);
+
+	// Move-construct a group and verify that the id and its reference
+	// count were transferred and the original object was emptied
+	Group grp1 = file.openGroup(GROUP1);
+	hid_t grp_id = grp1.getId();
+	int grp_count = grp1.getCounter();
+	Group grp2(std::move(grp1));
+	verify_val(grp2.getId(), grp_id, "Group move constructor", __LINE__, __FILE__);
+	verify_val(grp2.getCounter(), grp_count, "Group move constructor", __LINE__, __FILE__);
+	verify_val(grp1.getId(), H5I_INVALID_HID, "Group move constructor", __LINE__, __FILE__);
+
+	// Move-assign a dataset over another open dataset
+	DataSet dset1 = file.openDataSet(DSET_IN_FILE);
+	DataSet dset2 = grp2.openDataSet(DSET_IN_GRP1);
+	hid_t dset_id = dset2.getId();
+	dset1 = std::move(dset2);
+	verify_val(dset1.getId(), dset_id, "DataSet move assignment", __LINE__, __FILE__);
+	verify_val(dset1.getCounter(), 1, "DataSet move assignment", __LINE__, __FILE__);
+	verify_val(dset2.getId(), H5I_INVALID_HID, "DataSet move assignment", __LINE__, __FILE__);
+	H5std_string ds_name = dset1.getObjName();
+	verify_val(ds_name, DSET_IN_GRP1_PATH, "DataSet move assignment", __LINE__, __FILE__);
+
+	// Store datatypes and dataspaces in containers, which move them
+	// around as they grow
+	std::vector<IntType> types;
+	std::vector<DataSpace> spaces;
+	for (int i = 0; i < 10; i++)
+	{
+	    types.push_back(IntType(PredType::NATIVE_INT));
+	    spaces.push_back(dset1.getSpace());
+	}
+	for (int i = 0; i < 10; i++)
+	{
+	    verify_val(types[i].getCounter(), 1, "vector<IntType>", __LINE__, __FILE__);
+	    verify_val(spaces[i].getCounter(), 1, "vector<DataSpace>", __LINE__, __FILE__);
+	}
+
+	// Move an array datatype; its dimensions go with it
+	hsize_t dims[2] = {2, 3};
+	ArrayType atype1(PredType::NATIVE_INT, 2, dims);
+	ArrayType atype2(std::move(atype1));
+	hsize_t dims_out[2] = {0, 0};
+	verify_val(atype2.getArrayDims(dims_out), 2, "ArrayType move constructor", __LINE__, __FILE__);
+	verify_val(dims_out[1], dims[1], "ArrayType move constructor", __LINE__, __FILE__);
+	verify_val(atype1.getId(), H5I_INVALID_HID, "ArrayType move constructor", __LINE__, __FILE__);
+
+	// Everything will be closed as they go out of scope
+
+	PASSED();
+    }	// try block
+
+    // catch all other exceptions
+    catch (Exception E)
+    {
+	issue_fail_msg("test_move_objects", __LINE__, __FILE__);
+    }
+}   // test_move_objects
+#endif // H5_CXX_HAVE_MOVE
+
 /*-------------------------------------------------------------------------
  * Function:	test_objects
  *
@@ -330,6 +411,9 @@ void test_object()
     test_get_objname();    // Test get object name from groups/datasets
     test_get_objname_ontypes();	// Test get object name from types
     test_get_objtype();    // Test get object type
+#ifdef H5_CXX_HAVE_MOVE
+    test_move_objects();   // Test moving objects between handles
+#endif
 
 }   // test_objects
 
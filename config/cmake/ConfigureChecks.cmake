@@ -4,6 +4,7 @@
 set (HDF_PREFIX "H5")
 include (${HDF_RESOURCES_EXT_DIR}/ConfigureChecks.cmake)
 include (${CMAKE_ROOT}/Modules/TestForSTDNamespace.cmake)
+include (${CMAKE_ROOT}/Modules/CheckCSourceCompiles.cmake)
 
 #-----------------------------------------------------------------------------
 # Option to Clear File Buffers before write --enable-clear-file-buffers
@@ -110,6 +111,48 @@ if (NOT WINDOWS)
 endif (NOT WINDOWS)
 #-----------------------------------------------------------------------------
 
+#-----------------------------------------------------------------------------
+# Check if the high-level library can provide packet table queues.  A
+# queue's writer thread needs Pthreads, and producers claim its slots with
+# the __sync atomic builtins.  Filters may also process the sub-blocks of a
+# chunk on Pthreads.
+#-----------------------------------------------------------------------------
+if (NOT WINDOWS AND H5_HAVE_PTHREAD_H)
+  CHECK_FUNCTION_EXISTS(pthread_create PTHREAD_CREATE_IN_LIBC)
+  if (NOT PTHREAD_CREATE_IN_LIBC)
+    CHECK_LIBRARY_EXISTS(pthread pthread_create "" PTHREAD_CREATE_IN_LIBPTHREAD)
+    if (PTHREAD_CREATE_IN_LIBPTHREAD)
+      set (CMAKE_REQUIRED_LIBRARIES pthread)
+    endif (PTHREAD_CREATE_IN_LIBPTHREAD)
+  endif (NOT PTHREAD_CREATE_IN_LIBC)
+  CHECK_C_SOURCE_COMPILES ("
+      #include <pthread.h>
+      int main(void)
+      {
+          static size_t tail = 0;
+          pthread_mutex_t mutex;
+
+          pthread_mutex_init(&mutex, NULL);
+          if(!__sync_bool_compare_and_swap(&tail, 0, 1))
+              return 1;
+          __sync_synchronize();
+          return pthread_create(NULL, NULL, NULL, NULL);
+      }" H5_HAVE_PACKET_TABLE_QUEUE)
+  CHECK_C_SOURCE_COMPILES ("
+      #include <pthread.h>
+      int main(void)
+      {
+          pthread_mutex_t mutex;
+
+          pthread_mutex_init(&mutex, NULL);
+          return pthread_create(NULL, NULL, NULL, NULL);
+      }" H5_HAVE_FILTER_THREADS)
+  set (CMAKE_REQUIRED_LIBRARIES)
+  if ((H5_HAVE_PACKET_TABLE_QUEUE OR H5_HAVE_FILTER_THREADS) AND PTHREAD_CREATE_IN_LIBPTHREAD)
+    list (APPEND LINK_LIBS pthread)
+  endif ((H5_HAVE_PACKET_TABLE_QUEUE OR H5_HAVE_FILTER_THREADS) AND PTHREAD_CREATE_IN_LIBPTHREAD)
+endif (NOT WINDOWS AND H5_HAVE_PTHREAD_H)
+
 #-----------------------------------------------------------------------------
 #  Check if Direct I/O driver works
 #-----------------------------------------------------------------------------
@@ -126,6 +126,11 @@
         return npackets;
     }
 
+    int PacketTable::Flush()
+    {
+        return H5PTflush(table_id);
+    }
+
     hid_t PacketTable::GetDataSet()
     {
         return H5PTget_dataset(table_id);
@@ -102,6 +102,12 @@ public:
         return GetPacketCount(ignoreError);
     }
 
+    /* Flush
+     * Writes any buffered packets to the dataset backing this packet table.
+     * Returns 0 on success, negative on failure.
+     */
+    int Flush();
+
     /* GetDataSet
      * Returns the id of the dataset backing this packet table or HID_INVALID on error
      */
@@ -97,3 +97,155 @@ done:
     return(ret_value);
 } /* end H5DOwrite_chunk() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5DOwrite_chunks
+ *
+ * Purpose:     Writes COUNT entire chunks to the file directly, as one
+ *              operation.  Element I of each array describes one chunk,
+ *              as for H5DOwrite_chunk().  A chunk may appear only once.
+ *
+ *              The file space for the chunks that aren't already in the
+ *              file is allocated all at once, and they are written with
+ *              as few I/O operations as possible before their records are
+ *              added to the chunk index.  This is much faster than
+ *              calling H5DOwrite_chunk() for each chunk when writing many
+ *              chunks to a new dataset.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5DOwrite_chunks(hid_t dset_id, hid_t dxpl_id, size_t count, const uint32_t filters[],
+         const hsize_t *const offset[], const size_t data_size[], const void *const buf[])
+{
+    hbool_t created_dxpl = FALSE;       /* Whether we created a DXPL */
+    hbool_t do_direct_write = TRUE;     /* Flag for direct writes */
+    size_t  no_chunks = 0;              /* Chunk count to reset DXPL with */
+    herr_t  ret_value = FAIL;           /* Return value */
+
+    /* Check arguments */
+    if(dset_id < 0)
+        goto done;
+    if(!count)
+        goto done;
+    if(!filters || !offset || !data_size || !buf)
+        goto done;
+
+    /* If the user passed in a default DXPL, create one to pass to H5Dwrite() */
+    if(H5P_DEFAULT == dxpl_id) {
+	if((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0)
+            goto done;
+        created_dxpl = TRUE;
+    } /* end if */
+
+    /* Set direct write parameters */
+    if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_WRITE_FLAG_NAME, &do_direct_write) < 0)
+        goto done;
+    if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_WRITE_COUNT_NAME, &count) < 0)
+        goto done;
+    if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_LIST_NAME, &filters) < 0)
+        goto done;
+    if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_LIST_NAME, &offset) < 0)
+        goto done;
+    if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_LIST_NAME, &data_size) < 0)
+        goto done;
+
+    /* Write chunks */
+    if(H5Dwrite(dset_id, 0, H5S_ALL, H5S_ALL, dxpl_id, buf) < 0)
+        goto done;
+
+    /* Indicate success */
+    ret_value = SUCCEED;
+
+done:
+    if(created_dxpl) {
+        if(H5Pclose(dxpl_id) < 0)
+            ret_value = FAIL;
+    } /* end if */
+    else if(H5P_DEFAULT != dxpl_id) {
+        /* Reset the direct write settings on user DXPL */
+        do_direct_write = FALSE;
+        if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_WRITE_FLAG_NAME, &do_direct_write) < 0)
+            ret_value = FAIL;
+        if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_WRITE_COUNT_NAME, &no_chunks) < 0)
+            ret_value = FAIL;
+    } /* end else-if */
+
+    return(ret_value);
+} /* end H5DOwrite_chunks() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5DOread_chunk
+ *
+ * Purpose:     Reads an entire chunk from the file directly, as it is
+ *              stored, without passing it through the chunk cache or the
+ *              dataset's filters.  The chunk's filter mask is returned in
+ *              FILTERS.  BUF holds BUF_SIZE bytes, which must be at least
+ *              the chunk's stored size, as returned by
+ *              H5Dget_chunk_storage_size(); otherwise nothing is read.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5DOread_chunk(hid_t dset_id, hid_t dxpl_id, const hsize_t *offset, uint32_t *filters,
+         size_t buf_size, void *buf)
+{
+    hbool_t created_dxpl = FALSE;       /* Whether we created a DXPL */
+    hbool_t do_direct_read = TRUE;      /* Flag for direct reads */
+    herr_t  ret_value = FAIL;           /* Return value */
+
+    /* Check arguments */
+    if(dset_id < 0)
+        goto done;
+    if(!buf)
+        goto done;
+    if(!offset)
+        goto done;
+    if(!filters)
+        goto done;
+
+    /* If the user passed in a default DXPL, create one to pass to H5Dread() */
+    if(H5P_DEFAULT == dxpl_id) {
+	if((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0)
+            goto done;
+        created_dxpl = TRUE;
+    } /* end if */
+
+    /* Set direct read parameters */
+    if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_READ_FLAG_NAME, &do_direct_read) < 0)
+        goto done;
+    if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_READ_OFFSET_NAME, &offset) < 0)
+        goto done;
+    if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_READ_BUF_SIZE_NAME, &buf_size) < 0)
+        goto done;
+
+    /* Read chunk */
+    if(H5Dread(dset_id, 0, H5S_ALL, H5S_ALL, dxpl_id, buf) < 0)
+        goto done;
+
+    /* Get the chunk's filter mask */
+    if(H5Pget(dxpl_id, H5D_XFER_DIRECT_CHUNK_READ_FILTERS_NAME, filters) < 0)
+        goto done;
+
+    /* Indicate success */
+    ret_value = SUCCEED;
+
+done:
+    if(created_dxpl) {
+        if(H5Pclose(dxpl_id) < 0)
+            ret_value = FAIL;
+    } /* end if */
+    else if(H5P_DEFAULT != dxpl_id) {
+        /* Reset the direct read flag on user DXPL */
+        do_direct_read = FALSE;
+        if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_READ_FLAG_NAME, &do_direct_read) < 0)
+            ret_value = FAIL;
+    } /* end else-if */
+
+    return(ret_value);
+} /* end H5DOread_chunk() */
@@ -22,7 +22,7 @@ extern "C" {
 
 /*-------------------------------------------------------------------------
  *
- * Direct chunk write function
+ * Direct chunk write and read functions
  *
  *-------------------------------------------------------------------------
  */
@@ -34,6 +34,21 @@ H5_HLDLL herr_t H5DOwrite_chunk(hid_t dset_id,
          		size_t data_size, 
 			const void *buf);
 
+H5_HLDLL herr_t H5DOwrite_chunks(hid_t dset_id,
+			hid_t dxpl_id,
+			size_t count,
+			const uint32_t filters[],
+			const hsize_t *const offset[],
+			const size_t data_size[],
+			const void *const buf[]);
+
+H5_HLDLL herr_t H5DOread_chunk(hid_t dset_id,
+			hid_t dxpl_id,
+			const hsize_t *offset,
+			uint32_t *filters,
+			size_t buf_size,
+			void *buf);
+
 #ifdef __cplusplus
 }
 #endif
@@ -18,6 +18,9 @@
 #include "H5PTprivate.h"
 #include "H5TBprivate.h"
 #include <stdlib.h>
+#ifdef H5_HAVE_PACKET_TABLE_QUEUE
+#include <pthread.h>
+#endif
 
 /*  Packet Table private data */
 
@@ -27,6 +30,11 @@ typedef struct
   hid_t type_id;  /* The ID of the packet table's native datatype */
   hsize_t current_index;  /* The index of the packet that get_next_packet will read next */
   hsize_t size;  /* The number of packets currently contained in this table */
+  size_t rec_size;  /* The size of one packet in memory */
+  size_t buf_nrecords;  /* The capacity of the write buffer in packets (one chunk) */
+  size_t buf_count;  /* The number of appended packets held in the write buffer */
+  unsigned char *buf;  /* The write buffer, or NULL if appends are not buffered */
+  struct H5PT_queue_t *queue;  /* The queue feeding this table, if any */
 } htbl_t;
 
 static hsize_t H5PT_ptable_count = 0;
@@ -34,12 +42,25 @@ static H5I_type_t H5PT_ptable_id_type = H5I_UNINIT;
 
 #define H5PT_HASH_TABLE_SIZE 64
 
+/* Largest chunk, in bytes, that appends are buffered for */
+#define H5PT_MAX_BUFFER_SIZE (64 * 1024 * 1024)
+
 /* Packet Table private functions */
 static herr_t H5PT_free_id(void *id);
 static herr_t H5PT_close( htbl_t* table );
+static herr_t H5PT_init_buffer(htbl_t *table);
+static herr_t H5PT_flush_buffer(htbl_t *table);
+static herr_t H5PT_append(htbl_t *table, size_t nrecords, const void *data);
 static herr_t H5PT_create_index(htbl_t *table_id);
 static herr_t H5PT_set_index(htbl_t *table_id, hsize_t pt_index);
 static herr_t H5PT_get_index(htbl_t *table_id, hsize_t *pt_index);
+#ifdef H5_HAVE_PACKET_TABLE_QUEUE
+static void H5PT_lock_table(htbl_t *table);
+static void H5PT_unlock_table(htbl_t *table);
+#else
+#define H5PT_lock_table(T)
+#define H5PT_unlock_table(T)
+#endif
 
 /*-------------------------------------------------------------------------
  *
@@ -122,7 +143,7 @@ H5PTcreate_fl2(hid_t loc_id, const char *dset_name, hid_t dtype_id, hsize_t chun
 
   /* check the arguments */
   if (dset_name == NULL) {
-    goto out;
+    goto error;
   }
 
   /* Register the packet table ID type if this is the first table created */
@@ -132,6 +153,10 @@ H5PTcreate_fl2(hid_t loc_id, const char *dset_name, hid_t dtype_id, hsize_t chun
 
   /* Get memory for the table identifier */
   table = (htbl_t *)HDmalloc(sizeof(htbl_t));
+  if(table == NULL)
+    goto error;
+  table->buf = NULL;
+  table->queue = NULL;
 
   /* Create a simple data space with unlimited size */
   dims[0] = 0;
@@ -168,11 +193,15 @@ H5PTcreate_fl2(hid_t loc_id, const char *dset_name, hid_t dtype_id, hsize_t chun
     goto error;
 
   if((table->type_id = H5Tget_native_type(table->type_id, H5T_DIR_DEFAULT)) < 0)
-    goto out;
+    goto error;
 
   H5PT_create_index(table);
   table->size = 0;
 
+  /* Set up the write buffer for appends */
+  if(H5PT_init_buffer(table) < 0)
+    goto error;
+
   /* Get an ID for this table */
   ret_value = H5Iregister(H5PT_ptable_id_type, table);
 
@@ -189,7 +218,11 @@ H5PTcreate_fl2(hid_t loc_id, const char *dset_name, hid_t dtype_id, hsize_t chun
     H5Pclose(plist_id);
     H5Dclose(dset_id);
     if(table)
+    {
+      if(table->buf)
+        HDfree(table->buf);
       HDfree(table);
+    }
     H5E_END_TRY
     ret_value = H5I_INVALID_HID;
 
@@ -327,7 +360,7 @@ H5PTopen2(hid_t loc_id, const char *dset_name, hid_t mem_type)
 
   /* check the arguments */
   if (dset_name == NULL) {
-    goto out;
+    goto error;
   }
 
   /* Register the packet table ID type if this is the first table created */
@@ -342,6 +375,8 @@ H5PTopen2(hid_t loc_id, const char *dset_name, hid_t mem_type)
   }
   table->dset_id = H5I_BADID;
   table->type_id = H5I_BADID;
+  table->buf = NULL;
+  table->queue = NULL;
 
   /* Open the dataset */
   if((table->dset_id = H5Dopen2(loc_id, dset_name, H5P_DEFAULT)) < 0)
@@ -377,6 +412,10 @@ H5PTopen2(hid_t loc_id, const char *dset_name, hid_t mem_type)
     goto error;
   table->size = dims[0];
 
+  /* Set up the write buffer for appends */
+  if(H5PT_init_buffer(table) < 0)
+    goto error;
+
   /* Get an ID for this table */
   ret_value = H5Iregister(H5PT_ptable_id_type, table);
 
@@ -395,6 +434,8 @@ error:
   {
     H5Dclose(table->dset_id);
     H5Tclose(table->type_id);
+    if(table->buf)
+      HDfree(table->buf);
     HDfree(table);
   }
   H5E_END_TRY
@@ -407,7 +448,9 @@ done:
 /*-------------------------------------------------------------------------
  * Function: H5PT_free_id
  *
- * Purpose: Free an id.  Callback for H5Iregister_type.
+ * Purpose: Free an id.  Callback for H5Iregister_type.  The table is
+ *          closed as by H5PTclose, so that packets still held in the
+ *          write buffer aren't lost when an ID is released without it.
  *
  * Return: Success: 0, Failure: N/A
  *-------------------------------------------------------------------------
@@ -415,10 +458,106 @@ done:
 static herr_t
 H5PT_free_id(void *id)
 {
-    HDfree(id);
+    htbl_t *table = (htbl_t *)id;
+
+    /* One less packet table open */
+    H5PT_ptable_count--;
+
+    /* The dataset is already closed when the library shuts down */
+    if(H5Iis_valid(table->dset_id) > 0) {
+        H5E_BEGIN_TRY
+        H5PT_close(table);
+        H5E_END_TRY
+        return 0;
+    }
+
+    if(table->buf)
+        HDfree(table->buf);
+    HDfree(table);
     return 0;
 }
 
+/*-------------------------------------------------------------------------
+ * Function: H5PT_init_buffer
+ *
+ * Purpose: Sets up the write buffer of a table.  Appended packets are
+ *          gathered in a buffer of one chunk, and the dataset is only
+ *          extended and written a whole chunk at a time.  Tables whose
+ *          packets hold variable-length data are not buffered, since the
+ *          caller may free that data as soon as H5PTappend returns.
+ *
+ * Return: Success: 0, Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PT_init_buffer(htbl_t *table)
+{
+  hid_t plist_id = H5I_BADID;
+  hsize_t dims_chunk[1];
+  htri_t has_vlen;
+
+  table->buf = NULL;
+  table->buf_nrecords = 0;
+  table->buf_count = 0;
+
+  if((table->rec_size = H5Tget_size(table->type_id)) == 0)
+    goto out;
+
+  if((has_vlen = H5Tdetect_class(table->type_id, H5T_VLEN)) < 0)
+    goto out;
+  if(has_vlen || H5Tis_variable_str(table->type_id) > 0)
+    return 0;
+
+  if((plist_id = H5Dget_create_plist(table->dset_id)) < 0)
+    goto out;
+  if(H5Pget_layout(plist_id) == H5D_CHUNKED &&
+          H5Pget_chunk(plist_id, 1, dims_chunk) == 1 &&
+          dims_chunk[0] > 1 &&
+          dims_chunk[0] <= H5PT_MAX_BUFFER_SIZE / table->rec_size)
+  {
+    table->buf_nrecords = (size_t)dims_chunk[0];
+
+    /* If the buffer can't be allocated, append without it */
+    if(NULL == (table->buf = (unsigned char *)HDmalloc(table->buf_nrecords * table->rec_size)))
+      table->buf_nrecords = 0;
+  }
+  if(H5Pclose(plist_id) < 0)
+    goto out;
+
+  return 0;
+
+out:
+  H5E_BEGIN_TRY
+  H5Pclose(plist_id);
+  H5E_END_TRY
+  return -1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PT_flush_buffer
+ *
+ * Purpose: Writes the packets held in the write buffer of a table to its
+ *          dataset
+ *
+ * Return: Success: 0, Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PT_flush_buffer(htbl_t *table)
+{
+  if(table->buf_count == 0)
+    return 0;
+
+  if(H5TB_common_append_records(table->dset_id, table->type_id, table->buf_count,
+                  table->size - table->buf_count, table->buf) < 0)
+    return -1;
+
+  table->buf_count = 0;
+  return 0;
+}
+
 /*-------------------------------------------------------------------------
  * Function: H5PT_close
  *
@@ -444,6 +583,10 @@ H5PT_close(htbl_t* table)
   if(table == NULL)
     goto out;
 
+  /* Write out any buffered packets */
+  if(H5PT_flush_buffer(table) < 0)
+    goto out;
+
   /* Close the dataset */
   if(H5Dclose(table->dset_id) < 0)
     goto out;
@@ -452,6 +595,8 @@ H5PT_close(htbl_t* table)
   if(H5Tclose(table->type_id) < 0)
     goto out;
 
+  if(table->buf)
+    HDfree(table->buf);
   HDfree(table);
 
   return 0;
@@ -463,6 +608,8 @@ out:
     H5Dclose(table->dset_id);
     H5Tclose(table->type_id);
     H5E_END_TRY
+    if(table->buf)
+      HDfree(table->buf);
     HDfree(table);
   }
   return -1;
@@ -493,6 +640,12 @@ herr_t H5PTclose(hid_t table_id)
   int ret_value = 0;
   FUNC_ENTER_API(FAIL)
 
+  /* A table can't be closed while a queue is writing to it */
+  if((table = (htbl_t *)H5Iobject_verify(table_id, H5PT_ptable_id_type)) == NULL)
+    goto error;
+  if(table->queue != NULL)
+    goto error;
+
   /* Remove the ID from the library */
   if((table = (htbl_t *)H5Iremove_verify(table_id, H5PT_ptable_id_type)) ==NULL)
     goto error;
@@ -554,7 +707,11 @@ hid_t H5PTget_dataset(hid_t table_id)
   if((table = (htbl_t *) H5Iobject_verify(table_id, H5PT_ptable_id_type)) == NULL)
     goto error;
 
-  ret_value = table->dset_id;
+  /* Make the dataset hold every appended packet */
+  H5PT_lock_table(table);
+  if(H5PT_flush_buffer(table) == 0)
+    ret_value = table->dset_id;
+  H5PT_unlock_table(table);
 
 error:
 
@@ -628,24 +785,538 @@ herr_t H5PTappend(hid_t table_id,
 
   /* Find the table struct from its ID */
   if((table = (htbl_t *) H5Iobject_verify(table_id, H5PT_ptable_id_type)) == NULL)
-    goto out;
+    return -1;
+
+  /* A table fed by a queue is only written through it */
+  if(table->queue != NULL)
+    return -1;
 
+  return H5PT_append(table, nrecords, data);
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PT_append
+ *
+ * Purpose: Appends packets to the end of a packet table, through its
+ *          write buffer if it has one
+ *
+ * Return: Success: 0, Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PT_append(htbl_t *table, size_t nrecords, const void *data)
+{
   /* If we are asked to write 0 records, just do nothing */
   if(nrecords == 0)
     return 0;
 
-  if((H5TB_common_append_records(table->dset_id, table->type_id,
-                  nrecords, table->size, data)) < 0)
-    goto out;
+  /* Without a write buffer, append straight to the dataset */
+  if(table->buf == NULL)
+  {
+    if((H5TB_common_append_records(table->dset_id, table->type_id,
+                    nrecords, table->size, data)) < 0)
+      goto out;
+
+    /* Update table size */
+    table->size += nrecords;
+    return 0;
+  }
+
+  while(nrecords > 0)
+  {
+    hsize_t nwritten = table->size - table->buf_count;
+    size_t room;  /* Packets left before the end of the current chunk */
+    size_t n;
+
+    room = table->buf_nrecords - (size_t)(nwritten % table->buf_nrecords) - table->buf_count;
+
+    if(table->buf_count == 0 && nrecords >= room)
+    {
+      /* Whole chunks are written straight from the caller's buffer */
+      n = room + ((nrecords - room) / table->buf_nrecords) * table->buf_nrecords;
+      if((H5TB_common_append_records(table->dset_id, table->type_id,
+                      n, table->size, data)) < 0)
+        goto out;
+      table->size += n;
+    }
+    else
+    {
+      n = MIN(room, nrecords);
+      HDmemcpy(table->buf + table->buf_count * table->rec_size, data, n * table->rec_size);
+      table->buf_count += n;
+      table->size += n;
+
+      /* Write the buffer out once it completes a chunk */
+      if(n == room && H5PT_flush_buffer(table) < 0)
+        goto out;
+    }
+
+    data = (const unsigned char *)data + n * table->rec_size;
+    nrecords -= n;
+  }
 
-  /* Update table size */
-  table->size += nrecords;
   return 0;
 
 out:
   return -1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function: H5PTflush
+ *
+ * Purpose: Writes the packets held in the write buffer of a packet table
+ *          to its dataset.  H5PTclose, the read functions and
+ *          H5PTget_dataset do this implicitly.
+ *
+ * Return: Success: 0, Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t H5PTflush(hid_t table_id)
+{
+  htbl_t * table;
+  herr_t ret_value;
+
+  /* Find the table struct from its ID */
+  if((table = (htbl_t *) H5Iobject_verify(table_id, H5PT_ptable_id_type)) == NULL)
+    return -1;
+
+  H5PT_lock_table(table);
+  ret_value = H5PT_flush_buffer(table);
+  H5PT_unlock_table(table);
+
+  return ret_value;
+}
+
+#ifdef H5_HAVE_PACKET_TABLE_QUEUE
+/*-------------------------------------------------------------------------
+ *
+ * Packet queue functions
+ *
+ * Producers claim slots of a bounded ring with a compare-and-swap on its
+ * tail and publish each packet by advancing the slot's sequence number, so
+ * H5PTenqueue makes no library calls and takes no locks unless the ring is
+ * full.  A single writer thread drains the ring in batches into the table.
+ * The writer holds the queue's table lock while it changes the table, and
+ * the functions that read the table's state take it too.
+ *
+ * Unless the library is thread-safe, the writer's library calls are only
+ * safe while no other thread calls the library, so the application may
+ * then only use H5PTenqueue, H5PTfence and H5PTclose_queue until the queue
+ * is closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/* Longest time a sleeping producer or writer waits before looking again */
+#define H5PT_QUEUE_WAIT_NSEC  1000000
+
+/* Fewest packets the writer drains into one append */
+#define H5PT_QUEUE_MIN_BATCH  1024
+
+/* The sequence number of the slot holding position P */
+#define H5PT_QUEUE_SEQ(Q, P)  (((volatile size_t *)(Q)->seq)[(P) & ((Q)->capacity - 1)])
+
+struct H5PT_queue_t
+{
+  htbl_t *table;  /* The packet table written to */
+  size_t rec_size;  /* The size of one packet in memory */
+  size_t capacity;  /* The number of slots in the ring (a power of two) */
+  unsigned char *slots;  /* The packets in the ring */
+  size_t *seq;  /* The sequence number of each slot */
+  volatile size_t tail;  /* The next position producers claim */
+  size_t head;  /* The next position the writer drains */
+  size_t batch_nrecords;  /* The capacity of the writer's batch in packets */
+  unsigned char *batch;  /* The writer's batch of packets to append */
+  volatile size_t fence_req;  /* The position the latest fence waits for */
+  volatile size_t fenced;  /* The position up to which packets are in the dataset */
+  volatile int stop;  /* Whether the writer should exit once drained */
+  volatile int failed;  /* Whether an append or flush has failed */
+  pthread_t thread;  /* The writer thread */
+  pthread_mutex_t mutex;  /* Protects the sleeps below */
+  pthread_mutex_t table_mutex;  /* Held while the table's state is used */
+  pthread_cond_t progress;  /* Signalled when the writer frees slots or completes a fence */
+  pthread_cond_t work;  /* Signalled when the writer has something to do */
+};
+
+/*-------------------------------------------------------------------------
+ * Function: H5PT_lock_table
+ *
+ * Purpose: Keeps the writer of a table's queue, if it has one, from
+ *          changing the table until H5PT_unlock_table
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5PT_lock_table(htbl_t *table)
+{
+  if(table->queue != NULL)
+    pthread_mutex_lock(&table->queue->table_mutex);
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PT_unlock_table
+ *
+ * Purpose: Releases the lock taken by H5PT_lock_table
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5PT_unlock_table(htbl_t *table)
+{
+  if(table->queue != NULL)
+    pthread_mutex_unlock(&table->queue->table_mutex);
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PT_queue_wait
+ *
+ * Purpose: Sleeps on a condition variable for at most
+ *          H5PT_QUEUE_WAIT_NSEC, so a missed signal costs no more than
+ *          that.  The queue's mutex must be held.
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5PT_queue_wait(H5PT_queue_t *queue, pthread_cond_t *cond)
+{
+  struct timeval now;
+  struct timespec until;
+  long nsec;
+
+  HDgettimeofday(&now, NULL);
+  nsec = now.tv_usec * 1000 + H5PT_QUEUE_WAIT_NSEC;
+  until.tv_sec = now.tv_sec + nsec / 1000000000;
+  until.tv_nsec = nsec % 1000000000;
+  pthread_cond_timedwait(cond, &queue->mutex, &until);
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PT_queue_drain
+ *
+ * Purpose: Copies the published packets at the head of the ring into the
+ *          writer's batch and releases their slots
+ *
+ * Return: The number of packets copied
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5PT_queue_drain(H5PT_queue_t *queue)
+{
+  size_t mask = queue->capacity - 1;
+  size_t n;
+
+  for(n = 0; n < queue->batch_nrecords; n++)
+  {
+    size_t pos = queue->head + n;
+
+    if(H5PT_QUEUE_SEQ(queue, pos) != pos + 1)
+      break;
+    __sync_synchronize();
+    HDmemcpy(queue->batch + n * queue->rec_size, queue->slots + (pos & mask) * queue->rec_size, queue->rec_size);
+    __sync_synchronize();
+    H5PT_QUEUE_SEQ(queue, pos) = pos + queue->capacity;
+  }
+
+  return n;
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PT_queue_writer
+ *
+ * Purpose: Body of the writer thread: drains the ring into the packet
+ *          table, writes the table's buffer out when a fence asks for it,
+ *          and exits once stopped and drained
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5PT_queue_writer(void *_queue)
+{
+  H5PT_queue_t *queue = (H5PT_queue_t *)_queue;
+
+  for(;;)
+  {
+    size_t n = H5PT_queue_drain(queue);
+
+    if(n > 0)
+    {
+      pthread_mutex_lock(&queue->table_mutex);
+      if(H5PT_append(queue->table, n, queue->batch) < 0)
+        queue->failed = 1;
+      pthread_mutex_unlock(&queue->table_mutex);
+      queue->head += n;
+    }
+
+    /* Complete a fence once every packet before it has been appended */
+    if(queue->fence_req > queue->fenced && queue->head >= queue->fence_req)
+    {
+      pthread_mutex_lock(&queue->table_mutex);
+      if(H5PT_flush_buffer(queue->table) < 0)
+        queue->failed = 1;
+      pthread_mutex_unlock(&queue->table_mutex);
+      pthread_mutex_lock(&queue->mutex);
+      queue->fenced = queue->head;
+      pthread_cond_broadcast(&queue->progress);
+      pthread_mutex_unlock(&queue->mutex);
+    }
+    else if(n > 0)
+    {
+      /* Wake producers waiting for free slots */
+      pthread_mutex_lock(&queue->mutex);
+      pthread_cond_broadcast(&queue->progress);
+      pthread_mutex_unlock(&queue->mutex);
+    }
+
+    if(n == 0)
+    {
+      if(queue->stop && queue->head == queue->tail)
+        break;
+      pthread_mutex_lock(&queue->mutex);
+      if(!queue->stop && queue->fence_req <= queue->fenced &&
+              H5PT_QUEUE_SEQ(queue, queue->head) != queue->head + 1)
+        H5PT_queue_wait(queue, &queue->work);
+      pthread_mutex_unlock(&queue->mutex);
+    }
+  }
+
+  return NULL;
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PTcreate_queue
+ *
+ * Purpose: Starts a writer thread for a packet table and returns a queue
+ *          that any number of threads can append packets to with
+ *          H5PTenqueue.  While the queue is open, the packet table is
+ *          only written through it: H5PTappend and H5PTclose fail.
+ *
+ * Return: Success: the queue, Failure: NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5PT_queue_t *
+H5PTcreate_queue(hid_t table_id, size_t queue_size)
+{
+  H5PT_queue_t *queue = NULL;
+  htbl_t *table;
+  size_t u;
+
+  /* Find the table struct from its ID */
+  if((table = (htbl_t *) H5Iobject_verify(table_id, H5PT_ptable_id_type)) == NULL)
+    return NULL;
+
+  /* Only one queue may feed a table */
+  if(table->queue != NULL || queue_size == 0)
+    return NULL;
+
+  /* The capacity is rounded up to a power of two, which must fit in a size_t */
+  if(queue_size > (SIZET_MAX >> 1) + 1)
+    return NULL;
+
+  if(NULL == (queue = (H5PT_queue_t *)HDcalloc((size_t)1, sizeof(H5PT_queue_t))))
+    return NULL;
+  queue->table = table;
+  queue->rec_size = table->rec_size;
+
+  /* The ring's capacity is a power of two, so positions map to slots with a mask */
+  for(queue->capacity = 2; queue->capacity < queue_size; queue->capacity *= 2)
+    ;
+  queue->batch_nrecords = MIN(queue->capacity, MAX(table->buf_nrecords, H5PT_QUEUE_MIN_BATCH));
+  if(queue->capacity > SIZET_MAX / MAX(queue->rec_size, sizeof(size_t)))
+    goto out;
+
+  if(NULL == (queue->slots = (unsigned char *)HDmalloc(queue->capacity * queue->rec_size)))
+    goto out;
+  if(NULL == (queue->seq = (size_t *)HDmalloc(queue->capacity * sizeof(size_t))))
+    goto out;
+  if(NULL == (queue->batch = (unsigned char *)HDmalloc(queue->batch_nrecords * queue->rec_size)))
+    goto out;
+  for(u = 0; u < queue->capacity; u++)
+    queue->seq[u] = u;
+
+  if(pthread_mutex_init(&queue->mutex, NULL))
+    goto out;
+  if(pthread_mutex_init(&queue->table_mutex, NULL))
+  {
+    pthread_mutex_destroy(&queue->mutex);
+    goto out;
+  }
+  if(pthread_cond_init(&queue->progress, NULL))
+  {
+    pthread_mutex_destroy(&queue->table_mutex);
+    pthread_mutex_destroy(&queue->mutex);
+    goto out;
+  }
+  if(pthread_cond_init(&queue->work, NULL))
+  {
+    pthread_cond_destroy(&queue->progress);
+    pthread_mutex_destroy(&queue->table_mutex);
+    pthread_mutex_destroy(&queue->mutex);
+    goto out;
+  }
+
+  /* The table's readers lock it from the moment the writer may run */
+  table->queue = queue;
+  if(pthread_create(&queue->thread, NULL, H5PT_queue_writer, queue))
+  {
+    table->queue = NULL;
+    pthread_cond_destroy(&queue->work);
+    pthread_cond_destroy(&queue->progress);
+    pthread_mutex_destroy(&queue->table_mutex);
+    pthread_mutex_destroy(&queue->mutex);
+    goto out;
+  }
+
+  return queue;
+
+out:
+  if(queue->slots)
+    HDfree(queue->slots);
+  if(queue->seq)
+    HDfree(queue->seq);
+  if(queue->batch)
+    HDfree(queue->batch);
+  HDfree(queue);
+  return NULL;
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PTenqueue
+ *
+ * Purpose: Appends packets to a packet table through its queue.  May be
+ *          called from any number of threads at once; packets from one
+ *          thread are appended in the order that thread enqueued them.
+ *          Waits for free slots when the queue is full.
+ *
+ * Return: Success: 0, Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PTenqueue(H5PT_queue_t *queue, size_t nrecords, const void *data)
+{
+  const unsigned char *src = (const unsigned char *)data;
+  size_t mask;
+
+  if(queue == NULL || (nrecords > 0 && data == NULL))
+    return -1;
+  mask = queue->capacity - 1;
+
+  while(nrecords > 0)
+  {
+    size_t pos = queue->tail;
+    size_t seq = H5PT_QUEUE_SEQ(queue, pos);
+
+    if(seq == pos)
+    {
+      /* The slot is free: claim it, then fill and publish it */
+      if(__sync_bool_compare_and_swap(&queue->tail, pos, pos + 1))
+      {
+        HDmemcpy(queue->slots + (pos & mask) * queue->rec_size, src, queue->rec_size);
+        __sync_synchronize();
+        H5PT_QUEUE_SEQ(queue, pos) = pos + 1;
+        src += queue->rec_size;
+        nrecords--;
+      }
+    }
+    else if(seq < pos)
+    {
+      /* The ring is full: wait for the writer */
+      if(queue->stop)
+        return -1;
+      pthread_mutex_lock(&queue->mutex);
+      pthread_cond_signal(&queue->work);
+      if(H5PT_QUEUE_SEQ(queue, pos) < pos)
+        H5PT_queue_wait(queue, &queue->progress);
+      pthread_mutex_unlock(&queue->mutex);
+    }
+    /* Otherwise another producer claimed the slot first; look again */
+  }
+
+  return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PTfence
+ *
+ * Purpose: Waits until every packet enqueued before the call is written
+ *          to the packet table's dataset
+ *
+ * Return: Success: 0, Failure: -1 (including when an earlier append
+ *         failed)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PTfence(H5PT_queue_t *queue)
+{
+  size_t target;
+
+  if(queue == NULL)
+    return -1;
+
+  target = __sync_fetch_and_add(&queue->tail, 0);
+
+  pthread_mutex_lock(&queue->mutex);
+  if(target > queue->fence_req)
+    queue->fence_req = target;
+  pthread_cond_signal(&queue->work);
+  while(queue->fenced < target && !queue->failed)
+    H5PT_queue_wait(queue, &queue->progress);
+  pthread_mutex_unlock(&queue->mutex);
+
+  return queue->failed ? -1 : 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PTclose_queue
+ *
+ * Purpose: Writes out every packet in a queue, stops its writer thread and
+ *          frees it.  No thread may be enqueueing during the call.
+ *
+ * Return: Success: 0, Failure: -1 (including when an earlier append
+ *         failed)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PTclose_queue(H5PT_queue_t *queue)
+{
+  herr_t ret_value;
+
+  if(queue == NULL)
+    return -1;
+
+  ret_value = H5PTfence(queue);
+
+  pthread_mutex_lock(&queue->mutex);
+  queue->stop = 1;
+  pthread_cond_signal(&queue->work);
+  pthread_mutex_unlock(&queue->mutex);
+  pthread_join(queue->thread, NULL);
+
+  /* Detach the queue from the table before its locks go away */
+  pthread_mutex_lock(&queue->table_mutex);
+  queue->table->queue = NULL;
+  pthread_mutex_unlock(&queue->table_mutex);
+
+  pthread_cond_destroy(&queue->work);
+  pthread_cond_destroy(&queue->progress);
+  pthread_mutex_destroy(&queue->table_mutex);
+  pthread_mutex_destroy(&queue->mutex);
+
+  HDfree(queue->slots);
+  HDfree(queue->seq);
+  HDfree(queue->batch);
+  HDfree(queue);
+
+  return ret_value;
+}
+#endif /* H5_HAVE_PACKET_TABLE_QUEUE */
+
 /*-------------------------------------------------------------------------
  *
  * Read functions
@@ -688,9 +1359,16 @@ herr_t H5PTget_next(hid_t table_id,
   if(nrecords == 0)
     return 0;
 
-  if((H5TB_common_read_records(table->dset_id, table->type_id,
-                              table->current_index, nrecords, table->size, data)) < 0)
+  /* Buffered packets must be in the dataset to be read */
+  H5PT_lock_table(table);
+  if(H5PT_flush_buffer(table) < 0 ||
+          H5TB_common_read_records(table->dset_id, table->type_id,
+                              table->current_index, nrecords, table->size, data) < 0)
+  {
+    H5PT_unlock_table(table);
     goto out;
+  }
+  H5PT_unlock_table(table);
 
   /* Update the current index */
   table->current_index += nrecords;
@@ -735,9 +1413,16 @@ herr_t H5PTread_packets(hid_t table_id,
   if(nrecords == 0)
     return 0;
 
-  if(H5TB_common_read_records(table->dset_id, table->type_id,
+  /* Buffered packets must be in the dataset to be read */
+  H5PT_lock_table(table);
+  if(H5PT_flush_buffer(table) < 0 ||
+          H5TB_common_read_records(table->dset_id, table->type_id,
                               start, nrecords, table->size, data) < 0)
+  {
+    H5PT_unlock_table(table);
     goto out;
+  }
+  H5PT_unlock_table(table);
 
   return 0;
 
@@ -895,7 +1580,11 @@ herr_t H5PTget_num_packets(hid_t table_id, hsize_t *nrecords)
     goto out;
 
   if(nrecords)
+  {
+    H5PT_lock_table(table);
     *nrecords = table->size;
+    H5PT_unlock_table(table);
+  }
 
   return 0;
 out:
@@ -73,6 +73,31 @@ H5_HLDLL herr_t  H5PTappend( hid_t table_id,
                    size_t nrecords,
                    const void * data );
 
+H5_HLDLL herr_t  H5PTflush( hid_t table_id );
+
+/*-------------------------------------------------------------------------
+ *
+ * Packet queue functions (where configure finds Pthreads and atomic
+ * builtins)
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#ifdef H5_HAVE_PACKET_TABLE_QUEUE
+typedef struct H5PT_queue_t H5PT_queue_t;
+
+H5_HLDLL H5PT_queue_t *H5PTcreate_queue( hid_t table_id,
+                   size_t queue_size );
+
+H5_HLDLL herr_t  H5PTenqueue( H5PT_queue_t *queue,
+                   size_t nrecords,
+                   const void *data );
+
+H5_HLDLL herr_t  H5PTfence( H5PT_queue_t *queue );
+
+H5_HLDLL herr_t  H5PTclose_queue( H5PT_queue_t *queue );
+#endif
+
 /*-------------------------------------------------------------------------
  *
  * Read functions
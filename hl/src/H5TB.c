@@ -43,6 +43,12 @@ static hid_t H5TB_create_type(hid_t loc_id,
                               const size_t *field_sizes,
                               hid_t ftype_id);
 
+static void H5TB_gather_column(unsigned char *dst,
+                               const unsigned char *src,
+                               size_t src_stride,
+                               size_t size,
+                               size_t nrecords);
+
 /*-------------------------------------------------------------------------
 *
 * Create functions
@@ -1238,6 +1244,243 @@ out:
     return ret_val;
 } /* end H5TBread_fields_index() */
 
+/*-------------------------------------------------------------------------
+* Function: H5TBread_columns
+*
+* Purpose: Reads a set of fields for a range of records into separate,
+*          contiguous per-field arrays
+*
+* Return: Success: 0, Failure: -1
+*
+* Comments: BUFS[i] receives NRECORDS values of field FIELD_INDEX[i], each
+*           FIELD_SIZES[i] bytes of the field's native type.  Only the
+*           requested members are converted: the records are read in
+*           chunk-aligned batches through a packed compound type holding
+*           just those fields, so each chunk is visited once no matter how
+*           many columns are requested, and each batch is then split into
+*           the column arrays.  A single column is read straight into its
+*           array.
+*
+*-------------------------------------------------------------------------
+*/
+herr_t H5TBread_columns(hid_t loc_id,
+                        const char *dset_name,
+                        hsize_t nfields,
+                        const int *field_index,
+                        hsize_t start,
+                        hsize_t nrecords,
+                        const size_t *field_sizes,
+                        void *bufs[])
+{
+    hid_t    did = H5I_BADID;
+    hid_t    tid = H5I_BADID;
+    hid_t    read_type_id = H5I_BADID;
+    hid_t    member_type_id = H5I_BADID;
+    hid_t    nmtype_id = H5I_BADID;
+    hid_t    sid = H5I_BADID;
+    hid_t    m_sid = H5I_BADID;
+    hid_t    plist_id = H5I_BADID;
+    hsize_t  count[1];
+    hsize_t  offset[1];
+    hsize_t  mem_offset[1];
+    hsize_t  dims_chunk[1];
+    hsize_t  batch;
+    hsize_t  done;
+    hsize_t  i;
+    size_t   size_native;
+    size_t   type_size = 0;
+    size_t  *packed_offset = NULL;
+    unsigned char *tmp_buf = NULL;
+    char    *member_name = NULL;
+    herr_t   ret_val = -1;
+
+    /* check the arguments */
+    if(dset_name == NULL || field_index == NULL || field_sizes == NULL || bufs == NULL)
+        goto out;
+    if(nfields == 0)
+        goto out;
+
+    /* nothing to read */
+    if(nrecords == 0)
+        return 0;
+
+    if(NULL == (packed_offset = (size_t *)HDmalloc((size_t)nfields * sizeof(size_t))))
+        goto out;
+
+    /* the requested fields are packed back to back in the read type */
+    for(i = 0; i < nfields; i++) {
+        if(bufs[i] == NULL || field_sizes[i] == 0)
+            goto out;
+        packed_offset[i] = type_size;
+        type_size += field_sizes[i];
+    } /* end for */
+
+    /* open the dataset. */
+    if((did = H5Dopen2(loc_id, dset_name, H5P_DEFAULT)) < 0)
+        goto out;
+
+    /* get the datatype */
+    if((tid = H5Dget_type(did)) < 0)
+        goto out;
+
+    /* create a read id */
+    if((read_type_id = H5Tcreate(H5T_COMPOUND, type_size)) < 0)
+        goto out;
+
+    /* iterate tru the members */
+    for(i = 0; i < nfields; i++) {
+        unsigned  j;
+
+        /* Range check */
+        if(field_index[i] < 0)
+            goto out;
+
+        j = (unsigned)field_index[i];
+
+        /* get the member name */
+        if(NULL == (member_name = H5Tget_member_name(tid, j)))
+            goto out;
+
+        /* get the member type */
+        if((member_type_id = H5Tget_member_type(tid, j)) < 0)
+            goto out;
+
+        /* convert to native type */
+        if((nmtype_id = H5Tget_native_type(member_type_id, H5T_DIR_DEFAULT)) < 0)
+            goto out;
+
+        if(0 == (size_native = H5Tget_size(nmtype_id)))
+            goto out;
+
+        if(field_sizes[i] != size_native)
+            if(H5Tset_size(nmtype_id, field_sizes[i]) < 0)
+                goto out;
+
+        /* the field in the file is found by its name */
+        if(H5Tinsert(read_type_id, member_name, packed_offset[i], nmtype_id) < 0)
+            goto out;
+
+        /* close the member type */
+        if(H5Tclose(member_type_id) < 0)
+            goto out;
+        member_type_id = H5I_BADID;
+        if(H5Tclose(nmtype_id) < 0)
+            goto out;
+        nmtype_id = H5I_BADID;
+
+        H5free_memory(member_name);
+        member_name = NULL;
+    } /* end for */
+
+    /* get the dataspace handle */
+    if((sid = H5Dget_space(did)) < 0)
+        goto out;
+
+    /* a single column needs no splitting: read it in place */
+    if(nfields == 1) {
+        offset[0] = start;
+        count[0]  = nrecords;
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, offset, NULL, count, NULL) < 0)
+            goto out;
+        if((m_sid = H5Screate_simple(1, count, NULL)) < 0)
+            goto out;
+        if(H5Dread(did, read_type_id, m_sid, sid, H5P_DEFAULT, bufs[0]) < 0)
+            goto out;
+
+        ret_val = 0;
+        goto out;
+    } /* end if */
+
+    /* size the batches in whole chunks, about HLTB_COLUMN_BATCH_SIZE bytes each */
+    if((plist_id = H5Dget_create_plist(did)) < 0)
+        goto out;
+    dims_chunk[0] = 0;
+    if(H5D_CHUNKED == H5Pget_layout(plist_id))
+        if(H5Pget_chunk(plist_id, 1, dims_chunk) < 0)
+            goto out;
+    batch = (hsize_t)(HLTB_COLUMN_BATCH_SIZE / type_size);
+    if(dims_chunk[0] > 0) {
+        batch -= batch % dims_chunk[0];
+        if(batch == 0)
+            batch = dims_chunk[0];
+    } /* end if */
+    else if(batch == 0)
+        batch = 1;
+    if(batch > nrecords)
+        batch = nrecords;
+
+    if(NULL == (tmp_buf = (unsigned char *)HDmalloc((size_t)batch * type_size)))
+        goto out;
+    if((m_sid = H5Screate_simple(1, &batch, NULL)) < 0)
+        goto out;
+
+    for(done = 0; done < nrecords; done += count[0]) {
+        offset[0] = start + done;
+        count[0]  = nrecords - done;
+
+        /* end the first batch on a chunk boundary so later ones stay aligned */
+        if(dims_chunk[0] > 0 && done == 0 && (offset[0] % dims_chunk[0]) != 0) {
+            hsize_t to_boundary = dims_chunk[0] - (offset[0] % dims_chunk[0]);
+
+            if(count[0] > to_boundary)
+                count[0] = to_boundary;
+        } /* end if */
+        if(count[0] > batch)
+            count[0] = batch;
+
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, offset, NULL, count, NULL) < 0)
+            goto out;
+        mem_offset[0] = 0;
+        if(H5Sselect_hyperslab(m_sid, H5S_SELECT_SET, mem_offset, NULL, count, NULL) < 0)
+            goto out;
+
+        if(H5Dread(did, read_type_id, m_sid, sid, H5P_DEFAULT, tmp_buf) < 0)
+            goto out;
+
+        /* split the packed records into the column arrays */
+        for(i = 0; i < nfields; i++)
+            H5TB_gather_column((unsigned char *)bufs[i] + (size_t)done * field_sizes[i],
+                               tmp_buf + packed_offset[i], type_size, field_sizes[i],
+                               (size_t)count[0]);
+    } /* end for */
+
+    ret_val = 0;
+
+out:
+    if(tmp_buf)
+        HDfree(tmp_buf);
+    if(packed_offset)
+        HDfree(packed_offset);
+    if(member_name)
+        H5free_memory(member_name);
+    if(read_type_id > 0)
+        if(H5Tclose(read_type_id) < 0)
+            ret_val = -1;
+    if(member_type_id > 0)
+        if(H5Tclose(member_type_id) < 0)
+            ret_val = -1;
+    if(nmtype_id > 0)
+        if(H5Tclose(nmtype_id) < 0)
+            ret_val = -1;
+    if(tid > 0)
+        if(H5Tclose(tid) < 0)
+            ret_val = -1;
+    if(plist_id > 0)
+        if(H5Pclose(plist_id) < 0)
+            ret_val = -1;
+    if(m_sid > 0)
+        if(H5Sclose(m_sid) < 0)
+            ret_val = -1;
+    if(sid > 0)
+        if(H5Sclose(sid) < 0)
+            ret_val = -1;
+    if(did > 0)
+        if(H5Dclose(did) < 0)
+            ret_val = -1;
+
+    return ret_val;
+} /* end H5TBread_columns() */
+
 
 /*-------------------------------------------------------------------------
 *
@@ -3571,3 +3814,57 @@ out:
     return ret_val;
 } /* end H5TB_common_read_records() */
 
+/*-------------------------------------------------------------------------
+* Function: H5TB_gather_column
+*
+* Purpose: Copies one field out of NRECORDS packed records (SRC_STRIDE
+*          bytes apart) into a contiguous array
+*
+* Return: void
+*
+* Comments: The common native sizes get a fixed-size copy the compiler
+*           turns into a single load and store.
+*
+*-------------------------------------------------------------------------
+*/
+static
+void H5TB_gather_column(unsigned char *dst,
+                        const unsigned char *src,
+                        size_t src_stride,
+                        size_t size,
+                        size_t nrecords)
+{
+    size_t u;
+
+    switch(size) {
+        case 1:
+            for(u = 0; u < nrecords; u++, src += src_stride)
+                *dst++ = *src;
+            break;
+
+        case 2:
+            for(u = 0; u < nrecords; u++, src += src_stride, dst += 2)
+                HDmemcpy(dst, src, (size_t)2);
+            break;
+
+        case 4:
+            for(u = 0; u < nrecords; u++, src += src_stride, dst += 4)
+                HDmemcpy(dst, src, (size_t)4);
+            break;
+
+        case 8:
+            for(u = 0; u < nrecords; u++, src += src_stride, dst += 8)
+                HDmemcpy(dst, src, (size_t)8);
+            break;
+
+        case 16:
+            for(u = 0; u < nrecords; u++, src += src_stride, dst += 16)
+                HDmemcpy(dst, src, (size_t)16);
+            break;
+
+        default:
+            for(u = 0; u < nrecords; u++, src += src_stride, dst += size)
+                HDmemcpy(dst, src, size);
+            break;
+    } /* end switch */
+} /* end H5TB_gather_column() */
@@ -26,6 +26,7 @@
 #define TABLE_CLASS         "TABLE"
 #define TABLE_VERSION       "3.0"
 #define HLTB_MAX_FIELD_LEN  255
+#define HLTB_COLUMN_BATCH_SIZE  (1024 * 1024)
 
 /*-------------------------------------------------------------------------
  *
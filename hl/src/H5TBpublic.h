@@ -129,6 +129,15 @@ H5_HLDLL herr_t  H5TBread_fields_index( hid_t loc_id,
                               const size_t *dst_sizes,
                               void *buf );
 
+H5_HLDLL herr_t  H5TBread_columns( hid_t loc_id,
+                              const char *dset_name,
+                              hsize_t nfields,
+                              const int *field_index,
+                              hsize_t start,
+                              hsize_t nrecords,
+                              const size_t *field_sizes,
+                              void *bufs[] );
+
 
 H5_HLDLL herr_t  H5TBread_records( hid_t loc_id,
                          const char *dset_name,
@@ -49,6 +49,7 @@ add_test (
         test_ds9.h5
         test_ds10.h5
         test_dectris.h5
+        test_dectris_align.h5
         test_image1.h5
         test_image2.h5
         test_image3.h5
@@ -28,6 +28,7 @@
 #endif
 
 #define FILE_NAME "test_dectris.h5"
+#define ALIGN_FILE_NAME "test_dectris_align.h5"
 
 #define DATASETNAME1        "direct_write"
 #define DATASETNAME2        "skip_one_filter"
@@ -35,12 +36,17 @@
 #define DATASETNAME4        "data_conv"
 #define DATASETNAME5        "contiguous_dset"
 #define DATASETNAME6        "invalid_argue"
+#define DATASETNAME7        "direct_read"
+#define DATASETNAME8        "direct_write_multi"
+#define DATASETNAME9        "direct_write_multi_deflate"
 #define RANK         2
 #define NX     16
 #define NY     16
 #define CHUNK_NX     4
 #define CHUNK_NY     4
 
+#define CHUNK_ALIGN  512
+
 #define DEFLATE_SIZE_ADJUST(s) (ceil(((double)(s))*1.001F)+12)
 
 /* Temporary filter IDs used for testing */
@@ -335,6 +341,628 @@ error:
 }
 #endif /* H5_HAVE_FILTER_DEFLATE */
 
+/*-------------------------------------------------------------------------
+ * Function:	test_direct_chunk_read
+ *
+ * Purpose:	Test reading chunks as they are stored with H5DOread_chunk,
+ *              and querying them with H5Dget_chunk_storage_size and
+ *              H5Dget_chunk_info_by_coord
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifdef H5_HAVE_FILTER_DEFLATE
+static int
+test_direct_chunk_read(hid_t file)
+{
+    hid_t       dataspace = -1, dataset = -1;
+    hid_t       cparms = -1, dxpl = -1;
+    hsize_t     dims[2]  = {NX, NY};
+    hsize_t     new_dims[2]  = {NX + CHUNK_NX, NY};
+    hsize_t     maxdims[2] = {H5S_UNLIMITED, H5S_UNLIMITED};
+    hsize_t     chunk_dims[2] = {CHUNK_NX, CHUNK_NY};
+    herr_t      status;
+    int         data[NX][NY];
+    int         i, j, n;
+
+    uint32_t    filter_mask = 0;
+    unsigned    info_mask;
+    haddr_t     chunk_addr;
+    hsize_t     chunk_nbytes, info_nbytes;
+    int         direct_buf[CHUNK_NX][CHUNK_NY];
+    int         check_chunk[CHUNK_NX][CHUNK_NY];
+    hsize_t     offset[2] = {CHUNK_NX, CHUNK_NY};
+    size_t      buf_size = CHUNK_NX*CHUNK_NY*sizeof(int);
+    int         aggression = 9;     /* Compression aggression setting */
+    void        *readbuf = NULL;    /* Buffer for the chunk as stored */
+    uLongf      z_dst_nbytes = (uLongf)buf_size;
+
+    TESTING("basic functionality of H5DOread_chunk");
+
+    if((dataspace = H5Screate_simple(RANK, dims, maxdims)) < 0)
+        goto error;
+
+    if((cparms = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if((status = H5Pset_chunk(cparms, RANK, chunk_dims)) < 0)
+        goto error;
+    if((status = H5Pset_deflate(cparms, (unsigned) aggression)) < 0)
+        goto error;
+
+    if((dataset = H5Dcreate2(file, DATASETNAME7, H5T_NATIVE_INT, dataspace, H5P_DEFAULT,
+			cparms, H5P_DEFAULT)) < 0)
+        goto error;
+
+    for(i = n = 0; i < NX; i++)
+        for(j = 0; j < NY; j++)
+	    data[i][j] = n++;
+
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        goto error;
+
+    /*
+     * Write the data for the dataset.  It stays in the chunk cache, and is
+     * written to the file when a chunk is queried or read directly.
+     */
+    if((status = H5Dwrite(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL,
+		      dxpl, data)) < 0)
+        goto error;
+
+    /* Query the chunk at (CHUNK_NX, CHUNK_NY) */
+    if(H5Dget_chunk_storage_size(dataset, offset, &chunk_nbytes) < 0)
+        goto error;
+    if(chunk_nbytes == 0 || chunk_nbytes >= buf_size)
+        goto error;
+    if(H5Dget_chunk_info_by_coord(dataset, offset, &info_mask, &chunk_addr, &info_nbytes) < 0)
+        goto error;
+    if(info_mask != 0 || HADDR_UNDEF == chunk_addr || info_nbytes != chunk_nbytes)
+        goto error;
+
+    /* Read the compressed chunk and inflate it */
+    if(NULL == (readbuf = HDmalloc((size_t)chunk_nbytes)))
+        goto error;
+    filter_mask = 0xffffffff;
+    if(H5DOread_chunk(dataset, dxpl, offset, &filter_mask, (size_t)chunk_nbytes, readbuf) < 0)
+        goto error;
+    if(filter_mask != 0)
+        goto error;
+    if(Z_OK != uncompress((Bytef *)check_chunk, &z_dst_nbytes, (const Bytef *)readbuf, (uLong)chunk_nbytes))
+        goto error;
+    if(z_dst_nbytes != buf_size)
+        goto error;
+    for(i = 0; i < CHUNK_NX; i++)
+        for(j = 0; j < CHUNK_NY; j++)
+            if(check_chunk[i][j] != data[CHUNK_NX + i][CHUNK_NY + j]) {
+                printf("    1. Read different values than written.");
+                printf("    At index %d,%d\n", i, j);
+                goto error;
+            }
+
+    /* A buffer smaller than the stored chunk is rejected and left alone */
+    HDmemset(readbuf, 0, (size_t)chunk_nbytes);
+    H5E_BEGIN_TRY {
+        status = H5DOread_chunk(dataset, dxpl, offset, &filter_mask, (size_t)chunk_nbytes - 1, readbuf);
+    } H5E_END_TRY;
+    if(status >= 0)
+        goto error;
+    for(i = 0; i < (int)chunk_nbytes; i++)
+        if(((unsigned char *)readbuf)[i] != 0)
+            goto error;
+    HDfree(readbuf);
+    readbuf = NULL;
+
+    /* Write a chunk without the compression filter and read it back */
+    for(i = n = 0; i < CHUNK_NX; i++)
+        for(j = 0; j < CHUNK_NY; j++)
+	    direct_buf[i][j] = n++;
+    filter_mask = 0x00000001;
+    if(H5DOwrite_chunk(dataset, dxpl, filter_mask, offset, buf_size, direct_buf) < 0)
+        goto error;
+    if(H5Dget_chunk_storage_size(dataset, offset, &chunk_nbytes) < 0)
+        goto error;
+    if(chunk_nbytes != buf_size)
+        goto error;
+    filter_mask = 0;
+    if(H5DOread_chunk(dataset, H5P_DEFAULT, offset, &filter_mask, sizeof(check_chunk), check_chunk) < 0)
+        goto error;
+    if(filter_mask != 0x00000001)
+        goto error;
+    if(HDmemcmp(direct_buf, check_chunk, buf_size))
+        goto error;
+
+    /* The DXPL can still be used for normal reads */
+    if((status = H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, data)) < 0)
+        goto error;
+    if(data[CHUNK_NX + 1][CHUNK_NY + 1] != direct_buf[1][1])
+        goto error;
+
+    /* Chunks added by extending the dataset aren't allocated */
+    if(H5Dset_extent(dataset, new_dims) < 0)
+        goto error;
+    offset[0] = NX;
+    offset[1] = 0;
+    if(H5Dget_chunk_info_by_coord(dataset, offset, &info_mask, &chunk_addr, &info_nbytes) < 0)
+        goto error;
+    if(HADDR_UNDEF != chunk_addr || info_nbytes != 0)
+        goto error;
+    H5E_BEGIN_TRY {
+        status = H5DOread_chunk(dataset, dxpl, offset, &filter_mask, sizeof(check_chunk), check_chunk);
+    } H5E_END_TRY;
+    if(status >= 0)
+        goto error;
+
+    /* The offset must fall on a chunk boundary inside the dataset */
+    offset[0] = 1;
+    H5E_BEGIN_TRY {
+        status = H5Dget_chunk_storage_size(dataset, offset, &chunk_nbytes);
+    } H5E_END_TRY;
+    if(status >= 0)
+        goto error;
+    offset[0] = NX + CHUNK_NX;
+    H5E_BEGIN_TRY {
+        status = H5DOread_chunk(dataset, dxpl, offset, &filter_mask, sizeof(check_chunk), check_chunk);
+    } H5E_END_TRY;
+    if(status >= 0)
+        goto error;
+
+    H5Dclose(dataset);
+    H5Sclose(dataspace);
+    H5Pclose(cparms);
+    H5Pclose(dxpl);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dataset);
+        H5Sclose(dataspace);
+        H5Pclose(cparms);
+        H5Pclose(dxpl);
+    } H5E_END_TRY;
+
+    if(readbuf)
+        HDfree(readbuf);
+
+    return 1;
+}
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
+/*-------------------------------------------------------------------------
+ * Function:	test_direct_chunk_write_multi
+ *
+ * Purpose:	Test writing many chunks at once with H5DOwrite_chunks
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_direct_chunk_write_multi(hid_t file)
+{
+    hid_t       dataspace = -1, dataset = -1;
+    hid_t       cparms = -1, dxpl = -1;
+    hsize_t     dims[2]  = {NX, NY};
+    hsize_t     chunk_dims[2] = {CHUNK_NX, CHUNK_NY};
+    herr_t      status;
+    int         data[NX][NY], check[NX][NY];
+    int         chunks[(NX/CHUNK_NX)*(NY/CHUNK_NY)][CHUNK_NX][CHUNK_NY];
+    hsize_t     offsets[(NX/CHUNK_NX)*(NY/CHUNK_NY)][2];
+    const hsize_t *offset_list[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    uint32_t    filter_list[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    size_t      size_list[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    const void  *buf_list[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    size_t      nchunks = (NX/CHUNK_NX)*(NY/CHUNK_NY);
+    size_t      buf_size = CHUNK_NX*CHUNK_NY*sizeof(int);
+    unsigned    info_mask;
+    haddr_t     chunk_addr, prev_addr = HADDR_UNDEF;
+    hsize_t     info_nbytes;
+    size_t      u;
+    int         i, j;
+
+    TESTING("writing many chunks with H5DOwrite_chunks");
+
+    if((dataspace = H5Screate_simple(RANK, dims, NULL)) < 0)
+        goto error;
+
+    if((cparms = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if((status = H5Pset_chunk(cparms, RANK, chunk_dims)) < 0)
+        goto error;
+
+    if((dataset = H5Dcreate2(file, DATASETNAME8, H5T_NATIVE_INT, dataspace, H5P_DEFAULT,
+			cparms, H5P_DEFAULT)) < 0)
+        goto error;
+
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        goto error;
+
+    /*
+     * Describe every chunk in the dataset, listed in reverse order so the
+     * library has to sort them.  Each chunk holds its own index.
+     */
+    for(u = 0; u < nchunks; u++) {
+        size_t n = nchunks - 1 - u;
+
+        offsets[u][0] = (hsize_t)((n / (NY / CHUNK_NY)) * CHUNK_NX);
+        offsets[u][1] = (hsize_t)((n % (NY / CHUNK_NY)) * CHUNK_NY);
+        for(i = 0; i < CHUNK_NX; i++)
+            for(j = 0; j < CHUNK_NY; j++)
+                chunks[u][i][j] = (int)(n * 100) + i * CHUNK_NY + j;
+        offset_list[u] = offsets[u];
+        filter_list[u] = 0;
+        size_list[u] = buf_size;
+        buf_list[u] = chunks[u];
+    } /* end for */
+
+    /* Write the last chunk by itself first, so one chunk is rewritten */
+    if(H5DOwrite_chunk(dataset, dxpl, 0, offsets[0], buf_size, chunks[0]) < 0)
+        goto error;
+
+    /* Write all the chunks at once */
+    if(H5DOwrite_chunks(dataset, dxpl, nchunks, filter_list, offset_list,
+            size_list, buf_list) < 0)
+        goto error;
+
+    /* Read the data back and check it */
+    if((status = H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, data)) < 0)
+        goto error;
+    for(u = 0; u < nchunks; u++)
+        for(i = 0; i < CHUNK_NX; i++)
+            for(j = 0; j < CHUNK_NY; j++)
+                if(data[offsets[u][0] + (hsize_t)i][offsets[u][1] + (hsize_t)j] != chunks[u][i][j]) {
+                    printf("    1. Read different values than written.");
+                    printf("    At chunk %lu, index %d,%d\n", (unsigned long)u, i, j);
+                    goto error;
+                }
+
+    /* The chunks that were new are stored back to back, in index order */
+    for(u = nchunks - 1; u > 0; u--) {
+        if(H5Dget_chunk_info_by_coord(dataset, offsets[u], &info_mask, &chunk_addr, &info_nbytes) < 0)
+            goto error;
+        if(info_mask != 0 || info_nbytes != buf_size)
+            goto error;
+        if(u < nchunks - 1 && chunk_addr != prev_addr + buf_size)
+            goto error;
+        prev_addr = chunk_addr;
+    } /* end for */
+
+    /*
+     * A chunk may not be listed twice.  The batch is rejected before any
+     * chunk is written, so changed data must not reach the file.
+     */
+    for(u = 0; u < nchunks; u++)
+        for(i = 0; i < CHUNK_NX; i++)
+            for(j = 0; j < CHUNK_NY; j++)
+                chunks[u][i][j] = -chunks[u][i][j] - 1;
+    offset_list[1] = offsets[0];
+    H5E_BEGIN_TRY {
+        status = H5DOwrite_chunks(dataset, dxpl, nchunks, filter_list, offset_list,
+                size_list, buf_list);
+    } H5E_END_TRY;
+    if(status >= 0)
+        goto error;
+    offset_list[1] = offsets[1];
+
+    /* Without filters, every chunk must be written at its full size */
+    size_list[nchunks - 1] = buf_size - 1;
+    H5E_BEGIN_TRY {
+        status = H5DOwrite_chunks(dataset, dxpl, nchunks, filter_list, offset_list,
+                size_list, buf_list);
+    } H5E_END_TRY;
+    if(status >= 0)
+        goto error;
+    H5E_BEGIN_TRY {
+        status = H5DOwrite_chunk(dataset, dxpl, 0, offsets[0], buf_size - 1, chunks[0]);
+    } H5E_END_TRY;
+    if(status >= 0)
+        goto error;
+    size_list[nchunks - 1] = buf_size;
+
+    /* None of the rejected writes changed the dataset */
+    if((status = H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, check)) < 0)
+        goto error;
+    if(HDmemcmp(data, check, sizeof(data)))
+        goto error;
+
+    /* Every offset must fall on a chunk boundary inside the dataset */
+    offsets[1][1]++;
+    H5E_BEGIN_TRY {
+        status = H5DOwrite_chunks(dataset, dxpl, nchunks, filter_list, offset_list,
+                size_list, buf_list);
+    } H5E_END_TRY;
+    if(status >= 0)
+        goto error;
+    offsets[1][1]--;
+
+    /* The DXPL can still be used for normal writes */
+    if((status = H5Dwrite(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, data)) < 0)
+        goto error;
+
+    H5Dclose(dataset);
+    H5Sclose(dataspace);
+    H5Pclose(cparms);
+    H5Pclose(dxpl);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dataset);
+        H5Sclose(dataspace);
+        H5Pclose(cparms);
+        H5Pclose(dxpl);
+    } H5E_END_TRY;
+
+    return 1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:	test_direct_chunk_write_multi_align
+ *
+ * Purpose:	Test that H5DOwrite_chunks keeps every new chunk aligned
+ *              in a file whose allocations are aligned
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_direct_chunk_write_multi_align(void)
+{
+    hid_t       file = -1, fapl = -1;
+    hid_t       dataspace = -1, dataset = -1;
+    hid_t       cparms = -1;
+    hsize_t     dims[2]  = {NX, NY};
+    hsize_t     chunk_dims[2] = {CHUNK_NX, CHUNK_NY};
+    herr_t      status;
+    int         data[NX][NY];
+    int         chunks[(NX/CHUNK_NX)*(NY/CHUNK_NY)][CHUNK_NX][CHUNK_NY];
+    hsize_t     offsets[(NX/CHUNK_NX)*(NY/CHUNK_NY)][2];
+    const hsize_t *offset_list[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    uint32_t    filter_list[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    size_t      size_list[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    const void  *buf_list[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    size_t      nchunks = (NX/CHUNK_NX)*(NY/CHUNK_NY);
+    size_t      buf_size = CHUNK_NX*CHUNK_NY*sizeof(int);
+    unsigned    info_mask;
+    haddr_t     chunk_addr;
+    hsize_t     info_nbytes;
+    size_t      u;
+    int         i, j;
+
+    TESTING("writing many aligned chunks with H5DOwrite_chunks");
+
+    /* Align every allocation */
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto error;
+    if(H5Pset_alignment(fapl, (hsize_t)1, (hsize_t)CHUNK_ALIGN) < 0)
+        goto error;
+    if((file = H5Fcreate(ALIGN_FILE_NAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+
+    if((dataspace = H5Screate_simple(RANK, dims, NULL)) < 0)
+        goto error;
+
+    if((cparms = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if((status = H5Pset_chunk(cparms, RANK, chunk_dims)) < 0)
+        goto error;
+
+    if((dataset = H5Dcreate2(file, DATASETNAME8, H5T_NATIVE_INT, dataspace, H5P_DEFAULT,
+			cparms, H5P_DEFAULT)) < 0)
+        goto error;
+
+    for(u = 0; u < nchunks; u++) {
+        offsets[u][0] = (hsize_t)((u / (NY / CHUNK_NY)) * CHUNK_NX);
+        offsets[u][1] = (hsize_t)((u % (NY / CHUNK_NY)) * CHUNK_NY);
+        for(i = 0; i < CHUNK_NX; i++)
+            for(j = 0; j < CHUNK_NY; j++)
+                chunks[u][i][j] = (int)(u * 100) + i * CHUNK_NY + j;
+        offset_list[u] = offsets[u];
+        filter_list[u] = 0;
+        size_list[u] = buf_size;
+        buf_list[u] = chunks[u];
+    } /* end for */
+
+    if(H5DOwrite_chunks(dataset, H5P_DEFAULT, nchunks, filter_list, offset_list,
+            size_list, buf_list) < 0)
+        goto error;
+
+    /* Every chunk is aligned */
+    for(u = 0; u < nchunks; u++) {
+        if(H5Dget_chunk_info_by_coord(dataset, offsets[u], &info_mask, &chunk_addr, &info_nbytes) < 0)
+            goto error;
+        if(info_nbytes != buf_size || 0 != chunk_addr % CHUNK_ALIGN)
+            goto error;
+    } /* end for */
+
+    /* Read the data back and check it */
+    if((status = H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data)) < 0)
+        goto error;
+    for(u = 0; u < nchunks; u++)
+        for(i = 0; i < CHUNK_NX; i++)
+            for(j = 0; j < CHUNK_NY; j++)
+                if(data[offsets[u][0] + (hsize_t)i][offsets[u][1] + (hsize_t)j] != chunks[u][i][j]) {
+                    printf("    1. Read different values than written.");
+                    printf("    At chunk %lu, index %d,%d\n", (unsigned long)u, i, j);
+                    goto error;
+                }
+
+    H5Dclose(dataset);
+    H5Sclose(dataspace);
+    H5Pclose(cparms);
+    H5Fclose(file);
+    H5Pclose(fapl);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dataset);
+        H5Sclose(dataspace);
+        H5Pclose(cparms);
+        H5Fclose(file);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+
+    return 1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:	test_direct_chunk_write_multi_deflate
+ *
+ * Purpose:	Test writing many compressed chunks of different sizes at
+ *              once with H5DOwrite_chunks
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifdef H5_HAVE_FILTER_DEFLATE
+static int
+test_direct_chunk_write_multi_deflate(hid_t file)
+{
+    hid_t       dataspace = -1, dataset = -1;
+    hid_t       cparms = -1, dxpl = -1;
+    hsize_t     dims[2]  = {NX, NY};
+    hsize_t     chunk_dims[2] = {CHUNK_NX, CHUNK_NY};
+    herr_t      status;
+    int         ret;
+    int         data[NX][NY];
+    int         chunks[(NX/CHUNK_NX)*(NY/CHUNK_NY)][CHUNK_NX][CHUNK_NY];
+    hsize_t     offsets[(NX/CHUNK_NX)*(NY/CHUNK_NY)][2];
+    const hsize_t *offset_list[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    uint32_t    filter_list[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    size_t      size_list[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    const void  *buf_list[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    void        *outbuf[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    size_t      nchunks = (NX/CHUNK_NX)*(NY/CHUNK_NY);
+    size_t      buf_size = CHUNK_NX*CHUNK_NY*sizeof(int);
+    int         aggression = 9;     /* Compression aggression setting */
+    unsigned    info_mask;
+    haddr_t     chunk_addr;
+    hsize_t     info_nbytes;
+    size_t      u;
+    int         i, j;
+
+    TESTING("writing many compressed chunks with H5DOwrite_chunks");
+
+    for(u = 0; u < nchunks; u++)
+        outbuf[u] = NULL;
+
+    if((dataspace = H5Screate_simple(RANK, dims, NULL)) < 0)
+        goto error;
+
+    if((cparms = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if((status = H5Pset_chunk(cparms, RANK, chunk_dims)) < 0)
+        goto error;
+    if((status = H5Pset_deflate(cparms, (unsigned)aggression)) < 0)
+        goto error;
+
+    if((dataset = H5Dcreate2(file, DATASETNAME9, H5T_NATIVE_INT, dataspace, H5P_DEFAULT,
+			cparms, H5P_DEFAULT)) < 0)
+        goto error;
+
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        goto error;
+
+    /*
+     * Compress every chunk, listed in reverse order.  The first chunk is
+     * constant and the rest hold their own index, so the compressed sizes
+     * differ.
+     */
+    for(u = 0; u < nchunks; u++) {
+        size_t n = nchunks - 1 - u;
+        uLongf z_dst_nbytes = (uLongf)DEFLATE_SIZE_ADJUST(buf_size);
+
+        offsets[u][0] = (hsize_t)((n / (NY / CHUNK_NY)) * CHUNK_NX);
+        offsets[u][1] = (hsize_t)((n % (NY / CHUNK_NY)) * CHUNK_NY);
+        for(i = 0; i < CHUNK_NX; i++)
+            for(j = 0; j < CHUNK_NY; j++)
+                chunks[u][i][j] = n ? (int)(n * 100) + i * CHUNK_NY + j : 7;
+
+        if(NULL == (outbuf[u] = HDmalloc((size_t)z_dst_nbytes)))
+            goto error;
+        ret = compress2((Bytef *)outbuf[u], &z_dst_nbytes, (const Bytef *)chunks[u],
+                (uLong)buf_size, aggression);
+        if(Z_OK != ret) {
+            fprintf(stderr, "other deflate error");
+            goto error;
+        }
+
+        offset_list[u] = offsets[u];
+        filter_list[u] = 0;
+        size_list[u] = (size_t)z_dst_nbytes;
+        buf_list[u] = outbuf[u];
+    } /* end for */
+    if(size_list[0] == size_list[nchunks - 1])
+        goto error;
+
+    /* Write all the chunks at once */
+    if(H5DOwrite_chunks(dataset, dxpl, nchunks, filter_list, offset_list,
+            size_list, buf_list) < 0)
+        goto error;
+
+    /* Each chunk is stored at its compressed size */
+    for(u = 0; u < nchunks; u++) {
+        if(H5Dget_chunk_info_by_coord(dataset, offsets[u], &info_mask, &chunk_addr, &info_nbytes) < 0)
+            goto error;
+        if(info_mask != 0 || info_nbytes != (hsize_t)size_list[u])
+            goto error;
+    } /* end for */
+
+    /* Read the data back through the filter and check it */
+    if((status = H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, data)) < 0)
+        goto error;
+    for(u = 0; u < nchunks; u++)
+        for(i = 0; i < CHUNK_NX; i++)
+            for(j = 0; j < CHUNK_NY; j++)
+                if(data[offsets[u][0] + (hsize_t)i][offsets[u][1] + (hsize_t)j] != chunks[u][i][j]) {
+                    printf("    1. Read different values than written.");
+                    printf("    At chunk %lu, index %d,%d\n", (unsigned long)u, i, j);
+                    goto error;
+                }
+
+    for(u = 0; u < nchunks; u++)
+        HDfree(outbuf[u]);
+
+    H5Dclose(dataset);
+    H5Sclose(dataspace);
+    H5Pclose(cparms);
+    H5Pclose(dxpl);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dataset);
+        H5Sclose(dataspace);
+        H5Pclose(cparms);
+        H5Pclose(dxpl);
+    } H5E_END_TRY;
+
+    for(u = 0; u < nchunks; u++)
+        if(outbuf[u])
+            HDfree(outbuf[u]);
+
+    return 1;
+}
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
 /*-------------------------------------------------------------------------
  * Function:	test_skip_compress_write1
  *
@@ -1118,6 +1746,12 @@ int main( void )
     /* Test direct chunk write */
 #ifdef H5_HAVE_FILTER_DEFLATE
     nerrors += test_direct_chunk_write(file_id);
+    nerrors += test_direct_chunk_read(file_id);
+#endif /* H5_HAVE_FILTER_DEFLATE */
+    nerrors += test_direct_chunk_write_multi(file_id);
+    nerrors += test_direct_chunk_write_multi_align();
+#ifdef H5_HAVE_FILTER_DEFLATE
+    nerrors += test_direct_chunk_write_multi_deflate(file_id);
 #endif /* H5_HAVE_FILTER_DEFLATE */
     nerrors += test_skip_compress_write1(file_id);
     nerrors += test_skip_compress_write2(file_id);
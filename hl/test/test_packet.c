@@ -18,6 +18,9 @@
 #include "h5hltest.h"
 #include "H5PTpublic.h"
 #include "H5TBpublic.h"
+#ifdef H5_HAVE_PACKET_TABLE_QUEUE
+#include <pthread.h>
+#endif
 
 /*-------------------------------------------------------------------------
  * Packet Table API test
@@ -513,6 +516,281 @@ static int    test_big_table(hid_t fid)
         return -1;
 }
 
+/*-------------------------------------------------------------------------
+ * test_buffered_append
+ *
+ * Ensures that appended packets are written to the dataset a chunk at a
+ * time, and that H5PTflush, the read functions and releasing the ID write
+ * out the rest.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int    test_buffered_append(hid_t fid)
+{
+    hid_t table = H5I_BADID;
+    hid_t dset_id = H5I_BADID;
+    hid_t space_id;
+    hid_t part_t;
+    size_t c;
+    particle_t readBuf[170];
+    particle_t writeBuf[70];
+    hsize_t dims[1];
+    hsize_t count;
+
+    TESTING("buffered appends");
+
+    /* Create a datatype for the particle struct */
+    part_t = make_particle_type();
+
+    HDassert(part_t != -1);
+
+    /* Create a new table with chunks of 33 packets */
+    table = H5PTcreate_fl(fid, "Buffered Test Dataset", part_t, (hsize_t)33, -1);
+    H5Tclose(part_t);
+    if( H5PTis_valid(table) < 0)
+        goto out;
+
+    /* Open the dataset on its own, to see what has been written */
+    if((dset_id = H5Dopen2(fid, "Buffered Test Dataset", H5P_DEFAULT)) < 0)
+        goto out;
+
+    /* Append one packet at a time; only whole chunks reach the dataset */
+    for(c = 0; c < 100; c++)
+        if(H5PTappend(table, (size_t)1, &(testPart[c % NRECORDS])) < 0)
+            goto out;
+
+    if(H5PTget_num_packets(table, &count) < 0 || count != 100)
+        goto out;
+    if((space_id = H5Dget_space(dset_id)) < 0)
+        goto out;
+    H5Sget_simple_extent_dims(space_id, dims, NULL);
+    H5Sclose(space_id);
+    if(dims[0] != 99)
+        goto out;
+
+    /* Write out the last packet */
+    if(H5PTflush(table) < 0)
+        goto out;
+    if((space_id = H5Dget_space(dset_id)) < 0)
+        goto out;
+    H5Sget_simple_extent_dims(space_id, dims, NULL);
+    H5Sclose(space_id);
+    if(dims[0] != 100)
+        goto out;
+
+    /* Append a block spanning several chunks */
+    for(c = 0; c < 70; c++)
+        writeBuf[c] = testPart[(c + 100) % NRECORDS];
+    if(H5PTappend(table, (size_t)70, writeBuf) < 0)
+        goto out;
+    if(H5PTget_num_packets(table, &count) < 0 || count != 170)
+        goto out;
+
+    /* Reading writes out the buffered packets first */
+    if(H5PTread_packets(table, (hsize_t)0, 170, readBuf) < 0)
+        goto out;
+    for(c = 0; c < 170; c++)
+        if(cmp_par(c % NRECORDS, c, testPart, readBuf) != 0)
+            goto out;
+
+    /* Releasing the ID without H5PTclose still writes out the buffer */
+    if(H5PTappend(table, (size_t)5, writeBuf) < 0)
+        goto out;
+    if(H5Idec_ref(table) != 0)
+        goto out;
+    table = H5I_BADID;
+    if((space_id = H5Dget_space(dset_id)) < 0)
+        goto out;
+    H5Sget_simple_extent_dims(space_id, dims, NULL);
+    H5Sclose(space_id);
+    if(dims[0] != 175)
+        goto out;
+
+    if(H5Dclose(dset_id) < 0)
+        goto out;
+
+    PASSED();
+    return 0;
+
+    out:
+        H5_FAILED();
+        H5E_BEGIN_TRY
+        H5Dclose(dset_id);
+        H5E_END_TRY
+        if( H5PTis_valid(table) >= 0)
+            H5PTclose(table);
+        return -1;
+}
+
+#ifdef H5_HAVE_PACKET_TABLE_QUEUE
+/*-------------------------------------------------------------------------
+ * test_queue
+ *
+ * Appends packets to a packet table from several threads through a queue
+ * small enough that producers have to wait for the writer.  In thread-safe
+ * builds, also reads the table while the writer is appending to it.
+ *
+ *-------------------------------------------------------------------------
+ */
+#define QUEUE_NTHREADS  4
+#define QUEUE_NPACKETS  5000
+
+typedef struct queue_packet_t
+{
+    int producer;
+    int seq;
+} queue_packet_t;
+
+typedef struct queue_producer_t
+{
+    H5PT_queue_t *queue;
+    int producer;
+    int failed;
+} queue_producer_t;
+
+static void *
+queue_producer(void *_arg)
+{
+    queue_producer_t *arg = (queue_producer_t *)_arg;
+    queue_packet_t packet[2];
+    int c, n;
+
+    /* Enqueue single packets and pairs */
+    for(c = 0; c < QUEUE_NPACKETS; c += n) {
+        n = ((c % 3) || c + 1 == QUEUE_NPACKETS) ? 1 : 2;
+        packet[0].producer = packet[1].producer = arg->producer;
+        packet[0].seq = c;
+        packet[1].seq = c + 1;
+        if(H5PTenqueue(arg->queue, (size_t)n, packet) < 0)
+            arg->failed = 1;
+    }
+
+    return NULL;
+}
+
+static int    test_queue(hid_t fid)
+{
+    hid_t table = H5I_BADID;
+    hid_t packet_t;
+    H5PT_queue_t *queue = NULL;
+    pthread_t threads[QUEUE_NTHREADS];
+    queue_producer_t args[QUEUE_NTHREADS];
+    queue_packet_t *readBuf = NULL;
+    int next[QUEUE_NTHREADS];
+    hsize_t count = 0;
+#ifdef H5_HAVE_THREADSAFE
+    queue_packet_t packet = {0, 0};
+    herr_t ret;
+#endif
+    size_t c;
+    int i;
+
+    TESTING("packet queue");
+
+    if((packet_t = H5Tcreate(H5T_COMPOUND, sizeof(queue_packet_t))) < 0)
+        goto out;
+    H5Tinsert(packet_t, "producer", HOFFSET(queue_packet_t, producer), H5T_NATIVE_INT);
+    H5Tinsert(packet_t, "seq", HOFFSET(queue_packet_t, seq), H5T_NATIVE_INT);
+
+    table = H5PTcreate_fl(fid, "Queue Test Dataset", packet_t, (hsize_t)100, -1);
+    H5Tclose(packet_t);
+    if(H5PTis_valid(table) < 0)
+        goto out;
+
+    /* A queue whose capacity can't be rounded up to a power of two is rejected */
+    if(H5PTcreate_queue(table, ~(size_t)0) != NULL)
+        goto out;
+
+    if(NULL == (queue = H5PTcreate_queue(table, (size_t)64)))
+        goto out;
+
+#ifdef H5_HAVE_THREADSAFE
+    /* Only one queue may feed a table, and the table is only written
+     * through it and stays open while it does */
+    if(H5PTcreate_queue(table, (size_t)64) != NULL)
+        goto out;
+    H5E_BEGIN_TRY
+    ret = H5PTclose(table);
+    H5E_END_TRY
+    if(ret >= 0)
+        goto out;
+    if(H5PTappend(table, (size_t)1, &packet) >= 0)
+        goto out;
+#endif
+
+    for(i = 0; i < QUEUE_NTHREADS; i++) {
+        args[i].queue = queue;
+        args[i].producer = i;
+        args[i].failed = 0;
+        if(pthread_create(&threads[i], NULL, queue_producer, &args[i]))
+            goto out;
+    }
+
+#ifdef H5_HAVE_THREADSAFE
+    /* The table can be read while the writer is appending to it */
+    for(c = 0; c < 100; c++) {
+        hsize_t prev = count;
+
+        if(H5PTget_num_packets(table, &count) < 0)
+            goto out;
+        if(c > 0 && count < prev)
+            goto out;
+        if(count > 0 && H5PTread_packets(table, count - 1, (size_t)1, &packet) < 0)
+            goto out;
+    }
+#endif
+
+    for(i = 0; i < QUEUE_NTHREADS; i++) {
+        pthread_join(threads[i], NULL);
+        if(args[i].failed)
+            goto out;
+    }
+
+    /* Every packet is in the dataset after a fence */
+    if(H5PTfence(queue) < 0)
+        goto out;
+    if(H5PTclose_queue(queue) < 0)
+        goto out;
+    queue = NULL;
+
+    if(H5PTget_num_packets(table, &count) < 0)
+        goto out;
+    if(count != QUEUE_NTHREADS * QUEUE_NPACKETS)
+        goto out;
+
+    /* Each producer's packets are in the order it enqueued them */
+    if(NULL == (readBuf = (queue_packet_t *)HDmalloc((size_t)count * sizeof(queue_packet_t))))
+        goto out;
+    if(H5PTread_packets(table, (hsize_t)0, (size_t)count, readBuf) < 0)
+        goto out;
+    for(i = 0; i < QUEUE_NTHREADS; i++)
+        next[i] = 0;
+    for(c = 0; c < (size_t)count; c++) {
+        if(readBuf[c].producer < 0 || readBuf[c].producer >= QUEUE_NTHREADS)
+            goto out;
+        if(readBuf[c].seq != next[readBuf[c].producer]++)
+            goto out;
+    }
+    HDfree(readBuf);
+
+    if(H5PTclose(table) < 0)
+        goto out;
+
+    PASSED();
+    return 0;
+
+    out:
+        H5_FAILED();
+        if(queue)
+            H5PTclose_queue(queue);
+        if(readBuf)
+            HDfree(readBuf);
+        if( H5PTis_valid(table) >= 0)
+            H5PTclose(table);
+        return -1;
+}
+#endif
+
 #ifdef VLPT_REMOVED
 /*-------------------------------------------------------------------------
  * test_varlen
@@ -1121,6 +1399,10 @@ static int test_packet_table(hid_t fid)
     test_read(fid);
     test_get_next(fid);
     test_big_table(fid);
+    test_buffered_append(fid);
+#ifdef H5_HAVE_PACKET_TABLE_QUEUE
+    test_queue(fid);
+#endif
     test_rw_nonnative_dt(fid);
 #ifdef VLPT_REMOVED
     test_varlen(fid);
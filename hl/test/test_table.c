@@ -312,6 +312,19 @@ static int test_table(hid_t fid, int do_write)
     {
         sizeof(namepre_in[0].pressure)
     };
+    /* buffers for the column reads */
+    char            name_col[NRECORDS][16];
+    float           pressure_col[NRECORDS];
+    long            longi_col[NRECORDS*4];
+    double          temp_col[NRECORDS*4];
+    int             lati_col[NRECORDS*4];
+    void           *col_bufs[3];
+    size_t field_sizes_cols[3]=
+    {
+        sizeof(wbuf[0].longi),
+        sizeof(wbuf[0].temperature),
+        sizeof(wbuf[0].lati)
+    };
 
     /*-------------------------------------------------------------------------
     * query table test
@@ -331,6 +344,7 @@ static int test_table(hid_t fid, int do_write)
     int    field_index_pre[1]     = { 2 };
     int    field_index_pos[2]     = { 1,4 };
     int    field_index_namepre[2] = { 0,2 };
+    int    field_index_cols[3]    = { 1,3,4 };
     int    field_index[NFIELDS]   = { 0,1,2,3,4 };
 
     /*-------------------------------------------------------------------------
@@ -1510,6 +1524,85 @@ static int test_table(hid_t fid, int do_write)
 
     PASSED();
 
+    /*-------------------------------------------------------------------------
+    *
+    * Functions tested:
+    *
+    * H5TBread_columns
+    *
+    *-------------------------------------------------------------------------
+    */
+
+    TESTING2("reading columns");
+
+    /* read the "Name,Pressure" fields into separate arrays */
+    nfields  = 2;
+    start    = 2;
+    nrecords = 5;
+    col_bufs[0] = name_col;
+    col_bufs[1] = pressure_col;
+    if ( H5TBread_columns(fid, "table12", nfields, field_index_namepre,
+        start, nrecords, field_sizes_namepre, col_bufs ) < 0 )
+        goto out;
+
+    for( i = 0; i < nrecords; i++ )
+    {
+        if ( ( HDstrcmp( name_col[i], wbuf[start+i].name ) != 0 ) ||
+	     !H5_FLT_ABS_EQUAL(pressure_col[i], wbuf[start+i].pressure) )
+            goto out;
+    }
+
+    /* a single column is read in place */
+    nfields  = 1;
+    start    = 0;
+    nrecords = NRECORDS;
+    col_bufs[0] = pressure_col;
+    if ( H5TBread_columns(fid, "table12", nfields, field_index_pre,
+        start, nrecords, field_sizes_pre, col_bufs ) < 0 )
+        goto out;
+
+    for( i = 0; i < nrecords; i++ )
+    {
+        if ( !H5_FLT_ABS_EQUAL(pressure_col[i], pressure_in[i]) )
+            goto out;
+    }
+
+    if (do_write)
+    {
+        /* a table spanning several chunks, read from an unaligned start */
+        if (H5TBmake_table(TITLE,fid,"table12c",FIELDS,RECORDS,type_size_mem,
+            field_names,field_offset,field_type,
+            chunk_size,fill,compress,wbuf)<0)
+            goto out;
+        for( i = 0; i < 3; i++ )
+        {
+            if ( H5TBappend_records(fid, "table12c", (hsize_t)NRECORDS, type_size_mem,
+                field_offset, field_size, wbuf) < 0 )
+                goto out;
+        }
+
+        nfields  = 3;
+        start    = 3;
+        nrecords = NRECORDS*4 - 4;
+        col_bufs[0] = longi_col;
+        col_bufs[1] = temp_col;
+        col_bufs[2] = lati_col;
+        if ( H5TBread_columns(fid, "table12c", nfields, field_index_cols,
+            start, nrecords, field_sizes_cols, col_bufs ) < 0 )
+            goto out;
+
+        for( i = 0; i < nrecords; i++ )
+        {
+            j = (start + i) % NRECORDS;
+            if ( longi_col[i] != wbuf[j].longi ||
+                 !H5_DBL_ABS_EQUAL(temp_col[i], wbuf[j].temperature) ||
+                 lati_col[i] != wbuf[j].lati )
+                goto out;
+        }
+    }
+
+    PASSED();
+
 
     /*-------------------------------------------------------------------------
     *
@@ -102,6 +102,25 @@ AC_DEFUN([PAC_PROG_CXX_OFFSETOF],[
     AC_MSG_RESULT([no]))
 ])
 
+dnl Checking if C++ supports rvalue references and std::move
+
+AC_DEFUN([PAC_PROG_CXX_MOVE],[
+  AC_MSG_CHECKING([if $CXX supports move semantics])
+    AC_LINK_IFELSE([AC_LANG_PROGRAM([
+  #include <utility>
+  struct movable_st
+  {
+    movable_st() {}
+    movable_st(movable_st &&) {}
+  };
+    ],[
+    movable_st a;
+    movable_st b(std::move(a))
+    ])],[AC_MSG_RESULT([yes])
+    AC_DEFINE([CXX_HAVE_MOVE], [1], [Define if C++ compiler supports rvalue references and std::move])],
+    AC_MSG_RESULT([no]))
+])
+
 dnl Checking if C++ can handle static cast
 
 AC_DEFUN([PAC_PROG_CXX_STATIC_CAST],[
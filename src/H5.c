@@ -31,6 +31,7 @@
 #include "H5Pprivate.h"		/* Property lists			*/
 #include "H5Tprivate.h"		/* Datatypes				*/
 #include "H5SLprivate.h"        /* Skip lists                           */
+#include "H5Zprivate.h"		/* Filter pipeline			*/
 
 
 /****************/
@@ -85,11 +86,21 @@ char			H5_lib_vers_info_g[] = H5_VERS_INFO;
 static hbool_t          H5_dont_atexit_g = FALSE;
 H5_debug_t		H5_debug_g;		/*debugging info	*/
 
+/* Statistics collection (see H5get_api_stats and H5Fget_stats) */
+hbool_t                 H5_api_stats_g = FALSE; /* Collect per-API statistics? */
+hbool_t                 H5_stats_env_g = FALSE; /* HDF5_STATS set in environment? */
+
 
 /*******************/
 /* Local Variables */
 /*******************/
 
+/* List of API routines with statistics, most recently registered first */
+static H5_api_stat_rec_t *H5_api_stats_head_s = NULL;
+
+/* File to write trace events to at library close (from HDF5_TRACE_EVENTS) */
+static const char *H5_trace_events_file_s = NULL;
+
 
 /*--------------------------------------------------------------------------
  * NAME
@@ -220,6 +231,26 @@ H5_init_library(void)
     H5_debug_mask("-all");
     H5_debug_mask(HDgetenv("HDF5_DEBUG"));
 
+    /* Statistics collection? */
+    {
+        const char *stats_env = HDgetenv("HDF5_STATS");
+
+        if(stats_env && *stats_env && HDstrcmp(stats_env, "0")) {
+            H5_stats_env_g = TRUE;
+            H5_api_stats_g = TRUE;
+        } /* end if */
+    }
+
+    /* Trace event recording? */
+    {
+        const char *trace_env = HDgetenv("HDF5_TRACE_EVENTS");
+
+        if(trace_env && *trace_env) {
+            H5_trace_events_file_s = trace_env;
+            H5CS_trace_g = TRUE;
+        } /* end if */
+    }
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5_init_library() */
@@ -350,6 +381,14 @@ H5_term_library(void)
     } /* end if */
 #endif
 
+    /* Write out and release trace events */
+    if(H5_trace_events_file_s) {
+        if(H5CS_trace_dump(H5_trace_events_file_s) < 0 && func)
+            fprintf(stderr, "HDF5: unable to write trace events to %s\n", H5_trace_events_file_s);
+        H5_trace_events_file_s = NULL;
+    } /* end if */
+    (void)H5CS_trace_term();
+
     /* Free open debugging streams */
     while(H5_debug_g.open_stream) {
         H5_debug_open_stream_t  *tmp_open_stream;
@@ -445,6 +484,8 @@ H5garbage_collect(void)
     /* Call the garbage collection routines in the library */
     if(H5FL_garbage_coll()<0)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "can't garbage collect objects")
+    if(H5Z_garbage_coll()<0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "can't garbage collect filter buffers")
 
 done:
     FUNC_LEAVE_API(ret_value)
@@ -970,6 +1011,202 @@ H5free_memory(void *mem)
 } /* end H5free_memory() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5_api_stats_record
+ *
+ * Purpose:	Accounts for one call of an API routine in the routine's
+ *		statistics record, registering the record on the global list
+ *		the first time through.  Called from FUNC_LEAVE_API with the
+ *		API lock still held.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_api_stats_record(H5_api_stat_rec_t *rec, const char *name, double start)
+{
+    double now;                         /* Current time */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(rec);
+    HDassert(name);
+
+    now = H5_get_time();
+
+    if(!rec->registered) {
+        rec->stats.name = name;
+        rec->next = H5_api_stats_head_s;
+        H5_api_stats_head_s = rec;
+        rec->registered = TRUE;
+    } /* end if */
+
+    rec->stats.ncalls++;
+    if(now > start)
+        rec->stats.time += now - start;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5_api_stats_record() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5set_api_stats
+ *
+ * Purpose:	Turns collection of per-API routine statistics on or off.
+ *		Collection is also turned on at library initialization
+ *		when the HDF5_STATS environment variable is set to a value
+ *		other than "0".  Turning collection off keeps the statistics
+ *		gathered so far.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5set_api_stats(hbool_t enable)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "b", enable);
+
+    H5_api_stats_g = enable;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5set_api_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5get_api_stats
+ *
+ * Purpose:	Retrieves the per-API routine statistics collected so far.
+ *		Up to NSTATS entries are copied into STATS, which may be
+ *		NULL to just query the number of routines.  The NAME field
+ *		of each entry points into the library and must not be freed.
+ *
+ * Return:	Success:	Number of API routines with statistics,
+ *				which may be larger than NSTATS
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+ssize_t
+H5get_api_stats(H5_api_stats_t stats[/*out*/], size_t nstats)
+{
+    H5_api_stat_rec_t *rec;             /* Current statistics record */
+    size_t      u = 0;                  /* Number of records */
+    ssize_t     ret_value;              /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("Zs", "*xz", stats, nstats);
+
+    if(nstats > 0 && NULL == stats)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no statistics buffer")
+
+    for(rec = H5_api_stats_head_s; rec; rec = rec->next, u++)
+        if(u < nstats)
+            stats[u] = rec->stats;
+
+    ret_value = (ssize_t)u;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5get_api_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5reset_api_stats
+ *
+ * Purpose:	Zeroes the per-API routine statistics collected so far.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5reset_api_stats(void)
+{
+    H5_api_stat_rec_t *rec;             /* Current statistics record */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE0("e","");
+
+    for(rec = H5_api_stats_head_s; rec; rec = rec->next) {
+        rec->stats.ncalls = 0;
+        rec->stats.time = 0.0F;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5reset_api_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5set_trace_events
+ *
+ * Purpose:	Turns recording of trace events on or off.  While on, the
+ *		library records timestamped begin and end events for API
+ *		routines and for metadata cache protects, chunk lookups,
+ *		filter pipeline runs and file driver I/O, keeping the most
+ *		recent events for each thread.  Recording is also turned on
+ *		at library initialization when the HDF5_TRACE_EVENTS
+ *		environment variable names a file, which the events are
+ *		written to when the library is closed.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5set_trace_events(hbool_t enable)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "b", enable);
+
+    H5CS_trace_g = enable;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5set_trace_events() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5dump_trace_events
+ *
+ * Purpose:	Writes the trace events recorded so far to FILENAME, in
+ *		the Chrome trace event JSON format, which can be loaded
+ *		into chrome://tracing and other trace viewers.  The events
+ *		are kept, so a later dump includes them again.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5dump_trace_events(const char *filename)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "*s", filename);
+
+    if(!filename || !*filename)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no file name specified")
+
+    if(H5CS_trace_dump(filename) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to write trace events")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5dump_trace_events() */
+
+
 #if defined(H5_HAVE_THREADSAFE) && defined(H5_BUILT_AS_DYNAMIC_LIB) \
     && defined(H5_HAVE_WIN32_API) && defined(H5_HAVE_WIN_THREADS)
 /*-------------------------------------------------------------------------
@@ -645,6 +645,85 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Aread() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5Aread_multi
+ PURPOSE
+    Read in the data of several attributes of one object
+ USAGE
+    herr_t H5Aread_multi (loc_id, obj_name, nattrs, attr_names, mem_type_ids, bufs, lapl_id)
+        hid_t loc_id;               IN: Object that object is located in
+        const char *obj_name;       IN: Name of object relative to location
+        size_t nattrs;              IN: Number of attributes to read
+        const char *attr_names[];   IN: Names of attributes to read, or NULL
+        const hid_t mem_type_ids[]; IN: Memory datatype of each buffer
+        void *bufs[];               OUT: Buffer for each attribute's data
+        hid_t lapl_id;              IN: Link access property list
+ RETURNS
+    Non-negative on success/Negative on failure
+
+ DESCRIPTION
+        This function reads the complete data of 'nattrs' attributes of an
+    object into the caller's buffers, converting each to the matching memory
+    datatype.  The object's attributes are gathered with one pass over its
+    object header (or dense attribute storage), which is much cheaper than
+    opening and reading each attribute separately on objects with many
+    attributes.  If 'attr_names' is NULL, the first 'nattrs' attributes in
+    increasing name order are read.
+--------------------------------------------------------------------------*/
+herr_t
+H5Aread_multi(hid_t loc_id, const char *obj_name, size_t nattrs,
+    const char *attr_names[], const hid_t mem_type_ids[], void *bufs[],
+    hid_t lapl_id)
+{
+    H5G_loc_t    	loc;            /* Object location */
+    H5T_t               **mem_types = NULL; /* Memory datatypes */
+    size_t              u;              /* Local index variable */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "i*sz**s*i**xi", loc_id, obj_name, nattrs, attr_names,
+             mem_type_ids, bufs, lapl_id);
+
+    /* check arguments */
+    if(H5I_ATTR == H5I_get_type(loc_id))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "location is not valid for an attribute")
+    if(H5G_loc(loc_id, &loc) < 0)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a location")
+    if(!obj_name || !*obj_name)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no object name")
+    if(nattrs > 0 && (NULL == mem_type_ids || NULL == bufs))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null datatype or buffer array")
+    if(H5P_DEFAULT == lapl_id)
+        lapl_id = H5P_LINK_ACCESS_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(lapl_id, H5P_LINK_ACCESS))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not link access property list ID")
+
+    if(nattrs > 0) {
+        if(NULL == (mem_types = (H5T_t **)H5MM_malloc(nattrs * sizeof(H5T_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        for(u = 0; u < nattrs; u++) {
+            if(attr_names && (!attr_names[u] || !*attr_names[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no attribute name")
+            if(NULL == (mem_types[u] = (H5T_t *)H5I_object_verify(mem_type_ids[u], H5I_DATATYPE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+            if(NULL == bufs[u])
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null attribute buffer")
+        } /* end for */
+    } /* end if */
+
+    /* Read the attributes from the object header */
+    if(H5A__read_multi(&loc, obj_name, nattrs, attr_names, mem_types, bufs, lapl_id, H5AC_ind_dxpl_id) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attributes")
+
+done:
+    H5MM_xfree(mem_types);
+
+    FUNC_LEAVE_API(ret_value)
+} /* H5Aread_multi() */
+
 
 /*--------------------------------------------------------------------------
  NAME
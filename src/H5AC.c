@@ -1066,10 +1066,14 @@ H5AC_protect(H5F_t *f, hid_t dxpl_id, const H5AC_class_t *type, haddr_t addr,
     size_t		trace_entry_size = 0;
     FILE *              trace_file_ptr = NULL;
 #endif /* H5AC__TRACE_FILE_ENABLED */
+    TRACE_EVENT_VARS
     void *		ret_value;      /* Return value */
 
     FUNC_ENTER_NOAPI(NULL)
 
+    /* Record the trace event for entering this routine */
+    BEGIN_TRACE_EVENT
+
     /* Sanity check */
     HDassert(f);
     HDassert(f->shared);
@@ -1122,6 +1126,7 @@ done:
 	HDfprintf(trace_file_ptr, "%s %d %d\n", trace, (int)trace_entry_size, (int)(ret_value != NULL));
 #endif /* H5AC__TRACE_FILE_ENABLED */
 
+    FINISH_TRACE_EVENT
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_protect() */
 
@@ -1626,6 +1631,31 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_get_cache_hit_rate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_get_cache_hit_totals
+ *
+ * Purpose:     Wrapper function for H5C_get_cache_hit_totals().
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_get_cache_hit_totals(const H5AC_t *cache_ptr, int64_t *hits_ptr,
+    int64_t *accesses_ptr)
+{
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(H5C_get_cache_hit_totals((const H5C_t *)cache_ptr, hits_ptr, accesses_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_get_cache_hit_totals() failed.")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_get_cache_hit_totals() */
+
 
 /*-------------------------------------------------------------------------
  *
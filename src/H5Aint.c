@@ -211,6 +211,10 @@ H5A_create(const H5G_loc_t *loc, const char *name, const H5T_t *type,
         if(H5T_set_latest_version(attr->shared->dt) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, NULL, "can't set latest version of datatype")
 
+    /* The attribute's datatype won't change from here on */
+    if(H5T_set_path_key(attr->shared->dt) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTSET, NULL, "can't set conversion path key of datatype")
+
     /* Copy the dataspace for the attribute */
     attr->shared->ds = H5S_copy(space, FALSE, TRUE);
 
@@ -570,6 +574,118 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5A__read() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5A__read_multi
+ PURPOSE
+    Read the data of several attributes of one object
+ USAGE
+    herr_t H5A__read_multi (loc, obj_name, nattrs, attr_names, mem_types, bufs, lapl_id, dxpl_id)
+        const H5G_loc_t *loc;       IN: Location of object's parent
+        const char *obj_name;       IN: Name of object relative to location
+        size_t nattrs;              IN: Number of attributes to read
+        const char *attr_names[];   IN: Names of attributes, or NULL for the
+                                        first 'nattrs' attributes in name order
+        H5T_t *mem_types[];         IN: Memory datatype of each buffer
+        void *bufs[];               OUT: Buffer for each attribute's data
+        hid_t lapl_id;              IN: Link access property list
+        hid_t dxpl_id;              IN: Data transfer property list
+ RETURNS
+    Non-negative on success/Negative on failure
+
+ DESCRIPTION
+    This function builds a name-sorted table of the object's attributes with
+    a single pass over the object header (or the dense attribute storage)
+    and reads each requested attribute out of that table, instead of
+    searching the object header once per attribute.
+--------------------------------------------------------------------------*/
+herr_t
+H5A__read_multi(const H5G_loc_t *loc, const char *obj_name, size_t nattrs,
+    const char *attr_names[], H5T_t *mem_types[], void *bufs[], hid_t lapl_id,
+    hid_t dxpl_id)
+{
+    H5G_loc_t   obj_loc;                /* Location used to open group */
+    H5G_name_t  obj_path;            	/* Opened object group hier. path */
+    H5O_loc_t   obj_oloc;            	/* Opened object object location */
+    hbool_t     loc_found = FALSE;      /* Entry at 'obj_name' found */
+    H5A_attr_table_t atable = {0, NULL};    /* Table of attributes */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check args */
+    HDassert(loc);
+    HDassert(obj_name);
+    HDassert(nattrs == 0 || (mem_types && bufs));
+
+    /* Set up opened group location to fill in */
+    obj_loc.oloc = &obj_oloc;
+    obj_loc.path = &obj_path;
+    H5G_loc_reset(&obj_loc);
+
+    /* Find the object's location */
+    if(H5G_loc_find(loc, obj_name, &obj_loc/*out*/, lapl_id, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, FAIL, "object not found")
+    loc_found = TRUE;
+
+    /* Build the table of attributes, sorted on name */
+    if(H5O_attr_build_table(obj_loc.oloc, dxpl_id, H5_INDEX_NAME, H5_ITER_INC, &atable) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "error building attribute table")
+
+    if(NULL == attr_names && nattrs > atable.nattrs)
+        HGOTO_ERROR(H5E_ATTR, H5E_BADRANGE, FAIL, "more attributes requested than object has")
+
+    for(u = 0; u < nattrs; u++) {
+        H5A_t *attr;                    /* Attribute to read */
+
+        if(attr_names) {
+            size_t lo = 0, hi = atable.nattrs;  /* Bounds of binary search */
+
+            /* Binary search the name-sorted table */
+            attr = NULL;
+            while(lo < hi) {
+                size_t mid = lo + (hi - lo) / 2;
+                int cmp = HDstrcmp(attr_names[u], atable.attrs[mid]->shared->name);
+
+                if(cmp == 0) {
+                    attr = atable.attrs[mid];
+                    break;
+                } /* end if */
+                else if(cmp < 0)
+                    hi = mid;
+                else
+                    lo = mid + 1;
+            } /* end while */
+            if(NULL == attr)
+                HGOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, FAIL, "attribute not found")
+        } /* end if */
+        else
+            attr = atable.attrs[u];
+
+        /* Attributes without stored data read back as zeroes */
+        if(NULL == attr->shared->data) {
+            hssize_t snelmts;           /* Elements in attribute */
+
+            if((snelmts = H5S_GET_EXTENT_NPOINTS(attr->shared->ds)) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTCOUNT, FAIL, "dataspace is invalid")
+            HDmemset(bufs[u], 0, H5T_GET_SIZE(mem_types[u]) * (size_t)snelmts);
+        } /* end if */
+        else if(H5A__read(attr, mem_types[u], bufs[u], dxpl_id) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attribute")
+    } /* end for */
+
+done:
+    /* Release resources */
+    if(atable.attrs && H5A_attr_release_table(&atable) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTFREE, FAIL, "unable to release attribute table")
+    if(loc_found && H5G_loc_free(&obj_loc) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTRELEASE, FAIL, "can't free location")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5A__read_multi() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -208,6 +208,9 @@ H5_DLL htri_t H5A_exists_by_name(H5G_loc_t loc, const char *obj_name, const char
     hid_t lapl_id, hid_t dxpl_id);
 H5_DLL herr_t H5A__write(H5A_t *attr, const H5T_t *mem_type, const void *buf, hid_t dxpl_id);
 H5_DLL herr_t H5A__read(const H5A_t *attr, const H5T_t *mem_type, void *buf, hid_t dxpl_id);
+H5_DLL herr_t H5A__read_multi(const H5G_loc_t *loc, const char *obj_name,
+    size_t nattrs, const char *attr_names[], H5T_t *mem_types[], void *bufs[],
+    hid_t lapl_id, hid_t dxpl_id);
 H5_DLL ssize_t H5A__get_name(H5A_t *attr, size_t buf_size, char *buf);
 
 /* Attribute "dense" storage routines */
@@ -261,6 +264,8 @@ H5_DLL herr_t H5O_attr_remove(const H5O_loc_t *loc, const char *name,
 H5_DLL herr_t H5O_attr_remove_by_idx(const H5O_loc_t *loc, H5_index_t idx_type,
     H5_iter_order_t order, hsize_t n, hid_t dxpl_id);
 H5_DLL htri_t H5O_attr_exists(const H5O_loc_t *loc, const char *name, hid_t dxpl_id);
+H5_DLL herr_t H5O_attr_build_table(const H5O_loc_t *loc, hid_t dxpl_id,
+    H5_index_t idx_type, H5_iter_order_t order, H5A_attr_table_t *atable);
 #ifndef H5_NO_DEPRECATED_SYMBOLS
 H5_DLL int H5O_attr_count(const H5O_loc_t *loc, hid_t dxpl_id);
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
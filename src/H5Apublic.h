@@ -53,6 +53,9 @@ H5_DLL hid_t   H5Aopen_by_idx(hid_t loc_id, const char *obj_name,
     hid_t lapl_id);
 H5_DLL herr_t  H5Awrite(hid_t attr_id, hid_t type_id, const void *buf);
 H5_DLL herr_t  H5Aread(hid_t attr_id, hid_t type_id, void *buf);
+H5_DLL herr_t  H5Aread_multi(hid_t loc_id, const char *obj_name, size_t nattrs,
+    const char *attr_names[], const hid_t mem_type_ids[], void *bufs[],
+    hid_t lapl_id);
 H5_DLL herr_t  H5Aclose(hid_t attr_id);
 H5_DLL hid_t   H5Aget_space(hid_t attr_id);
 H5_DLL hid_t   H5Aget_type(hid_t attr_id);
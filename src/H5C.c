@@ -605,6 +605,9 @@ H5C_create(size_t		      max_cache_size,
                     "H5C_reset_cache_hit_rate_stats failed.")
     }
 
+    cache_ptr->total_cache_hits			= 0;
+    cache_ptr->total_cache_accesses		= 0;
+
     H5C_stats__reset(cache_ptr);
 
     cache_ptr->prefix[0]			= '\0';  /* empty string */
@@ -1773,6 +1776,41 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_get_cache_hit_rate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_get_cache_hit_totals
+ *
+ * Purpose:	Return the number of cache hits and accesses since the
+ *		cache was created in *hits_ptr and *accesses_ptr.  Unlike
+ *		the hit rate, these totals are not reset by automatic cache
+ *		resizing.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_get_cache_hit_totals(const H5C_t * cache_ptr, int64_t * hits_ptr,
+    int64_t * accesses_ptr)
+{
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if((cache_ptr == NULL) || (cache_ptr->magic != H5C__H5C_T_MAGIC))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad cache_ptr on entry.")
+
+    HDassert(cache_ptr->total_cache_accesses >= cache_ptr->total_cache_hits);
+
+    if(hits_ptr)
+        *hits_ptr = cache_ptr->total_cache_hits;
+    if(accesses_ptr)
+        *accesses_ptr = cache_ptr->total_cache_accesses;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_get_cache_hit_totals() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -25,6 +25,11 @@
  *		first called functions will have entries on the stack. This is
  *		expected to be a rare condition.
  *
+ *		Independently of the function stack, timestamped begin and
+ *		end events for API routines and a few internal routines can
+ *		be recorded in a per-thread ring buffer and written out in
+ *		the Chrome trace event JSON format (see H5set_trace_events).
+ *
  */
 
 
@@ -325,3 +330,260 @@ H5CS_close_stack(H5CS_t *stack)
 
 #endif /* H5_HAVE_CODESTACK */
 
+
+/* Trace events kept per thread; older events are overwritten */
+#define H5CS_TRACE_NEVENTS      65536
+
+/* A trace event */
+typedef struct H5CS_trace_event_t {
+    const char  *name;                  /* Name of routine */
+    double      time;                   /* Time of event, in seconds */
+    hbool_t     begin;                  /* Begin event? (or end event) */
+} H5CS_trace_event_t;
+
+/* A thread's ring buffer of trace events */
+typedef struct H5CS_trace_buf_t {
+    unsigned long tid;                  /* ID of thread */
+    size_t      nevents;                /* Number of events ever recorded */
+    H5CS_trace_event_t event[H5CS_TRACE_NEVENTS]; /* Most recent events */
+    struct H5CS_trace_buf_t *next;      /* Next buffer on list */
+} H5CS_trace_buf_t;
+
+#ifdef H5_HAVE_THREADSAFE
+/* A thread's reference to its trace event buffer, kept in thread-local
+ * storage.  The buffer belongs to the generation of buffers that was
+ * current when it was created; once that generation is released by
+ * H5CS_trace_term, the reference is stale and a new buffer is made.
+ */
+typedef struct H5CS_trace_tls_t {
+    unsigned    gen;                    /* Generation of the buffer */
+    H5CS_trace_buf_t *tbuf;             /* Thread's buffer */
+} H5CS_trace_tls_t;
+#endif /* H5_HAVE_THREADSAFE */
+
+/* Is recording of trace events enabled? */
+hbool_t H5CS_trace_g = FALSE;
+
+/* Trace event buffers for all threads, which outlive the threads */
+static H5CS_trace_buf_t *H5CS_trace_bufs_s = NULL;
+
+#ifdef H5_HAVE_THREADSAFE
+/* Generation of the trace event buffers on the list */
+static unsigned H5CS_trace_gen_s = 0;
+#endif /* H5_HAVE_THREADSAFE */
+
+/* Time of the first trace event, used as the time origin */
+static double H5CS_trace_start_s = 0.0F;
+
+#ifndef H5_HAVE_THREADSAFE
+/* The trace event buffer, when there's only one thread */
+static H5CS_trace_buf_t *H5CS_trace_buf_s = NULL;
+#endif /* H5_HAVE_THREADSAFE */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5CS_trace_get_buf
+ *
+ * Purpose:	Retrieves the trace event buffer for the current thread,
+ *		creating it first if CREATE is set.  Called with the API
+ *		lock held.
+ *
+ * Return:	Success:	trace event buffer
+ *
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5CS_trace_buf_t *
+H5CS_trace_get_buf(hbool_t create)
+{
+#ifdef H5_HAVE_THREADSAFE
+    H5CS_trace_tls_t *tls;
+#endif /* H5_HAVE_THREADSAFE */
+    H5CS_trace_buf_t *tbuf = NULL;
+
+    FUNC_ENTER_NOAPI_NOERR_NOFS
+
+#ifdef H5_HAVE_THREADSAFE
+    tls = (H5CS_trace_tls_t *)H5TS_get_thread_local_value(H5TS_tracebuf_key_g);
+    if(!tls) {
+        /* No associated value with current thread - create one */
+#ifdef H5_HAVE_WIN_THREADS
+        tls = (H5CS_trace_tls_t *)LocalAlloc(LPTR, sizeof(H5CS_trace_tls_t)); /* Win32 has to use LocalAlloc to match the LocalFree in DllMain */
+#else
+        tls = (H5CS_trace_tls_t *)HDmalloc(sizeof(H5CS_trace_tls_t)); /* Don't use H5MM_malloc() here, it causes infinite recursion */
+#endif /* H5_HAVE_WIN_THREADS */
+        if(tls) {
+            tls->gen = H5CS_trace_gen_s;
+            tls->tbuf = NULL;
+            H5TS_set_thread_local_value(H5TS_tracebuf_key_g, (void *)tls);
+        } /* end if */
+    } /* end if */
+    if(tls) {
+        /* Forget a buffer released by H5CS_trace_term */
+        if(tls->gen != H5CS_trace_gen_s) {
+            tls->gen = H5CS_trace_gen_s;
+            tls->tbuf = NULL;
+        } /* end if */
+        tbuf = tls->tbuf;
+    } /* end if */
+#else /* H5_HAVE_THREADSAFE */
+    tbuf = H5CS_trace_buf_s;
+#endif /* H5_HAVE_THREADSAFE */
+    if(!tbuf && create
+#ifdef H5_HAVE_THREADSAFE
+            && tls
+#endif /* H5_HAVE_THREADSAFE */
+            ) {
+        /* Don't use H5MM_malloc() here, the buffer is released after the
+         * rest of the library is shut down */
+        if(NULL != (tbuf = (H5CS_trace_buf_t *)HDmalloc(sizeof(H5CS_trace_buf_t)))) {
+#ifdef H5_HAVE_THREADSAFE
+            tbuf->tid = HDpthread_self_ulong();
+            tls->tbuf = tbuf;
+#else /* H5_HAVE_THREADSAFE */
+            tbuf->tid = 0;
+            H5CS_trace_buf_s = tbuf;
+#endif /* H5_HAVE_THREADSAFE */
+            tbuf->nevents = 0;
+            tbuf->next = H5CS_trace_bufs_s;
+            H5CS_trace_bufs_s = tbuf;
+        } /* end if */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_NOFS(tbuf);
+} /* end H5CS_trace_get_buf() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5CS_trace_event
+ *
+ * Purpose:	Records a begin or end event for routine NAME in the
+ *		current thread's trace event buffer.  Events that can't be
+ *		recorded are silently dropped.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CS_trace_event(const char *name, hbool_t begin)
+{
+    H5CS_trace_buf_t *tbuf;
+    H5CS_trace_event_t *ev;
+
+    /* Don't push this function on the function stack... :-) */
+    FUNC_ENTER_NOAPI_NOERR_NOFS
+
+    HDassert(name);
+
+    /* (An end event without a buffer has lost its begin event) */
+    if(NULL != (tbuf = H5CS_trace_get_buf(begin))) {
+        ev = &tbuf->event[tbuf->nevents % H5CS_TRACE_NEVENTS];
+        ev->name = name;
+        ev->time = H5_get_time();
+        ev->begin = begin;
+        if(H5CS_trace_start_s <= 0.0F)
+            H5CS_trace_start_s = ev->time;
+        tbuf->nevents++;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_NOFS(SUCCEED);
+} /* end H5CS_trace_event() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5CS_trace_dump
+ *
+ * Purpose:	Writes the trace events recorded so far for all threads
+ *		to FILENAME, in the Chrome trace event JSON format.  End
+ *		events whose begin event was overwritten in the ring buffer
+ *		are left out.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CS_trace_dump(const char *filename)
+{
+    const H5CS_trace_buf_t *tbuf;
+    FILE        *stream;
+    const char  *sep = "";
+    int         pid = (int)HDgetpid();
+    herr_t      ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOERR_NOFS
+
+    HDassert(filename);
+
+    if(NULL != (stream = HDfopen(filename, "w"))) {
+        HDfprintf(stream, "{\"traceEvents\":[");
+        for(tbuf = H5CS_trace_bufs_s; tbuf; tbuf = tbuf->next) {
+            size_t first = 0, n;
+            size_t depth = 0;
+
+            if(tbuf->nevents > H5CS_TRACE_NEVENTS)
+                first = tbuf->nevents - H5CS_TRACE_NEVENTS;
+            for(n = first; n < tbuf->nevents; n++) {
+                const H5CS_trace_event_t *ev = &tbuf->event[n % H5CS_TRACE_NEVENTS];
+
+                if(ev->begin)
+                    depth++;
+                else if(depth > 0)
+                    depth--;
+                else
+                    continue;
+                HDfprintf(stream, "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":%d,\"tid\":%lu}",
+                        sep, ev->name, (H5_IS_API(ev->name) ? "api" : "internal"),
+                        (ev->begin ? 'B' : 'E'), (ev->time - H5CS_trace_start_s) * 1e6F,
+                        pid, tbuf->tid);
+                sep = ",";
+            } /* end for */
+        } /* end for */
+        HDfprintf(stream, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+        if(HDfclose(stream) < 0)
+            ret_value = FAIL;
+    } /* end if */
+    else
+        ret_value = FAIL;
+
+    FUNC_LEAVE_NOAPI_NOFS(ret_value);
+} /* end H5CS_trace_dump() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5CS_trace_term
+ *
+ * Purpose:	Stops recording trace events and releases the trace event
+ *		buffers of all threads.  Other threads find out that their
+ *		buffer is gone from the generation count, the next time
+ *		they record an event.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CS_trace_term(void)
+{
+    FUNC_ENTER_NOAPI_NOERR_NOFS
+
+    H5CS_trace_g = FALSE;
+    while(H5CS_trace_bufs_s) {
+        H5CS_trace_buf_t *tbuf = H5CS_trace_bufs_s;
+
+        H5CS_trace_bufs_s = tbuf->next;
+        HDfree(tbuf);
+    } /* end while */
+#ifdef H5_HAVE_THREADSAFE
+    H5CS_trace_gen_s++;
+#else /* H5_HAVE_THREADSAFE */
+    H5CS_trace_buf_s = NULL;
+#endif /* H5_HAVE_THREADSAFE */
+    H5CS_trace_start_s = 0.0F;
+
+    FUNC_LEAVE_NOAPI_NOFS(SUCCEED);
+} /* end H5CS_trace_term() */
+
@@ -495,8 +495,10 @@ if ( ( (entry_ptr) == NULL ) ||                                                \
 
 #define H5C__UPDATE_CACHE_HIT_RATE_STATS(cache_ptr, hit) \
         (cache_ptr->cache_accesses)++;                   \
+        (cache_ptr->total_cache_accesses)++;             \
         if ( hit ) {                                     \
             (cache_ptr->cache_hits)++;                   \
+            (cache_ptr->total_cache_hits)++;             \
         }                                                \
 
 #if H5C_COLLECT_CACHE_STATS
@@ -3319,6 +3321,13 @@ if ( ( (cache_ptr)->index_size !=                                           \
  *	were reset.  Note that when automatic cache re-sizing is enabled,
  *	this field will be reset every automatic resize epoch.
  *
+ * total_cache_hits: Number of cache hits since the cache was created.
+ *	Unlike cache_hits, this field is never reset, so that callers
+ *	can compute the number of hits over an interval of their own.
+ *
+ * total_cache_accesses: Number of times the cache has been accessed
+ *	since the cache was created.  This field is never reset.
+ *
  *
  * Statistics collection fields:
  *
@@ -3678,6 +3687,8 @@ struct H5C_t {
     /* Fields for cache hit rate collection */
     int64_t			cache_hits;
     int64_t			cache_accesses;
+    int64_t			total_cache_hits;
+    int64_t			total_cache_accesses;
 
 #if H5C_COLLECT_CACHE_STATS
     /* stats fields */
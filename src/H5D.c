@@ -706,6 +706,220 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dget_offset() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dget_chunk_storage_size
+ *
+ * Purpose:	Returns the size in the file of the chunk of a chunked
+ *		dataset at the logical OFFSET, which must fall on a chunk
+ *		boundary.  This is the size of the chunk after it has been
+ *		through the dataset's filters, and so is the size of the
+ *		buffer that H5DOread_chunk() needs.  Zero is returned for a
+ *		chunk that hasn't been allocated.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dget_chunk_storage_size(hid_t dset_id, const hsize_t *offset, hsize_t *chunk_nbytes)
+{
+    H5D_t	*dset;          /* Dataset to query */
+    herr_t	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "i*h*h", dset_id, offset, chunk_nbytes);
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+    if(NULL == offset)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no chunk offset")
+    if(NULL == chunk_nbytes)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no chunk size pointer")
+
+    /* Get the chunk's size */
+    if(H5D__chunk_get_info_by_coord(dset, H5AC_ind_dxpl_id, offset, NULL, NULL, chunk_nbytes) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get storage size of chunk")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dget_chunk_storage_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dget_chunk_info_by_coord
+ *
+ * Purpose:	Retrieves the filter mask, file address and stored size of
+ *		the chunk of a chunked dataset at the logical OFFSET, which
+ *		must fall on a chunk boundary.  Bit N of the filter mask is
+ *		set if filter N of the dataset's pipeline was skipped for
+ *		the chunk.  A chunk that hasn't been allocated has an
+ *		address of HADDR_UNDEF and a size of zero.  Any of the
+ *		output arguments may be NULL.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dget_chunk_info_by_coord(hid_t dset_id, const hsize_t *offset, unsigned *filter_mask,
+    haddr_t *addr, hsize_t *size)
+{
+    H5D_t	*dset;          /* Dataset to query */
+    herr_t	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "i*h*Iu*a*h", dset_id, offset, filter_mask, addr, size);
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+    if(NULL == offset)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no chunk offset")
+
+    /* Get the chunk's information */
+    if(H5D__chunk_get_info_by_coord(dset, H5AC_ind_dxpl_id, offset, filter_mask, addr, size) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get chunk info")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dget_chunk_info_by_coord() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dget_num_chunks
+ *
+ * Purpose:	Retrieves the number of chunks of a chunked dataset that
+ *		have been allocated in the file.  Comparing this with the
+ *		number of chunks the dataset's extent covers tells whether
+ *		the dataset is sparse.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dget_num_chunks(hid_t dset_id, hsize_t *nchunks)
+{
+    H5D_t	*dset;          /* Dataset to query */
+    herr_t	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*h", dset_id, nchunks);
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+    if(NULL == nchunks)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no chunk count pointer")
+
+    /* Count the chunks */
+    if(H5D__chunk_get_num_chunks(dset, H5AC_ind_dxpl_id, nchunks) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of chunks")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dget_num_chunks() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dget_chunk_info
+ *
+ * Purpose:	Retrieves the logical offset, filter mask, file address and
+ *		stored size of the CHUNK_IDX'th allocated chunk of a chunked
+ *		dataset, in the order of the dataset's chunk index.
+ *		CHUNK_IDX must be less than the number returned by
+ *		H5Dget_num_chunks().  Any of the output arguments may be
+ *		NULL; OFFSET must have room for one value per dimension of
+ *		the dataset.
+ *
+ *		Each call walks the chunk index up to the chunk wanted, so
+ *		use H5Dchunk_iter() to retrieve information about all the
+ *		chunks.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dget_chunk_info(hid_t dset_id, hsize_t chunk_idx, hsize_t *offset,
+    unsigned *filter_mask, haddr_t *addr, hsize_t *size)
+{
+    H5D_t	*dset;          /* Dataset to query */
+    herr_t	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE6("e", "ih*h*Iu*a*h", dset_id, chunk_idx, offset, filter_mask, addr,
+             size);
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+    /* Get the chunk's information */
+    if(H5D__chunk_get_info(dset, H5AC_ind_dxpl_id, chunk_idx, offset, filter_mask, addr, size) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get chunk info")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dget_chunk_info() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dchunk_iter
+ *
+ * Purpose:	Iterates over the allocated chunks of a chunked dataset,
+ *		walking the dataset's chunk index once.  OP is called for
+ *		each chunk with the chunk's logical offset, filter mask,
+ *		file address and stored size, and OP_DATA.  The chunks are
+ *		visited in the order of the index, which isn't necessarily
+ *		the order of their addresses.
+ *
+ *		OP returns zero to continue the iteration, a positive value
+ *		to stop it and return that value, or a negative value to
+ *		stop it and fail.  The library may not be used to modify
+ *		the dataset from within OP.
+ *
+ * Return:	Success:	The last value returned by OP, or zero if
+ *				the dataset has no chunks
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dchunk_iter(hid_t dset_id, H5D_chunk_iter_op_t op, void *op_data)
+{
+    H5D_t	*dset;          /* Dataset to query */
+    herr_t	ret_value;      /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ix*x", dset_id, op, op_data);
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+    if(NULL == op)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no operator specified")
+
+    /* Iterate over the chunks */
+    if((ret_value = H5D__chunk_iter(dset, H5AC_ind_dxpl_id, op, op_data)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "chunk iteration failed")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dchunk_iter() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Diterate
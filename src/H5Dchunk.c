@@ -163,6 +163,32 @@ typedef struct H5D_chunk_it_ud4_t {
     uint32_t            *chunk_dim;             /* Chunk dimensions */
 } H5D_chunk_it_ud4_t;
 
+/* Callback info for iteration over the chunk index with a public operator */
+typedef struct H5D_chunk_it_ud5_t {
+    const H5O_layout_chunk_t *layout;   /* Chunk layout description */
+    H5D_chunk_iter_op_t op;             /* Operator to call for each chunk */
+    void                *op_data;       /* User data for operator */
+} H5D_chunk_it_ud5_t;
+
+/* Callback info for looking up a chunk by its position in the index */
+typedef struct H5D_chunk_info_iter_ud_t {
+    hsize_t             chunk_idx;      /* Position of chunk to look up */
+    hsize_t             curr_idx;       /* Position of current chunk */
+    hsize_t             *offset;        /* Logical offset of chunk */
+    unsigned            ndims;          /* Number of dimensions of offset */
+    unsigned            filter_mask;    /* Chunk's filter mask */
+    haddr_t             addr;           /* Chunk's file address */
+    hsize_t             size;           /* Chunk's stored size */
+    hbool_t             found;          /* Whether the chunk was found */
+} H5D_chunk_info_iter_ud_t;
+
+/* One new chunk of a batched direct write */
+typedef struct H5D_chunk_batch_ent_t {
+    hsize_t             chunk_idx;      /* Linear index of chunk in dataset */
+    size_t              idx;            /* Index of chunk in caller's arrays */
+    hsize_t             scaled[H5O_LAYOUT_NDIMS];  /* Scaled coordinates of chunk */
+} H5D_chunk_batch_ent_t;
+
 /* Callback info for nonexistent readvv operation */
 typedef struct H5D_chunk_readvv_ud_t {
     unsigned char *rbuf;        /* Read buffer to initialize */
@@ -215,6 +241,8 @@ static herr_t H5D__chunk_set_info_real(H5O_layout_chunk_t *layout, unsigned ndim
     const hsize_t *curr_dims);
 static void *H5D__chunk_mem_alloc(size_t size, const H5O_pline_t *pline);
 static void *H5D__chunk_mem_xfree(void *chk, const H5O_pline_t *pline);
+static void *H5D__chunk_mem_release(void *chk, size_t size,
+    const H5O_pline_t *pline);
 static void *H5D__chunk_mem_realloc(void *chk, size_t size,
     const H5O_pline_t *pline);
 static herr_t H5D__chunk_cinfo_cache_reset(H5D_chunk_cached_t *last);
@@ -240,8 +268,22 @@ static herr_t H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id,
 static herr_t H5D__chunk_cache_prune(const H5D_t *dset, hid_t dxpl_id,
     const H5D_dxpl_cache_t *dxpl_cache, size_t size);
 static herr_t H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata);
+static int H5D__chunk_iter_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
+static int H5D__chunk_num_chunks_cb(const hsize_t *offset, unsigned filter_mask,
+    haddr_t addr, hsize_t size, void *op_data);
+static int H5D__chunk_get_info_cb(const hsize_t *offset, unsigned filter_mask,
+    haddr_t addr, hsize_t size, void *op_data);
+static int H5D__chunk_batch_cmp(const void *_ent1, const void *_ent2);
+static herr_t H5D__chunk_lookup_stored(const H5D_t *dset, hid_t dxpl_id,
+    const hsize_t *offset, hsize_t *scaled, H5D_chunk_ud_t *udata);
+static herr_t H5D__chunk_check_encode(const H5O_layout_chunk_t *layout,
+    hsize_t length);
 static herr_t H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info,
     const H5F_block_t *old_chunk, H5F_block_t *new_chunk, hbool_t *need_insert);
+static herr_t H5D__chunk_allocate_block(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, const hsize_t min_unalloc[],
+    const hsize_t max_unalloc[], size_t chunk_size, const void *fill_buf,
+    haddr_t *block_addr, hsize_t *block_size);
 #ifdef H5_HAVE_PARALLEL
 static herr_t H5D__chunk_collective_fill(const H5D_t *dset, hid_t dxpl_id,
     H5D_chunk_coll_info_t *chunk_info, size_t chunk_size, const void *fill_buf);
@@ -332,6 +374,10 @@ H5D__chunk_direct_write(const H5D_t *dset, hid_t dxpl_id, uint32_t filters,
 
     FUNC_ENTER_STATIC_TAG(dxpl_id, dset->oloc.addr, FAIL)
 
+    /* Without filters, a chunk is always stored at its full size */
+    if(0 == dset->shared->dcpl_cache.pline.nused && data_size != layout->u.chunk.size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk data size doesn't match chunk size of unfiltered dataset")
+
     /* Allocate dataspace and initialize it if it hasn't been. */
     if(!(*layout->ops->is_space_alloc)(&layout->storage))
  	/* Allocate storage */
@@ -370,10 +416,15 @@ H5D__chunk_direct_write(const H5D_t *dset, hid_t dxpl_id, uint32_t filters,
     udata.chunk_block.length = data_size;
 
     /* Create the chunk it if it doesn't exist, or reallocate the chunk
-     *  if its size changed.
+     *  if its size changed.  Without filters, a chunk that's already in the
+     *  file is just overwritten in place.
      */
-    if(H5D__chunk_file_alloc(&idx_info, &old_chunk, &udata.chunk_block, &need_insert) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+    if(0 == idx_info.pline->nused && H5F_addr_defined(old_chunk.offset))
+        need_insert = FALSE;
+    else {
+        if(H5D__chunk_file_alloc(&idx_info, &old_chunk, &udata.chunk_block, &need_insert) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+    } /* end else */
 
     /* Make sure the address of the chunk is returned. */
     if(!H5F_addr_defined(udata.chunk_block.offset))
@@ -407,10 +458,660 @@ H5D__chunk_direct_write(const H5D_t *dset, hid_t dxpl_id, uint32_t filters,
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
     } /* end if */
 
+    /* The chunk's cached info, from the lookup above, is out of date now */
+    H5D__chunk_cinfo_cache_reset(&(dset->shared->cache.chunk.last));
+
 done:
     FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
 } /* end H5D__chunk_direct_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_batch_cmp
+ *
+ * Purpose:	Compare two chunks of a batched direct write on their
+ *		position in the dataset, which is the order of the chunk
+ *		index, and then on the order the caller gave them.
+ *
+ * Return:	-1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_batch_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5D_chunk_batch_ent_t *ent1 = (const H5D_chunk_batch_ent_t *)_ent1;
+    const H5D_chunk_batch_ent_t *ent2 = (const H5D_chunk_batch_ent_t *)_ent2;
+    int ret_value;                      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(ent1->chunk_idx < ent2->chunk_idx)
+        ret_value = -1;
+    else if(ent1->chunk_idx > ent2->chunk_idx)
+        ret_value = 1;
+    else if(ent1->idx < ent2->idx)
+        ret_value = -1;
+    else if(ent1->idx > ent2->idx)
+        ret_value = 1;
+    else
+        ret_value = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_batch_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_direct_write_multi
+ *
+ * Purpose:	Internal routine to write COUNT chunks directly into the
+ *		file, as for H5D__chunk_direct_write().  Element I of each
+ *		array describes one chunk.  The offsets must fall on chunk
+ *		boundaries inside the dataset, and no chunk may be written
+ *		twice.
+ *
+ *		Chunks that are already stored in the file are rewritten
+ *		one at a time, as are new chunks large enough to be aligned
+ *		by H5Pset_alignment().  The space for the other new chunks
+ *		is allocated with one request, and they are laid out in it in
+ *		chunk index order and written with as few I/O operations as
+ *		the DXPL's temporary buffer size allows.  Their records are
+ *		then inserted into the index in order, so that each insert
+ *		finds the nodes of the previous one in the metadata cache.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_direct_write_multi(const H5D_t *dset, hid_t dxpl_id, size_t count,
+    const uint32_t filters[], const hsize_t *const offset[], const size_t data_size[],
+    const void *const buf[])
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);       /* Dataset layout */
+    const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);      /* Raw data chunk cache */
+    H5D_dxpl_cache_t _dxpl_cache;       /* Data transfer property cache buffer */
+    H5D_dxpl_cache_t *dxpl_cache = &_dxpl_cache;   /* Data transfer property cache */
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    H5D_chunk_batch_ent_t *ents = NULL; /* Chunks, in index order */
+    hsize_t alignment = H5F_ALIGNMENT(dset->oloc.file);        /* File space alignment */
+    hsize_t threshold = H5F_THRESHOLD(dset->oloc.file);        /* Size at and above which file space is aligned */
+    size_t nnew = 0;                    /* Number of new chunks */
+    hsize_t total_size = 0;             /* Size of all new chunks */
+    haddr_t base_addr = HADDR_UNDEF;    /* Address of space for new chunks */
+    haddr_t block_addr = HADDR_UNDEF;   /* Address of the part of that space not in the index yet */
+    hsize_t block_size = 0;             /* Size of the part of that space not in the index yet */
+    uint8_t *stage_buf = NULL;          /* Buffer for combining writes */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dxpl_id, dset->oloc.addr, FAIL)
+
+    HDassert(count > 0);
+    HDassert(filters && offset && data_size && buf);
+
+    /* Check the chunks and put them in index order, before doing any I/O */
+    if(NULL == (ents = (H5D_chunk_batch_ent_t *)H5MM_malloc(count * sizeof(H5D_chunk_batch_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+    for(u = 0; u < count; u++) {
+        if(0 == data_size[u] || data_size[u] != (size_t)(uint32_t)data_size[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid chunk data size")
+        if(0 == dset->shared->dcpl_cache.pline.nused && data_size[u] != layout->u.chunk.size)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk data size doesn't match chunk size of unfiltered dataset")
+        if(dset->shared->dcpl_cache.pline.nused > 0 && H5D__chunk_check_encode(&(layout->u.chunk), (hsize_t)data_size[u]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk size can't be encoded")
+        if(NULL == buf[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no chunk data")
+        H5VM_chunk_scaled(dset->shared->ndims, offset[u], layout->u.chunk.dim, ents[u].scaled);
+        ents[u].scaled[dset->shared->ndims] = 0;
+        ents[u].chunk_idx = H5VM_array_offset_pre(dset->shared->ndims, layout->u.chunk.down_chunks, ents[u].scaled);
+        ents[u].idx = u;
+    } /* end for */
+    if(count > 1)
+        HDqsort(ents, count, sizeof(H5D_chunk_batch_ent_t), H5D__chunk_batch_cmp);
+    for(u = 1; u < count; u++)
+        if(ents[u].chunk_idx == ents[u - 1].chunk_idx)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk written more than once")
+
+    /* Allocate dataspace and initialize it if it hasn't been. */
+    if(!(*layout->ops->is_space_alloc)(&layout->storage))
+        if(H5D__alloc_storage(dset, dxpl_id, H5D_ALLOC_WRITE, FALSE, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize storage")
+
+    /* Fill the DXPL cache values for later use */
+    if(H5D__get_dxpl_cache(dxpl_id, &dxpl_cache) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
+
+    /* Rewrite the chunks already in the file, and size up the new ones */
+    for(u = 0; u < count; u++) {
+        H5D_chunk_ud_t udata;           /* User data for querying chunk info */
+
+        if(H5D__chunk_lookup(dset, dxpl_id, ents[u].scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        /* Chunks that must be aligned can't share a block, so allocate
+         * them one at a time too */
+        if(H5F_addr_defined(udata.chunk_block.offset)
+                || (alignment > 1 && (hsize_t)data_size[ents[u].idx] >= threshold)) {
+            hsize_t chunk_offset[H5O_LAYOUT_NDIMS];    /* Offset of chunk */
+
+            HDmemcpy(chunk_offset, offset[ents[u].idx], dset->shared->ndims * sizeof(hsize_t));
+            chunk_offset[dset->shared->ndims] = 0;
+            if(H5D__chunk_direct_write(dset, dxpl_id, filters[ents[u].idx], chunk_offset, (uint32_t)data_size[ents[u].idx], buf[ents[u].idx]) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write chunk")
+        } /* end if */
+        else {
+            /* Evict a copy of the chunk in the cache, but do not flush it */
+            if(UINT_MAX != udata.idx_hint)
+                if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, rdcc->slot[udata.idx_hint], FALSE) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
+
+            /* Move the new chunks to the front, keeping their order */
+            ents[nnew++] = ents[u];
+            total_size += data_size[ents[u].idx];
+        } /* end else */
+    } /* end for */
+
+    if(nnew > 0) {
+        size_t max_stage = dxpl_cache->max_temp_buf;   /* Size of buffer for combining writes */
+        size_t staged = 0;              /* Bytes in staging buffer */
+        haddr_t stage_addr = HADDR_UNDEF;       /* File address of staged bytes */
+        haddr_t addr;                   /* Address of current chunk */
+
+        /* Allocate the space for all the new chunks */
+        if(HADDR_UNDEF == (base_addr = H5MF_alloc(dset->oloc.file, H5FD_MEM_DRAW, dxpl_id, total_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed")
+        block_addr = base_addr;
+        block_size = total_size;
+
+        /* Write the chunks, combining the small ones */
+        if(nnew > 1 && NULL == (stage_buf = (uint8_t *)H5MM_malloc(max_stage)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for staging buffer")
+        for(u = 0, addr = base_addr; u < nnew; u++) {
+            size_t nbytes = data_size[ents[u].idx];     /* Size of chunk */
+
+            /* Write out the staged chunks if this one won't fit */
+            if(staged > 0 && staged + nbytes > max_stage) {
+                if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, stage_addr, staged, dxpl_id, stage_buf) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+                staged = 0;
+            } /* end if */
+
+            if(NULL == stage_buf || nbytes > max_stage) {
+                if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, addr, nbytes, dxpl_id, buf[ents[u].idx]) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+            } /* end if */
+            else {
+                if(0 == staged)
+                    stage_addr = addr;
+                HDmemcpy(stage_buf + staged, buf[ents[u].idx], nbytes);
+                staged += nbytes;
+            } /* end else */
+
+            addr += nbytes;
+        } /* end for */
+        if(staged > 0)
+            if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, stage_addr, staged, dxpl_id, stage_buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+
+        /* Compose chunked index info struct */
+        idx_info.f = dset->oloc.file;
+        idx_info.dxpl_id = dxpl_id;
+        idx_info.pline = &(dset->shared->dcpl_cache.pline);
+        idx_info.layout = &(dset->shared->layout.u.chunk);
+        idx_info.storage = &(dset->shared->layout.storage.u.chunk);
+
+        /* Insert the new chunks' records into the index */
+        for(u = 0; u < nnew; u++) {
+            H5D_chunk_ud_t udata;       /* User data for inserting chunk */
+
+            udata.common.layout = &(layout->u.chunk);
+            udata.common.storage = &(layout->storage.u.chunk);
+            udata.common.scaled = ents[u].scaled;
+            udata.idx_hint = UINT_MAX;
+            udata.chunk_block.offset = block_addr;
+            udata.chunk_block.length = data_size[ents[u].idx];
+            udata.filter_mask = filters[ents[u].idx];
+
+            if((layout->storage.u.chunk.ops->insert)(&idx_info, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+
+            /* The chunk now belongs to the index */
+            block_addr += udata.chunk_block.length;
+            block_size -= udata.chunk_block.length;
+        } /* end for */
+        HDassert(0 == block_size);
+    } /* end if */
+
+done:
+    /* Release the new chunks' space that didn't make it into the index */
+    if(ret_value < 0 && block_size > 0)
+        if(H5MF_xfree(dset->oloc.file, H5FD_MEM_DRAW, dxpl_id, block_addr, block_size) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk space")
+
+    /* The chunks' cached info, from the lookups above, is out of date now */
+    H5D__chunk_cinfo_cache_reset(&(dset->shared->cache.chunk.last));
+
+    H5MM_xfree(stage_buf);
+    H5MM_xfree(ents);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5D__chunk_direct_write_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_lookup_stored
+ *
+ * Purpose:	Looks up the record in the chunk index of the chunk at the
+ *		logical OFFSET, which must fall on a chunk boundary within
+ *		the dataset.  A dirty copy of the chunk in the chunk cache is
+ *		written to the file first, so that the record describes the
+ *		chunk's current contents.  SCALED must have room for
+ *		H5O_LAYOUT_NDIMS coordinates, and holds the chunk's scaled
+ *		coordinates on return.
+ *
+ *		If the chunk isn't allocated, its address in UDATA is
+ *		HADDR_UNDEF.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_lookup_stored(const H5D_t *dset, hid_t dxpl_id, const hsize_t *offset,
+    hsize_t *scaled, H5D_chunk_ud_t *udata)
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);       /* Dataset layout */
+    const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);      /* Raw data chunk cache */
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    unsigned u;                         /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(H5D_CHUNKED == layout->type);
+    HDassert(offset);
+    HDassert(scaled);
+    HDassert(udata);
+
+    /* Make sure the offset names a chunk in the dataset */
+    for(u = 0; u < dset->shared->ndims; u++) {
+        if(offset[u] >= dset->shared->curr_dims[u])
+            HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "offset exceeds dimensions of dataset")
+        if(offset[u] % layout->u.chunk.dim[u])
+            HGOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "offset doesn't fall on chunk's boundary")
+    } /* end for */
+
+    /* Calculate the index of this chunk */
+    H5VM_chunk_scaled(dset->shared->ndims, offset, layout->u.chunk.dim, scaled);
+    scaled[dset->shared->ndims] = 0;
+
+    /* Initialize the query information about the chunk */
+    udata->common.layout = &(layout->u.chunk);
+    udata->common.storage = &(layout->storage.u.chunk);
+    udata->common.scaled = scaled;
+    udata->idx_hint = UINT_MAX;
+    udata->chunk_block.offset = HADDR_UNDEF;
+    udata->chunk_block.length = 0;
+    udata->filter_mask = 0;
+
+    /* Nothing is stored if the index hasn't been created yet */
+    if(!(*layout->ops->is_space_alloc)(&layout->storage))
+        HGOTO_DONE(SUCCEED)
+
+    /* Write out the chunk if it's been modified in the cache */
+    if(rdcc->nslots > 0) {
+        H5D_rdcc_ent_t *ent = rdcc->slot[H5D__chunk_hash_val(dset->shared, scaled)];
+
+        if(ent && ent->dirty) {
+            hbool_t found = TRUE;       /* Whether the entry is for this chunk */
+
+            for(u = 0; u < dset->shared->ndims; u++)
+                if(scaled[u] != ent->scaled[u]) {
+                    found = FALSE;
+                    break;
+                } /* end if */
+
+            if(found) {
+                H5D_dxpl_cache_t _dxpl_cache;       /* Data transfer property cache buffer */
+                H5D_dxpl_cache_t *dxpl_cache = &_dxpl_cache;   /* Data transfer property cache */
+
+                if(H5D__get_dxpl_cache(dxpl_id, &dxpl_cache) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
+                if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, FALSE) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "cannot flush indexed storage buffer")
+            } /* end if */
+        } /* end if */
+    } /* end if */
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.dxpl_id = dxpl_id;
+    idx_info.pline = &(dset->shared->dcpl_cache.pline);
+    idx_info.layout = &(dset->shared->layout.u.chunk);
+    idx_info.storage = &(dset->shared->layout.storage.u.chunk);
+
+    /* Query the index, which holds the chunk's filter mask */
+    if((layout->storage.u.chunk.ops->get_addr)(&idx_info, udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't query chunk address")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_lookup_stored() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_direct_read
+ *
+ * Purpose:	Internal routine to read a chunk directly from the file,
+ *		as it is stored, bypassing the chunk cache and the I/O
+ *		filter pipeline.  The chunk's filter mask is returned in
+ *		FILTERS.  BUF holds BUF_SIZE bytes; the read fails without
+ *		touching it if the chunk's stored size is larger.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_direct_read(const H5D_t *dset, hid_t dxpl_id, const hsize_t *offset,
+    uint32_t *filters, size_t buf_size, void *buf)
+{
+    H5D_chunk_ud_t udata;               /* User data for querying chunk info */
+    hsize_t scaled[H5O_LAYOUT_NDIMS];   /* Scaled coordinates for this chunk */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dxpl_id, dset->oloc.addr, FAIL)
+
+    HDassert(filters);
+    HDassert(buf);
+
+    /* Find the chunk in the file */
+    if(H5D__chunk_lookup_stored(dset, dxpl_id, offset, scaled, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+    if(!H5F_addr_defined(udata.chunk_block.offset))
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk address isn't defined")
+    if(udata.chunk_block.length > buf_size)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "buffer too small for chunk")
+
+    /* Read the chunk as it's stored */
+    if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, udata.chunk_block.offset, (size_t)udata.chunk_block.length, dxpl_id, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read raw data chunk")
+
+    *filters = udata.filter_mask;
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5D__chunk_direct_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_get_info_by_coord
+ *
+ * Purpose:	Retrieves the filter mask, file address and stored size of
+ *		the chunk at the logical OFFSET.  A chunk that isn't
+ *		allocated has an address of HADDR_UNDEF and a size of zero.
+ *		Any of the output arguments may be NULL.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_get_info_by_coord(const H5D_t *dset, hid_t dxpl_id, const hsize_t *offset,
+    unsigned *filter_mask, haddr_t *addr, hsize_t *size)
+{
+    H5D_chunk_ud_t udata;               /* User data for querying chunk info */
+    hsize_t scaled[H5O_LAYOUT_NDIMS];   /* Scaled coordinates for this chunk */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dxpl_id, dset->oloc.addr, FAIL)
+
+    if(H5D__chunk_lookup_stored(dset, dxpl_id, offset, scaled, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+    if(filter_mask)
+        *filter_mask = udata.filter_mask;
+    if(addr)
+        *addr = udata.chunk_block.offset;
+    if(size)
+        *size = udata.chunk_block.length;
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5D__chunk_get_info_by_coord() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_iter_cb
+ *
+ * Purpose:	Calls the public operator of a chunk index iteration for
+ *		one chunk, converting its scaled coordinates to a logical
+ *		offset.
+ *
+ * Return:	Value returned by operator
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_iter_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
+{
+    const H5D_chunk_it_ud5_t *udata = (const H5D_chunk_it_ud5_t *)_udata;   /* User data for callback */
+    hsize_t     offset[H5O_LAYOUT_NDIMS];       /* Logical offset of chunk */
+    unsigned    u;                              /* Local index variable */
+    int         ret_value;                      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* The last "dimension" of the layout is the datatype size */
+    for(u = 0; u < udata->layout->ndims - 1; u++)
+        offset[u] = chunk_rec->scaled[u] * udata->layout->dim[u];
+
+    /* Make the user's callback */
+    if((ret_value = (udata->op)(offset, chunk_rec->filter_mask, chunk_rec->chunk_addr, (hsize_t)chunk_rec->nbytes, udata->op_data)) < 0)
+        HERROR(H5E_DATASET, H5E_CALLBACK, "iteration operator failed");
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_iter_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_iter
+ *
+ * Purpose:	Walks the chunk index of a dataset, calling OP for each
+ *		allocated chunk with the chunk's logical offset, filter
+ *		mask, file address and stored size.  Chunks modified in the
+ *		chunk cache are written out first.
+ *
+ *		The iteration stops early if OP returns non-zero.
+ *
+ * Return:	Success:	Last value returned by OP, or zero if there
+ *				are no chunks
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_iter(const H5D_t *dset, hid_t dxpl_id, H5D_chunk_iter_op_t op, void *op_data)
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);       /* Dataset layout */
+    const H5D_rdcc_t   *rdcc = &(dset->shared->cache.chunk);	/* Raw data chunk cache */
+    H5D_rdcc_ent_t     *ent;            /* Cache entry  */
+    H5D_dxpl_cache_t _dxpl_cache;       /* Data transfer property cache buffer */
+    H5D_dxpl_cache_t *dxpl_cache = &_dxpl_cache;   /* Data transfer property cache */
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    H5D_chunk_it_ud5_t udata;           /* User data for iteration callback */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dxpl_id, dset->oloc.addr, FAIL)
+
+    HDassert(H5D_CHUNKED == layout->type);
+    HDassert(op);
+
+    /* Nothing is stored if the index hasn't been created yet */
+    if(!(*layout->ops->is_space_alloc)(&layout->storage))
+        HGOTO_DONE(SUCCEED)
+
+    /* Fill the DXPL cache values for later use */
+    if(H5D__get_dxpl_cache(dxpl_id, &dxpl_cache) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
+
+    /* Write out cached chunks, so that the index is up to date */
+    for(ent = rdcc->head; ent; ent = ent->next)
+        if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, FALSE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.dxpl_id = dxpl_id;
+    idx_info.pline = &dset->shared->dcpl_cache.pline;
+    idx_info.layout = &dset->shared->layout.u.chunk;
+    idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+    /* Set up user data for index callback */
+    udata.layout = &layout->u.chunk;
+    udata.op = op;
+    udata.op_data = op_data;
+
+    /* Iterate over the chunks */
+    if((ret_value = (layout->storage.u.chunk.ops->iterate)(&idx_info, H5D__chunk_iter_cb, &udata)) < 0)
+        HERROR(H5E_DATASET, H5E_BADITER, "unable to iterate over chunk index");
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5D__chunk_iter() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_num_chunks_cb
+ *
+ * Purpose:	Counts a chunk in the index.
+ *
+ * Return:	H5_ITER_CONT
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_num_chunks_cb(const hsize_t H5_ATTR_UNUSED *offset, unsigned H5_ATTR_UNUSED filter_mask,
+    haddr_t H5_ATTR_UNUSED addr, hsize_t H5_ATTR_UNUSED size, void *op_data)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    (*(hsize_t *)op_data)++;
+
+    FUNC_LEAVE_NOAPI(H5_ITER_CONT)
+} /* H5D__chunk_num_chunks_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_get_num_chunks
+ *
+ * Purpose:	Retrieves the number of chunks allocated in the file for a
+ *		chunked dataset.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_get_num_chunks(const H5D_t *dset, hid_t dxpl_id, hsize_t *nchunks)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(nchunks);
+
+    *nchunks = 0;
+    if(H5D__chunk_iter(dset, dxpl_id, H5D__chunk_num_chunks_cb, nchunks) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "unable to count chunks")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_get_num_chunks() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_get_info_cb
+ *
+ * Purpose:	Retrieves the information for a chunk if it's the one at
+ *		the position wanted in the index.
+ *
+ * Return:	H5_ITER_CONT or H5_ITER_STOP
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_get_info_cb(const hsize_t *offset, unsigned filter_mask, haddr_t addr,
+    hsize_t size, void *op_data)
+{
+    H5D_chunk_info_iter_ud_t *udata = (H5D_chunk_info_iter_ud_t *)op_data;     /* User data for callback */
+    int ret_value = H5_ITER_CONT;       /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(udata->curr_idx == udata->chunk_idx) {
+        if(udata->offset)
+            HDmemcpy(udata->offset, offset, udata->ndims * sizeof(hsize_t));
+        udata->filter_mask = filter_mask;
+        udata->addr = addr;
+        udata->size = size;
+        udata->found = TRUE;
+
+        ret_value = H5_ITER_STOP;
+    } /* end if */
+    else
+        udata->curr_idx++;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_get_info_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_get_info
+ *
+ * Purpose:	Retrieves the logical offset, filter mask, file address and
+ *		stored size of the CHUNK_IDX'th chunk in the chunk index,
+ *		which counts from zero up to the number of chunks allocated.
+ *		Any of the output arguments may be NULL.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_get_info(const H5D_t *dset, hid_t dxpl_id, hsize_t chunk_idx,
+    hsize_t *offset, unsigned *filter_mask, haddr_t *addr, hsize_t *size)
+{
+    H5D_chunk_info_iter_ud_t udata;     /* User data for iteration callback */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Set up user data for iteration callback */
+    udata.chunk_idx = chunk_idx;
+    udata.curr_idx = 0;
+    udata.offset = offset;
+    udata.ndims = dset->shared->ndims;
+    udata.found = FALSE;
+
+    /* Walk the index up to the chunk */
+    if(H5D__chunk_iter(dset, dxpl_id, H5D__chunk_get_info_cb, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "unable to iterate over chunk index")
+    if(!udata.found)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "chunk index is out of range")
+
+    if(filter_mask)
+        *filter_mask = udata.filter_mask;
+    if(addr)
+        *addr = udata.addr;
+    if(size)
+        *size = udata.size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_get_info() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_set_info_real
@@ -618,6 +1319,12 @@ H5D__chunk_init(H5F_t *f, hid_t dxpl_id, const H5D_t *dset, hid_t dapl_id)
     if(rdcc->w0 < 0)
         rdcc->w0 = H5F_RDCC_W0(f);
 
+    if(H5P_get(dapl, H5D_ACS_FILTER_SKIP_RATIO_NAME, &rdcc->filter_skip.max_ratio) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get filter skip ratio")
+    if(H5P_get(dapl, H5D_ACS_FILTER_SKIP_NCHUNKS_NAME, &rdcc->filter_skip.nchunks) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get filter skip chunk count")
+    rdcc->filter_skip.nleft = 0;
+
     /* If nbytes_max or nslots is 0, set them both to 0 and avoid allocating space */
     if(!rdcc->nbytes_max || !rdcc->nslots)
         rdcc->nbytes_max = rdcc->nslots = 0;
@@ -1010,7 +1717,7 @@ H5D__chunk_mem_alloc(size_t size, const H5O_pline_t *pline)
     HDassert(pline);
 
     if(pline->nused > 0)
-        ret_value = H5MM_malloc(size);
+        ret_value = H5Z_buf_alloc(size);
     else
         ret_value = H5FL_BLK_MALLOC(chunk, size);
 
@@ -1049,6 +1756,36 @@ H5D__chunk_mem_xfree(void *chk, const H5O_pline_t *pline)
     FUNC_LEAVE_NOAPI(NULL)
 } /* H5D__chunk_mem_xfree() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_mem_release
+ *
+ * Purpose:	Free space for a chunk in memory whose allocated size is
+ *              known to be at least SIZE bytes.  Filtered chunks are
+ *              handed back to the filter buffer pool so the next chunk
+ *              through the pipeline can reuse them.
+ *
+ * Return:	NULL (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5D__chunk_mem_release(void *chk, size_t size, const H5O_pline_t *pline)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(pline);
+
+    if(chk) {
+        if(pline->nused > 0)
+            H5Z_buf_free(chk, size);
+        else
+            chk = H5FL_BLK_FREE(chunk, chk);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(NULL)
+} /* H5D__chunk_mem_release() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_mem_realloc
@@ -2453,10 +3190,14 @@ H5D__chunk_lookup(const H5D_t *dset, hid_t dxpl_id, const hsize_t *scaled,
     H5D_rdcc_ent_t  *ent = NULL;        /* Cache entry */
     hbool_t         found = FALSE;      /* In cache? */
     unsigned        u;                  /* Counter */
+    TRACE_EVENT_VARS
     herr_t	ret_value = SUCCEED;	/* Return value */
 
     FUNC_ENTER_PACKAGE
 
+    /* Record the trace event for entering this routine */
+    BEGIN_TRACE_EVENT
+
     HDassert(dset);
     HDassert(dset->shared->layout.u.chunk.ndims > 0);
     HDassert(scaled);
@@ -2515,6 +3256,7 @@ H5D__chunk_lookup(const H5D_t *dset, hid_t dxpl_id, const hsize_t *scaled,
     } /* end else */
 
 done:
+    FINISH_TRACE_EVENT
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_lookup() */
 
@@ -2539,7 +3281,10 @@ H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
     H5D_rdcc_ent_t *ent, hbool_t reset)
 {
     void	*buf = NULL;	        /* Temporary buffer		*/
+    size_t	alloc = 0;		/* Bytes allocated for BUF	*/
     hbool_t	point_of_no_return = FALSE;
+    H5F_stats_t *fstats = H5F_STATS(dset->oloc.file); /* File statistics */
+    double      filter_time = 0.0F;    /* Time spent in filter pipeline */
     herr_t	ret_value = SUCCEED;	/* Return value			*/
 
     FUNC_ENTER_STATIC_TAG(dxpl_id, dset->oloc.addr, FAIL)
@@ -2567,16 +3312,19 @@ H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
 
         /* Should the chunk be filtered before writing it to disk? */
         if(dset->shared->dcpl_cache.pline.nused) {
-            size_t alloc = udata.chunk_block.length;        /* Bytes allocated for BUF	*/
+            H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);    /* Dataset's chunk cache */
+            unsigned optional_mask = 0;         /* Pipeline's optional filters */
             size_t nbytes;                      /* Chunk size (in bytes) */
 
+            H5_CHECKED_ASSIGN(alloc, size_t, udata.chunk_block.length, hsize_t);
+
             if(!reset) {
                 /*
                  * Copy the chunk to a new buffer before running it through
                  * the pipeline because we'll want to save the original buffer
                  * for later.
                  */
-                if(NULL == (buf = H5MM_malloc(alloc)))
+                if(NULL == (buf = H5Z_buf_alloc(alloc)))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
                 HDmemcpy(buf, ent->chunk, alloc);
             } /* end if */
@@ -2592,9 +3340,35 @@ H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
                 ent->chunk = NULL;
             } /* end else */
             H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
+
+            /* Skip the optional filters while the data looks incompressible */
+            if(rdcc->filter_skip.nchunks > 0) {
+                size_t u;                       /* Local index variable */
+
+                for(u = 0; u < dset->shared->dcpl_cache.pline.nused; u++)
+                    if(dset->shared->dcpl_cache.pline.filter[u].flags & H5Z_FLAG_OPTIONAL)
+                        optional_mask |= (unsigned)1 << u;
+                if(optional_mask && rdcc->filter_skip.nleft > 0) {
+                    udata.filter_mask = optional_mask;
+                    rdcc->filter_skip.nleft--;
+                    optional_mask = 0;
+                } /* end if */
+            } /* end if */
+
             if(H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask), dxpl_cache->err_detect,
-                     dxpl_cache->filter_cb, &nbytes, &alloc, &buf) < 0)
+                     dxpl_cache->filter_cb, (size_t)0, &nbytes, &alloc, &buf, &filter_time) < 0)
                 HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "output pipeline failed")
+            if(fstats) {
+                fstats->filter.calls++;
+                fstats->filter.time += filter_time;
+            } /* end if */
+
+            /* If the optional filters were applied, check how well they
+             * did and start skipping them if the chunk was incompressible.
+             */
+            if(optional_mask && ((udata.filter_mask & optional_mask) == optional_mask
+                    || (double)nbytes > rdcc->filter_skip.max_ratio * (double)udata.chunk_block.length))
+                rdcc->filter_skip.nleft = rdcc->filter_skip.nchunks;
 #if H5_SIZEOF_SIZE_T > 4
             /* Check for the chunk expanding too much to encode in a 32-bit value */
             if(nbytes > ((size_t)0xffffffff))
@@ -2664,7 +3438,7 @@ H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
 done:
     /* Free the temp buffer only if it's different than the entry chunk */
     if(buf != ent->chunk)
-        H5MM_xfree(buf);
+        H5Z_buf_free(buf, alloc);
 
     /*
      * If we reached the point of no return then we have no choice but to
@@ -2716,7 +3490,7 @@ H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
     else {
         /* Don't flush, just free chunk */
 	if(ent->chunk != NULL)
-	    ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk, &(dset->shared->dcpl_cache.pline));
+	    ent->chunk = (uint8_t *)H5D__chunk_mem_release(ent->chunk, (size_t)dset->shared->layout.u.chunk.size, &(dset->shared->dcpl_cache.pline));
     } /* end else */
 
     /* Unlink from list */
@@ -2894,6 +3668,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
     hbool_t             fb_info_init = FALSE;   /* Whether the fill value buffer has been initialized */
     H5D_rdcc_t		*rdcc = &(dset->shared->cache.chunk); /*raw data chunk cache*/
     H5D_rdcc_ent_t	*ent;		        /*cache entry		*/
+    H5F_stats_t         *fstats = H5F_STATS(dset->oloc.file); /* File statistics */
     size_t		chunk_size;		/*size of a chunk	*/
     void		*chunk = NULL;		/*the file chunk	*/
     void		*ret_value;	        /*return value		*/
@@ -2934,6 +3709,8 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
          * Already in the cache.  Count a hit.
          */
         rdcc->stats.nhits++;
+        if(fstats)
+            fstats->chunk_cache.hits++;
 
         /*
          * If the chunk is not at the beginning of the cache; move it backward
@@ -2971,6 +3748,8 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
              * miss because we saved ourselves lots of work.
              */
             rdcc->stats.nhits++;
+            if(fstats)
+                fstats->chunk_cache.hits++;
 
             if(NULL == (chunk = H5D__chunk_mem_alloc(chunk_size, pline)))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
@@ -2997,13 +3776,32 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
                 if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, chunk_addr, my_chunk_alloc, io_info->dxpl_id, chunk) < 0)
                     HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "unable to read raw data chunk")
 
-                if(pline->nused)
+                if(pline->nused) {
+                    double filter_time = 0.0F;      /* Time spent in filter pipeline */
+
                     if(H5Z_pipeline(pline, H5Z_FLAG_REVERSE, &(udata->filter_mask), io_info->dxpl_cache->err_detect,
-                            io_info->dxpl_cache->filter_cb, &my_chunk_alloc, &buf_alloc, &chunk) < 0)
+                            io_info->dxpl_cache->filter_cb, chunk_size, &my_chunk_alloc, &buf_alloc, &chunk, &filter_time) < 0)
                         HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, NULL, "data pipeline read failed")
 
+                    /* Make certain the buffer holds a whole chunk, so it can
+                     * be released as one when it leaves the cache */
+                    if(buf_alloc < chunk_size) {
+                        void *new_chunk;        /* Enlarged chunk buffer */
+
+                        if(NULL == (new_chunk = H5D__chunk_mem_realloc(chunk, chunk_size, pline)))
+                            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory reallocation failed for raw data chunk")
+                        chunk = new_chunk;
+                    } /* end if */
+                    if(fstats) {
+                        fstats->filter.calls++;
+                        fstats->filter.time += filter_time;
+                    } /* end if */
+                } /* end if */
+
                 /* Increment # of cache misses */
                 rdcc->stats.nmisses++;
+                if(fstats)
+                    fstats->chunk_cache.misses++;
             } /* end if */
             else {
                 H5D_fill_value_t	fill_status;
@@ -3191,7 +3989,7 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
         } /* end if */
         else {
             if(chunk)
-                chunk = H5D__chunk_mem_xfree(chunk, &(io_info->dset->shared->dcpl_cache.pline));
+                chunk = H5D__chunk_mem_release(chunk, (size_t)layout->u.chunk.size, &(io_info->dset->shared->dcpl_cache.pline));
         } /* end else */
     } /* end if */
     else {
@@ -3353,6 +4151,9 @@ H5D__chunk_allocate(const H5D_t *dset, hid_t dxpl_id, hbool_t full_overwrite,
     unsigned    op_dim;                 /* Current operating dimension */
     H5D_fill_buf_info_t fb_info;        /* Dataset's fill buffer info */
     hbool_t     fb_info_init = FALSE;   /* Whether the fill value buffer has been initialized */
+    hbool_t     use_block = FALSE;      /* Whether the chunks are carved from one block of file space */
+    haddr_t     block_addr = HADDR_UNDEF;       /* Address of the unused part of the block */
+    hsize_t     block_size = 0;         /* Size of the unused part of the block */
     herr_t	ret_value = SUCCEED;	/* Return value */
 
     FUNC_ENTER_PACKAGE_TAG(dxpl_id, dset->oloc.addr, FAIL)
@@ -3433,13 +4234,17 @@ H5D__chunk_allocate(const H5D_t *dset, hid_t dxpl_id, hbool_t full_overwrite,
             size_t buf_size = orig_chunk_size;
 
             /* Push the chunk through the filters */
-            if(H5Z_pipeline(pline, 0, &filter_mask, dxpl_cache->err_detect, dxpl_cache->filter_cb, &orig_chunk_size, &buf_size, &fb_info.fill_buf) < 0)
+            if(H5Z_pipeline(pline, 0, &filter_mask, dxpl_cache->err_detect, dxpl_cache->filter_cb, (size_t)0, &orig_chunk_size, &buf_size, &fb_info.fill_buf, NULL) < 0)
                 HGOTO_ERROR(H5E_PLINE, H5E_WRITEERROR, FAIL, "output pipeline failed")
 #if H5_SIZEOF_SIZE_T > 4
             /* Check for the chunk expanding too much to encode in a 32-bit value */
             if(orig_chunk_size > ((size_t)0xffffffff))
                 HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk too large for 32-bit length")
 #endif /* H5_SIZEOF_SIZE_T > 4 */
+
+            /* Check that the index can encode the filtered chunk's size */
+            if(H5D__chunk_check_encode(&layout->u.chunk, (hsize_t)orig_chunk_size) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk size can't be encoded")
         } /* end if */
     } /* end if */
 
@@ -3458,6 +4263,25 @@ H5D__chunk_allocate(const H5D_t *dset, hid_t dxpl_id, hbool_t full_overwrite,
         max_unalloc[op_dim] = (space_dim[op_dim] - 1) / chunk_dim[op_dim];
     } /* end for */
 
+    /* When every new chunk is the same size and holds the same (possibly
+     * filtered) fill values, allocate the file space for all of them at once
+     * and fill it with large writes.  The chunks below then take consecutive
+     * pieces of it, in the order they are inserted into the index.  (Fill
+     * values with VL datatypes must be converted for each chunk, parallel
+     * files fill the chunks collectively, and chunks that H5Pset_alignment()
+     * aligns can't be packed together, so they go one chunk at a time.)
+     */
+    if(!(fb_info_init && fb_info.has_vlen_fill_type)
+            && !(H5F_ALIGNMENT(dset->oloc.file) > 1 && (hsize_t)orig_chunk_size >= H5F_THRESHOLD(dset->oloc.file))
+#ifdef H5_HAVE_PARALLEL
+            && !using_mpi
+#endif /* H5_HAVE_PARALLEL */
+            ) {
+        if(H5D__chunk_allocate_block(dset, dxpl_id, dxpl_cache, min_unalloc, max_unalloc, orig_chunk_size, (should_fill ? fb_info.fill_buf : NULL), &block_addr, &block_size) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate space for chunks")
+        use_block = TRUE;
+    } /* end if */
+
     /* Loop over all chunks */
     /* The algorithm is:
      *  For each dimension:
@@ -3551,7 +4375,7 @@ H5D__chunk_allocate(const H5D_t *dset, hid_t dxpl_id, hbool_t full_overwrite,
                     size_t nbytes = orig_chunk_size;
 
                     /* Push the chunk through the filters */
-                    if(H5Z_pipeline(pline, 0, &filter_mask, dxpl_cache->err_detect, dxpl_cache->filter_cb, &nbytes, &fb_info.fill_buf_size, &fb_info.fill_buf) < 0)
+                    if(H5Z_pipeline(pline, 0, &filter_mask, dxpl_cache->err_detect, dxpl_cache->filter_cb, (size_t)0, &nbytes, &fb_info.fill_buf_size, &fb_info.fill_buf, NULL) < 0)
                         HGOTO_ERROR(H5E_PLINE, H5E_WRITEERROR, FAIL, "output pipeline failed")
 
 #if H5_SIZEOF_SIZE_T > 4
@@ -3574,12 +4398,21 @@ H5D__chunk_allocate(const H5D_t *dset, hid_t dxpl_id, hbool_t full_overwrite,
             udata.filter_mask = filter_mask;
 
             /* Allocate the chunk (with all processes) */
-	    if(H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert) < 0)
+            if(use_block) {
+                /* Take the chunk from the front of the block */
+                HDassert(block_size >= chunk_size);
+                udata.chunk_block.offset = block_addr;
+                block_addr += chunk_size;
+                block_size -= chunk_size;
+                need_insert = TRUE;
+            } /* end if */
+	    else if(H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert) < 0)
 		HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
             HDassert(H5F_addr_defined(udata.chunk_block.offset));
 
             /* Check if fill values should be written to chunks */
-            if(should_fill) {
+            /* (They were written to the whole block when it was allocated) */
+            if(should_fill && !use_block) {
                 /* Sanity check */
                 HDassert(fb_info_init);
                 HDassert(udata.chunk_block.length == chunk_size);
@@ -3644,6 +4477,9 @@ H5D__chunk_allocate(const H5D_t *dset, hid_t dxpl_id, hbool_t full_overwrite,
             max_unalloc[op_dim] = min_unalloc[op_dim] - 1;
     } /* end for(op_dim=0...) */
 
+    /* All of the block should have been used */
+    HDassert(0 == block_size);
+
 #ifdef H5_HAVE_PARALLEL
     /* do final collective I/O */
     if(using_mpi && blocks_written)
@@ -3655,6 +4491,11 @@ H5D__chunk_allocate(const H5D_t *dset, hid_t dxpl_id, hbool_t full_overwrite,
     H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk.last);
 
 done:
+    /* Release the part of the block that no chunk was given */
+    if(ret_value < 0 && block_size > 0)
+        if(H5MF_xfree(dset->oloc.file, H5FD_MEM_DRAW, dxpl_id, block_addr, block_size) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk space")
+
     /* Release the fill buffer info, if it's been initialized */
     if(fb_info_init && H5D__fill_term(&fb_info) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release fill buffer info")
@@ -3667,6 +4508,105 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
 } /* end H5D__chunk_allocate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_allocate_block
+ *
+ * Purpose:	Allocate one block of file space for all the chunks that
+ *		H5D__chunk_allocate() is about to create, which are those
+ *		between 0 and MAX_UNALLOC in each dimension (in scaled
+ *		coordinates) that aren't below MIN_UNALLOC in every
+ *		dimension.  Each chunk is CHUNK_SIZE bytes.
+ *
+ *		If FILL_BUF is non-NULL, it holds the chunk's fill values
+ *		and is copied into every chunk in the block, with writes as
+ *		large as the DXPL's temporary buffer size allows.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_allocate_block(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, const hsize_t min_unalloc[],
+    const hsize_t max_unalloc[], size_t chunk_size, const void *fill_buf,
+    haddr_t *block_addr, hsize_t *block_size)
+{
+    hsize_t     nchunks_all = 1;        /* Number of chunks in the dataset */
+    hsize_t     nchunks_old = 1;        /* Number of chunks already allocated */
+    hsize_t     nchunks;                /* Number of chunks to allocate */
+    haddr_t     addr = HADDR_UNDEF;     /* Address of block */
+    hsize_t     size;                   /* Size of block */
+    uint8_t     *write_buf = NULL;      /* Buffer of fill value chunks */
+    unsigned    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset);
+    HDassert(dxpl_cache);
+    HDassert(chunk_size > 0);
+    HDassert(block_addr && block_size);
+
+    /* Count the chunks that will be allocated */
+    for(u = 0; u < dset->shared->ndims; u++) {
+        nchunks_all *= max_unalloc[u] + 1;
+        nchunks_old *= MIN(min_unalloc[u], max_unalloc[u] + 1);
+    } /* end for */
+    nchunks = nchunks_all - nchunks_old;
+
+    /* Check for the block being too large to address */
+    if(nchunks > HSIZET_MAX / chunk_size)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunks too large to allocate together")
+    size = nchunks * chunk_size;
+
+    if(size > 0) {
+        /* Allocate the block */
+        if(HADDR_UNDEF == (addr = H5MF_alloc(dset->oloc.file, H5FD_MEM_DRAW, dxpl_id, size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed")
+
+        /* Write the fill values into it */
+        if(fill_buf) {
+            size_t      write_nchunks;          /* Number of chunks in the write buffer */
+            hsize_t     nleft = nchunks;        /* Number of chunks left to write */
+            haddr_t     write_addr = addr;      /* Address of the next write */
+
+            /* Replicate the fill value chunk to fill the write buffer */
+            write_nchunks = MAX(dxpl_cache->max_temp_buf / chunk_size, 1);
+            if((hsize_t)write_nchunks > nchunks)
+                write_nchunks = (size_t)nchunks;
+            if(NULL == (write_buf = (uint8_t *)H5MM_malloc(write_nchunks * chunk_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for fill value buffer")
+            for(u = 0; u < write_nchunks; u++)
+                HDmemcpy(write_buf + (u * chunk_size), fill_buf, chunk_size);
+
+            /* Write it over the block */
+            while(nleft > 0) {
+                size_t nwrite = (size_t)MIN(nleft, (hsize_t)write_nchunks);   /* Number of chunks to write */
+
+                if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, write_addr, nwrite * chunk_size, dxpl_id, write_buf) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+                write_addr += nwrite * chunk_size;
+                nleft -= nwrite;
+            } /* end while */
+        } /* end if */
+    } /* end if */
+
+    /* Set the block for the caller */
+    *block_addr = addr;
+    *block_size = size;
+
+done:
+    /* Release the block on failure */
+    if(ret_value < 0 && H5F_addr_defined(addr))
+        if(H5MF_xfree(dset->oloc.file, H5FD_MEM_DRAW, dxpl_id, addr, size) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk space")
+
+    H5MM_xfree(write_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_allocate_block() */
+
 #ifdef H5_HAVE_PARALLEL
 
 /*-------------------------------------------------------------------------
@@ -4659,7 +5599,7 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
     if(has_filters && (is_vlen || fix_ref)) {
         unsigned filter_mask = chunk_rec->filter_mask;
 
-        if(H5Z_pipeline(pline, H5Z_FLAG_REVERSE, &filter_mask, H5Z_NO_EDC, cb_struct, &nbytes, &buf_size, &buf) < 0)
+        if(H5Z_pipeline(pline, H5Z_FLAG_REVERSE, &filter_mask, H5Z_NO_EDC, cb_struct, (size_t)0, &nbytes, &buf_size, &buf, NULL) < 0)
             HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, H5_ITER_ERROR, "data pipeline read failed")
     } /* end if */
 
@@ -4721,7 +5661,7 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
 
     /* Need to compress variable-length & reference data elements before writing to file */
     if(has_filters && (is_vlen || fix_ref)) {
-        if(H5Z_pipeline(pline, 0, &(udata_dst.filter_mask), H5Z_NO_EDC, cb_struct, &nbytes, &buf_size, &buf) < 0)
+        if(H5Z_pipeline(pline, 0, &(udata_dst.filter_mask), H5Z_NO_EDC, cb_struct, (size_t)0, &nbytes, &buf_size, &buf, NULL) < 0)
             HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, H5_ITER_ERROR, "output pipeline failed")
 #if H5_SIZEOF_SIZE_T > 4
         /* Check for the chunk expanding too much to encode in a 32-bit value */
@@ -5394,6 +6334,49 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__nonexistent_readvv() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_check_encode()
+ *
+ * Purpose:     Check that a filtered chunk of LENGTH bytes is small enough
+ *		for its size to be encoded in the chunk index, which allows
+ *		one byte more than the size of an unfiltered chunk needs.
+ *
+ * Return:      Non-negative if the size can be encoded/Negative if not
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_check_encode(const H5O_layout_chunk_t *layout, hsize_t length)
+{
+    unsigned allow_chunk_size_len;          /* Allowed size of encoded chunk size */
+    unsigned new_chunk_size_len;            /* Size of encoded chunk size */
+    herr_t ret_value = SUCCEED;   	/* Return value         */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(layout);
+
+    /* Compute the size required for encoding the size of a chunk, allowing
+     * for an extra byte, in case the filter makes the chunk larger.
+     */
+    allow_chunk_size_len = 1 + ((H5VM_log2_gen((uint64_t)(layout->size)) + 8) / 8);
+    if(allow_chunk_size_len > 8)
+        allow_chunk_size_len = 8;
+
+    /* Compute encoded size of chunk */
+    new_chunk_size_len = (H5VM_log2_gen((uint64_t)length) + 8) / 8;
+    if(new_chunk_size_len > 8)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "encoded chunk size is more than 8 bytes?!?")
+
+    /* Check if the chunk became too large to be encoded */
+    if(new_chunk_size_len > allow_chunk_size_len)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk size can't be encoded")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_check_encode() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_file_alloc()
@@ -5430,27 +6413,9 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
 
     /* Check for filters on chunks */
     if(idx_info->pline->nused > 0) {
-        /* Sanity/error checking block */
-        {
-            unsigned allow_chunk_size_len;          /* Allowed size of encoded chunk size */
-            unsigned new_chunk_size_len;            /* Size of encoded chunk size */
-
-            /* Compute the size required for encoding the size of a chunk, allowing
-             * for an extra byte, in case the filter makes the chunk larger.
-             */
-            allow_chunk_size_len = 1 + ((H5VM_log2_gen((uint64_t)(idx_info->layout->size)) + 8) / 8);
-            if(allow_chunk_size_len > 8)
-                allow_chunk_size_len = 8;
-
-            /* Compute encoded size of chunk */
-            new_chunk_size_len = (H5VM_log2_gen((uint64_t)(new_chunk->length)) + 8) / 8;
-            if(new_chunk_size_len > 8)
-                HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "encoded chunk size is more than 8 bytes?!?")
-
-            /* Check if the chunk became too large to be encoded */
-            if(new_chunk_size_len > allow_chunk_size_len)
-                HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk size can't be encoded")
-        } /* end block */
+        /* Check that the size of the chunk can be encoded */
+        if(H5D__chunk_check_encode(idx_info->layout, new_chunk->length) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk size can't be encoded")
 
 	if(old_chunk && H5F_addr_defined(old_chunk->offset)) {
 	    /* Sanity check */
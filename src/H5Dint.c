@@ -646,6 +646,10 @@ H5D__init_type(H5F_t *file, const H5D_t *dset, hid_t type_id, const H5T_t *type)
             if(H5T_set_latest_version(dset->shared->type) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set latest version of datatype")
 
+        /* The dataset's datatype won't change from here on */
+        if(H5T_set_path_key(dset->shared->type) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set conversion path key of datatype")
+
         /* Get a datatype ID for the dataset's datatype */
 	if((dset->shared->type_id = H5I_register(H5I_DATATYPE, dset->shared->type, FALSE)) < 0)
 	    HGOTO_ERROR(H5E_DATASET, H5E_CANTREGISTER, FAIL, "unable to register type")
@@ -1286,6 +1290,8 @@ H5D__open_oid(H5D_t *dataset, hid_t dapl_id, hid_t dxpl_id)
 
     if(H5T_set_loc(dataset->shared->type, dataset->oloc.file, H5T_LOC_DISK) < 0)
         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "invalid datatype location")
+    if(H5T_set_path_key(dataset->shared->type) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTSET, FAIL, "can't set conversion path key of datatype")
 
     if(NULL == (dataset->shared->space = H5S_read(&(dataset->oloc), dxpl_id)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to load dataspace info from dataset header")
@@ -2710,6 +2716,10 @@ H5D_get_access_plist(H5D_t *dset)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set data cache byte size")
         if (H5P_set(new_plist, H5D_ACS_PREEMPT_READ_CHUNKS_NAME, &(dset->shared->cache.chunk.w0)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set preempt read chunks")
+        if (H5P_set(new_plist, H5D_ACS_FILTER_SKIP_RATIO_NAME, &(dset->shared->cache.chunk.filter_skip.max_ratio)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set filter skip ratio")
+        if (H5P_set(new_plist, H5D_ACS_FILTER_SKIP_NCHUNKS_NAME, &(dset->shared->cache.chunk.filter_skip.nchunks)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set filter skip chunk count")
     } /* end if */
 
     /* Set the return value */
@@ -46,6 +46,16 @@
 /* Local Typedefs */
 /******************/
 
+/* One dataset's part of a multi-dataset I/O operation */
+typedef struct H5D_multi_io_t {
+    H5D_t       *dset;                  /* Dataset to operate on */
+    hid_t       mem_type_id;            /* Memory datatype */
+    const H5S_t *mem_space;             /* Memory dataspace (NULL for "all") */
+    const H5S_t *file_space;            /* File dataspace (NULL for "all") */
+    haddr_t     addr;                   /* Address to order dataset's I/O on */
+    size_t      idx;                    /* Index of operation in caller's arrays */
+} H5D_multi_io_t;
+
 
 /********************/
 /* Local Prototypes */
@@ -55,8 +65,14 @@
 static herr_t H5D__write(H5D_t *dataset, hid_t mem_type_id,
     const H5S_t *mem_space, const H5S_t *file_space, hid_t dset_xfer_plist,
     const void *buf);
+static herr_t H5D__pre_read(H5D_t *dset, hbool_t direct_read, hid_t mem_type_id,
+    const H5S_t *mem_space, const H5S_t *file_space, hid_t dxpl_id, void *buf);
 static herr_t H5D__pre_write(H5D_t *dset, hbool_t direct_write, hid_t mem_type_id, 
     const H5S_t *mem_space, const H5S_t *file_space, hid_t dxpl_id, const void *buf);
+static H5D_multi_io_t *H5D__multi_init(size_t count, const hid_t dset_id[],
+    const hid_t mem_type_id[], const hid_t mem_space_id[],
+    const hid_t file_space_id[], hbool_t do_write, hid_t dxpl_id);
+static int H5D__multi_cmp(const void *_op1, const void *_op2);
 
 /* Setup/teardown routines */
 static herr_t H5D__ioinfo_init(H5D_t *dset,
@@ -127,8 +143,10 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 	hid_t file_space_id, hid_t plist_id, void *buf/*out*/)
 {
     H5D_t		   *dset = NULL;
+    H5P_genplist_t 	   *plist;      /* Property list pointer */
     const H5S_t		   *mem_space = NULL;
     const H5S_t		   *file_space = NULL;
+    hbool_t                 direct_read = FALSE;
     herr_t                  ret_value = SUCCEED;  /* Return value */
 
     FUNC_ENTER_API(FAIL)
@@ -141,26 +159,6 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
     if(NULL == dset->oloc.file)
 	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
 
-    if(mem_space_id < 0 || file_space_id < 0)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data space")
-
-    if(H5S_ALL != mem_space_id) {
-	if(NULL == (mem_space = (const H5S_t *)H5I_object_verify(mem_space_id, H5I_DATASPACE)))
-	    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data space")
-
-	/* Check for valid selection */
-	if(H5S_SELECT_VALID(mem_space) != TRUE)
-	    HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "selection+offset not within extent")
-    } /* end if */
-    if(H5S_ALL != file_space_id) {
-	if(NULL == (file_space = (const H5S_t *)H5I_object_verify(file_space_id, H5I_DATASPACE)))
-	    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data space")
-
-	/* Check for valid selection */
-	if(H5S_SELECT_VALID(file_space) != TRUE)
-	    HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "selection+offset not within extent")
-    } /* end if */
-
     /* Get the default dataset transfer property list if the user didn't provide one */
     if (H5P_DEFAULT == plist_id)
         plist_id= H5P_DATASET_XFER_DEFAULT;
@@ -168,8 +166,38 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
         if(TRUE != H5P_isa_class(plist_id, H5P_DATASET_XFER))
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
 
-    /* read raw data */
-    if(H5D__read(dset, mem_type_id, mem_space, file_space, plist_id, buf/*out*/) < 0)
+    /* Get the dataset transfer property list */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(plist_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset transfer property list")
+
+    /* Retrieve the 'direct read' flag */
+    if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_READ_FLAG_NAME, &direct_read) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting flag for direct chunk read")
+
+    /* Check dataspace selections if this is not a direct read */
+    if(!direct_read) {
+        if(mem_space_id < 0 || file_space_id < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data space")
+
+        if(H5S_ALL != mem_space_id) {
+            if(NULL == (mem_space = (const H5S_t *)H5I_object_verify(mem_space_id, H5I_DATASPACE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data space")
+
+            /* Check for valid selection */
+            if(H5S_SELECT_VALID(mem_space) != TRUE)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "selection+offset not within extent")
+        } /* end if */
+        if(H5S_ALL != file_space_id) {
+            if(NULL == (file_space = (const H5S_t *)H5I_object_verify(file_space_id, H5I_DATASPACE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data space")
+
+            /* Check for valid selection */
+            if(H5S_SELECT_VALID(file_space) != TRUE)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "selection+offset not within extent")
+        } /* end if */
+    } /* end if */
+
+    if(H5D__pre_read(dset, direct_read, mem_type_id, mem_space, file_space, plist_id, buf/*out*/) < 0)
 	HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
 
 done:
@@ -274,7 +302,377 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dread_multi
+ *
+ * Purpose:	Reads (part of) COUNT datasets from the file into
+ *		application memory.  This is a convenience wrapper around
+ *		H5Dread().  Element I of each array describes one read:
+ *		the dataset, memory datatype, memory and file dataspaces
+ *		(either of which may be H5S_ALL) and the buffer to read
+ *		into.  All the reads share the data transfer property list
+ *		DXPL_ID.
+ *
+ *		The dataset, datatype and dataspace arguments are all
+ *		checked before any data is read, including that each
+ *		memory datatype can be converted from its dataset's
+ *		datatype.  The reads are then performed one dataset at a
+ *		time, ordered on the address of each dataset's storage
+ *		(for chunked datasets, the address of the chunk index, not
+ *		of the chunks themselves).  Each read sets up its own I/O
+ *		as H5Dread() does, so reads are not merged across datasets,
+ *		and a collective transfer with the MPI-IO driver is one
+ *		collective operation per dataset.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_multi(size_t count, const hid_t dset_id[], const hid_t mem_type_id[],
+    const hid_t mem_space_id[], const hid_t file_space_id[], hid_t dxpl_id,
+    void *buf[]/*out*/)
+{
+    H5D_multi_io_t         *ops = NULL; /* Operations, in I/O order */
+    H5P_genplist_t 	   *plist;      /* Property list pointer */
+    hbool_t                 direct_read = FALSE;
+    size_t                  u;          /* Local index variable */
+    herr_t                  ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*ii**x", count, dset_id, mem_type_id, mem_space_id,
+             file_space_id, dxpl_id, buf);
+
+    /* check arguments */
+    if(count == 0)
+        HGOTO_DONE(SUCCEED)
+    if(NULL == buf)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no buffer array")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Get the dataset transfer property list */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset transfer property list")
+
+    /* Direct chunk reads name a single chunk, so can't span datasets */
+    if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_READ_FLAG_NAME, &direct_read) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting flag for direct chunk read")
+    if(direct_read)
+	HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "direct chunk read not supported for multiple datasets")
+
+    /* Check the per-dataset arguments and order the reads */
+    if(NULL == (ops = H5D__multi_init(count, dset_id, mem_type_id, mem_space_id, file_space_id, FALSE, dxpl_id)))
+	HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up multi-dataset read")
+
+    /* read raw data */
+    for(u = 0; u < count; u++)
+        if(H5D__read(ops[u].dset, ops[u].mem_type_id, ops[u].mem_space, ops[u].file_space, dxpl_id, buf[ops[u].idx]/*out*/) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    H5MM_xfree(ops);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dwrite_multi
+ *
+ * Purpose:	Writes (part of) COUNT datasets from application memory
+ *		to the file.  This is a convenience wrapper around
+ *		H5Dwrite().  Element I of each array describes one write,
+ *		as for H5Dread_multi().  All the writes share the data
+ *		transfer property list DXPL_ID, which may not request a
+ *		direct chunk write.
+ *
+ *		The dataset, datatype and dataspace arguments are all
+ *		checked before any data is written, including that each
+ *		memory datatype can be converted to its dataset's
+ *		datatype.  The writes are then performed one dataset at a
+ *		time, in the same order as for H5Dread_multi().  Writes to
+ *		the same dataset are performed in the order given.  As for
+ *		H5Dread_multi(), writes are not merged across datasets.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_multi(size_t count, const hid_t dset_id[], const hid_t mem_type_id[],
+    const hid_t mem_space_id[], const hid_t file_space_id[], hid_t dxpl_id,
+    const void *buf[])
+{
+    H5D_multi_io_t         *ops = NULL; /* Operations, in I/O order */
+    H5P_genplist_t 	   *plist;      /* Property list pointer */
+    hbool_t                 direct_write = FALSE;
+    size_t                  u;          /* Local index variable */
+    herr_t                  ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*ii**x", count, dset_id, mem_type_id, mem_space_id,
+             file_space_id, dxpl_id, buf);
+
+    /* check arguments */
+    if(count == 0)
+        HGOTO_DONE(SUCCEED)
+    if(NULL == buf)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no buffer array")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Get the dataset transfer property list */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset transfer property list")
+
+    /* Direct chunk writes name a single chunk, so can't span datasets */
+    if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_WRITE_FLAG_NAME, &direct_write) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting flag for direct chunk write")
+    if(direct_write)
+	HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "direct chunk write not supported for multiple datasets")
+
+    /* Check the per-dataset arguments and order the writes */
+    if(NULL == (ops = H5D__multi_init(count, dset_id, mem_type_id, mem_space_id, file_space_id, TRUE, dxpl_id)))
+	HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up multi-dataset write")
+
+    /* write raw data */
+    for(u = 0; u < count; u++)
+        if(H5D__write(ops[u].dset, ops[u].mem_type_id, ops[u].mem_space, ops[u].file_space, dxpl_id, buf[ops[u].idx]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    H5MM_xfree(ops);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_init
+ *
+ * Purpose:	Checks the per-dataset arguments of a multi-dataset I/O
+ *		operation and builds the array of operations, sorted on
+ *		the address of each dataset's storage.  For chunked
+ *		datasets that is the address of the chunk index.
+ *
+ *		Each memory datatype is checked for a conversion path to
+ *		(DO_WRITE) or from its dataset's datatype, so that a bad
+ *		datatype fails the operation before any I/O is done.  The
+ *		path found is cached by the datatype code, so the lookup
+ *		for the I/O itself is cheap.
+ *
+ * Return:	Success:	Pointer to array of COUNT operations, to be
+ *				freed with H5MM_xfree()
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_multi_io_t *
+H5D__multi_init(size_t count, const hid_t dset_id[], const hid_t mem_type_id[],
+    const hid_t mem_space_id[], const hid_t file_space_id[], hbool_t do_write,
+    hid_t dxpl_id)
+{
+    H5D_multi_io_t *ops = NULL;         /* Array of operations */
+    size_t      u;                      /* Local index variable */
+    H5D_multi_io_t *ret_value;          /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(count > 0);
+
+    if(NULL == dset_id || NULL == mem_type_id || NULL == mem_space_id || NULL == file_space_id)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "null argument array")
+
+    if(NULL == (ops = (H5D_multi_io_t *)H5MM_malloc(count * sizeof(H5D_multi_io_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for multi-dataset I/O")
+
+    for(u = 0; u < count; u++) {
+        H5D_t *dset;                    /* Dataset for this operation */
+        const H5T_t *mem_type;          /* Memory datatype for this operation */
+        const H5O_storage_t *storage;   /* Dataset's raw data storage */
+
+	if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+	    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a dataset")
+	if(NULL == dset->oloc.file)
+	    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a dataset")
+	if(NULL == (mem_type = (const H5T_t *)H5I_object_verify(mem_type_id[u], H5I_DATATYPE)))
+	    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a datatype")
+	if(mem_space_id[u] < 0 || file_space_id[u] < 0)
+	    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a dataspace")
+
+        /* Check that the data can be converted */
+        if(NULL == (do_write ? H5T_path_find(mem_type, dset->shared->type, NULL, NULL, dxpl_id, FALSE)
+                : H5T_path_find(dset->shared->type, mem_type, NULL, NULL, dxpl_id, FALSE)))
+	    HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, NULL, "unable to convert between src and dest datatype")
+
+        ops[u].dset = dset;
+        ops[u].mem_type_id = mem_type_id[u];
+        ops[u].mem_space = NULL;
+        ops[u].file_space = NULL;
+        ops[u].idx = u;
+
+	if(H5S_ALL != mem_space_id[u]) {
+	    if(NULL == (ops[u].mem_space = (const H5S_t *)H5I_object_verify(mem_space_id[u], H5I_DATASPACE)))
+	        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a dataspace")
+
+	    /* Check for valid selection */
+	    if(H5S_SELECT_VALID(ops[u].mem_space) != TRUE)
+		HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, NULL, "memory selection+offset not within extent")
+	} /* end if */
+	if(H5S_ALL != file_space_id[u]) {
+	    if(NULL == (ops[u].file_space = (const H5S_t *)H5I_object_verify(file_space_id[u], H5I_DATASPACE)))
+		HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a dataspace")
+
+	    /* Check for valid selection */
+	    if(H5S_SELECT_VALID(ops[u].file_space) != TRUE)
+		HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, NULL, "file selection+offset not within extent")
+	} /* end if */
+
+        /* Get the address to order this dataset's I/O on */
+        storage = &dset->shared->layout.storage;
+        switch(storage->type) {
+            case H5D_CONTIGUOUS:
+                ops[u].addr = storage->u.contig.addr;
+                break;
+
+            case H5D_CHUNKED:
+                ops[u].addr = storage->u.chunk.idx_addr;
+                break;
+
+            case H5D_COMPACT:
+            case H5D_LAYOUT_ERROR:
+            case H5D_NLAYOUTS:
+            default:
+                /* Compact data lives in the object header */
+                ops[u].addr = dset->oloc.addr;
+                break;
+        } /* end switch */
+    } /* end for */
+
+    /* Sort the operations on storage address */
+    if(count > 1)
+        HDqsort(ops, count, sizeof(H5D_multi_io_t), H5D__multi_cmp);
+
+    /* Set return value */
+    ret_value = ops;
+
+done:
+    if(NULL == ret_value)
+        H5MM_xfree(ops);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_cmp
+ *
+ * Purpose:	Compare two multi-dataset I/O operations on file address,
+ *		and then on the order the caller gave them, so that
+ *		operations on the same dataset keep their relative order.
+ *
+ * Return:	-1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__multi_cmp(const void *_op1, const void *_op2)
+{
+    const H5D_multi_io_t *op1 = (const H5D_multi_io_t *)_op1;
+    const H5D_multi_io_t *op2 = (const H5D_multi_io_t *)_op2;
+    int ret_value;                      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Compare the raw values, so that datasets without storage allocated
+     * yet (HADDR_UNDEF) consistently sort last */
+    if(op1->addr < op2->addr)
+        ret_value = -1;
+    else if(op1->addr > op2->addr)
+        ret_value = 1;
+    else if(op1->idx < op2->idx)
+        ret_value = -1;
+    else if(op1->idx > op2->idx)
+        ret_value = 1;
+    else
+        ret_value = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_cmp() */
+
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__pre_read
+ *
+ * Purpose:	Preparation for reading data.  A direct chunk read returns
+ *		the chunk's filter mask in the data transfer property list.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__pre_read(H5D_t *dset, hbool_t direct_read, hid_t mem_type_id,
+         const H5S_t *mem_space, const H5S_t *file_space,
+         hid_t dxpl_id, void *buf/*out*/)
+{
+    herr_t                  ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Direct chunk read */
+    if(direct_read) {
+        H5P_genplist_t *plist;      /* Property list pointer */
+        hsize_t *direct_offset;
+        size_t direct_buf_size;
+        uint32_t direct_filters = 0;
+
+        /* Get the dataset transfer property list */
+        if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset transfer property list")
+
+        if(H5D_CHUNKED != dset->shared->layout.type)
+	    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+        /* Retrieve parameters for direct chunk read */
+        if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_READ_OFFSET_NAME, &direct_offset) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting offset info for direct chunk read")
+        if(NULL == direct_offset)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no offset for direct chunk read")
+        if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_READ_BUF_SIZE_NAME, &direct_buf_size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting buffer size for direct chunk read")
+
+	/* read raw data */
+	if(H5D__chunk_direct_read(dset, dxpl_id, direct_offset, &direct_filters, direct_buf_size, buf) < 0)
+	    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read chunk directly")
+
+        /* Return the chunk's filter mask */
+        if(H5P_set(plist, H5D_XFER_DIRECT_CHUNK_READ_FILTERS_NAME, &direct_filters) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "error setting filter mask for direct chunk read")
+    } /* end if */
+    else {     /* Normal read */
+        /* read raw data */
+        if(H5D__read(dset, mem_type_id, mem_space, file_space, dxpl_id, buf/*out*/) < 0)
+	    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__pre_read() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__pre_write
  *
@@ -302,6 +700,7 @@ H5D__pre_write(H5D_t *dset, hbool_t direct_write, hid_t mem_type_id,
         uint32_t direct_filters;
         hsize_t *direct_offset;
         uint32_t direct_datasize;
+        size_t direct_count;
 	hsize_t  internal_offset[H5O_LAYOUT_NDIMS];
 	unsigned u;                 /* Local index variable */
 
@@ -312,6 +711,44 @@ H5D__pre_write(H5D_t *dset, hbool_t direct_write, hid_t mem_type_id,
         if(H5D_CHUNKED != dset->shared->layout.type)
 	    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
 
+        /* Check for a batch of chunks */
+        if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_WRITE_COUNT_NAME, &direct_count) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting chunk count for direct chunk write")
+        if(direct_count > 0) {
+            const uint32_t *filters_list;
+            const hsize_t *const *offset_list;
+            const size_t *datasize_list;
+            size_t v;               /* Local index variable */
+
+            /* Retrieve parameters for batched direct chunk write */
+            if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_LIST_NAME, &filters_list) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting filter info for direct chunk write")
+            if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_LIST_NAME, &offset_list) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting offset info for direct chunk write")
+            if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_LIST_NAME, &datasize_list) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting data size for direct chunk write")
+            if(NULL == filters_list || NULL == offset_list || NULL == datasize_list || NULL == buf)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null argument array for direct chunk write")
+
+            /* Make sure each offset names a chunk in the dataset */
+            for(v = 0; v < direct_count; v++) {
+                if(NULL == offset_list[v])
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no offset for direct chunk write")
+                for(u = 0; u < dset->shared->ndims; u++) {
+                    if(offset_list[v][u] >= dset->shared->curr_dims[u])
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "offset exceeds dimensions of dataset")
+                    if(offset_list[v][u] % dset->shared->layout.u.chunk.dim[u])
+                        HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "offset doesn't fall on chunks's boundary")
+                } /* end for */
+            } /* end for */
+
+            /* write raw data */
+            if(H5D__chunk_direct_write_multi(dset, dxpl_id, direct_count, filters_list, offset_list, datasize_list, (const void *const *)buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write chunks directly")
+
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
         /* Retrieve parameters for direct chunk write */
         if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_NAME, &direct_filters) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting filter info for direct chunk write")
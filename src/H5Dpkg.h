@@ -375,6 +375,11 @@ typedef struct H5D_rdcc_t {
     size_t		nbytes_max; /* Maximum cached raw data in bytes	*/
     size_t		nslots;	/* Number of chunk slots allocated	*/
     double		w0;     /* Chunk preemption policy          */
+    struct {
+        double          max_ratio;  /* Filtered/unfiltered size of an incompressible chunk */
+        unsigned        nchunks;    /* Chunks to write without optional filters after one */
+        unsigned        nleft;      /* Chunks left to write without them */
+    } filter_skip;
     struct H5D_rdcc_ent_t *head; /* Head of doubly linked list		*/
     struct H5D_rdcc_ent_t *tail; /* Tail of doubly linked list		*/
     size_t		nbytes_used; /* Current cached raw data in bytes */
@@ -642,6 +647,19 @@ H5_DLL herr_t H5D__chunk_delete(H5F_t *f, hid_t dxpl_id, H5O_t *oh,
     H5O_storage_t *store);
 H5_DLL herr_t H5D__chunk_direct_write(const H5D_t *dset, hid_t dxpl_id, uint32_t filters, 
          hsize_t *offset, uint32_t data_size, const void *buf);
+H5_DLL herr_t H5D__chunk_direct_write_multi(const H5D_t *dset, hid_t dxpl_id,
+    size_t count, const uint32_t filters[], const hsize_t *const offset[],
+    const size_t data_size[], const void *const buf[]);
+H5_DLL herr_t H5D__chunk_direct_read(const H5D_t *dset, hid_t dxpl_id,
+    const hsize_t *offset, uint32_t *filters, size_t buf_size, void *buf);
+H5_DLL herr_t H5D__chunk_get_info_by_coord(const H5D_t *dset, hid_t dxpl_id,
+    const hsize_t *offset, unsigned *filter_mask, haddr_t *addr, hsize_t *size);
+H5_DLL herr_t H5D__chunk_iter(const H5D_t *dset, hid_t dxpl_id,
+    H5D_chunk_iter_op_t op, void *op_data);
+H5_DLL herr_t H5D__chunk_get_num_chunks(const H5D_t *dset, hid_t dxpl_id,
+    hsize_t *nchunks);
+H5_DLL herr_t H5D__chunk_get_info(const H5D_t *dset, hid_t dxpl_id, hsize_t chunk_idx,
+    hsize_t *offset, unsigned *filter_mask, haddr_t *addr, hsize_t *size);
 #ifdef H5D_CHUNK_DEBUG
 H5_DLL herr_t H5D__chunk_stats(const H5D_t *dset, hbool_t headers);
 #endif /* H5D_CHUNK_DEBUG */
@@ -52,6 +52,8 @@
 #define H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME   "rdcc_nslots"   /* Size of raw data chunk cache(slots) */
 #define H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME   "rdcc_nbytes"   /* Size of raw data chunk cache(bytes) */
 #define H5D_ACS_PREEMPT_READ_CHUNKS_NAME    "rdcc_w0"       /* Preemption read chunks first */
+#define H5D_ACS_FILTER_SKIP_RATIO_NAME      "filter_skip_ratio"     /* Filtered size ratio of an incompressible chunk */
+#define H5D_ACS_FILTER_SKIP_NCHUNKS_NAME    "filter_skip_nchunks"   /* Chunks written without optional filters after one */
 
 /* ======== Data transfer properties ======== */
 #define H5D_XFER_MAX_TEMP_BUF_NAME      "max_temp_buf"  /* Maximum temp buffer size */
@@ -39,6 +39,18 @@
 #define H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_NAME	"direct_chunk_filters"
 #define H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_NAME		"direct_chunk_offset"
 #define H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_NAME	"direct_chunk_datasize"
+
+/* Property names for H5DOwrite_chunks */
+#define H5D_XFER_DIRECT_CHUNK_WRITE_COUNT_NAME		"direct_chunk_count"
+#define H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_LIST_NAME	"direct_chunk_filters_list"
+#define H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_LIST_NAME	"direct_chunk_offset_list"
+#define H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_LIST_NAME	"direct_chunk_datasize_list"
+
+/* Property names for H5DOread_chunk */
+#define H5D_XFER_DIRECT_CHUNK_READ_FLAG_NAME		"direct_chunk_read_flag"
+#define H5D_XFER_DIRECT_CHUNK_READ_OFFSET_NAME		"direct_chunk_read_offset"
+#define H5D_XFER_DIRECT_CHUNK_READ_BUF_SIZE_NAME	"direct_chunk_read_buf_size"
+#define H5D_XFER_DIRECT_CHUNK_READ_FILTERS_NAME		"direct_chunk_read_filters"
  
 /*******************/
 /* Public Typedefs */
@@ -117,6 +129,10 @@ typedef herr_t (*H5D_scatter_func_t)(const void **src_buf/*out*/,
 typedef herr_t (*H5D_gather_func_t)(const void *dst_buf,
                                     size_t dst_buf_bytes_used, void *op_data);
 
+/* Define the operator function pointer for H5Dchunk_iter() */
+typedef int (*H5D_chunk_iter_op_t)(const hsize_t *offset, unsigned filter_mask,
+                                   haddr_t addr, hsize_t size, void *op_data);
+
 H5_DLL hid_t H5Dcreate2(hid_t loc_id, const char *name, hid_t type_id,
     hid_t space_id, hid_t lcpl_id, hid_t dcpl_id, hid_t dapl_id);
 H5_DLL hid_t H5Dcreate_anon(hid_t file_id, hid_t type_id, hid_t space_id,
@@ -130,10 +146,24 @@ H5_DLL hid_t H5Dget_create_plist(hid_t dset_id);
 H5_DLL hid_t H5Dget_access_plist(hid_t dset_id);
 H5_DLL hsize_t H5Dget_storage_size(hid_t dset_id);
 H5_DLL haddr_t H5Dget_offset(hid_t dset_id);
+H5_DLL herr_t H5Dget_chunk_storage_size(hid_t dset_id, const hsize_t *offset,
+    hsize_t *chunk_nbytes);
+H5_DLL herr_t H5Dget_chunk_info_by_coord(hid_t dset_id, const hsize_t *offset,
+    unsigned *filter_mask, haddr_t *addr, hsize_t *size);
+H5_DLL herr_t H5Dget_num_chunks(hid_t dset_id, hsize_t *nchunks);
+H5_DLL herr_t H5Dget_chunk_info(hid_t dset_id, hsize_t chunk_idx, hsize_t *offset,
+    unsigned *filter_mask, haddr_t *addr, hsize_t *size);
+H5_DLL herr_t H5Dchunk_iter(hid_t dset_id, H5D_chunk_iter_op_t op, void *op_data);
 H5_DLL herr_t H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			hid_t file_space_id, hid_t plist_id, void *buf/*out*/);
 H5_DLL herr_t H5Dwrite(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			 hid_t file_space_id, hid_t plist_id, const void *buf);
+H5_DLL herr_t H5Dread_multi(size_t count, const hid_t dset_id[],
+    const hid_t mem_type_id[], const hid_t mem_space_id[],
+    const hid_t file_space_id[], hid_t dxpl_id, void *buf[]/*out*/);
+H5_DLL herr_t H5Dwrite_multi(size_t count, const hid_t dset_id[],
+    const hid_t mem_type_id[], const hid_t mem_space_id[],
+    const hid_t file_space_id[], hid_t dxpl_id, const void *buf[]);
 H5_DLL herr_t H5Diterate(void *buf, hid_t type_id, hid_t space_id,
             H5D_operator_t op, void *operator_data);
 H5_DLL herr_t H5Dvlen_reclaim(hid_t type_id, hid_t space_id, hid_t plist_id, void *buf);
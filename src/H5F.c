@@ -1478,3 +1478,82 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Fclear_elink_file_cache() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_stats
+ *
+ * Purpose:     Retrieves the statistics collected for a file since it was
+ *              opened or since the last call to H5Freset_stats.  The
+ *              statistics are shared by all IDs open on the file.
+ *              Collection must have been turned on with
+ *              H5Pset_collect_stats or the HDF5_STATS environment
+ *              variable when the file was opened.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_stats(hid_t file_id, H5F_stats_t *stats)
+{
+    H5F_t       *file;                  /* File */
+    int64_t     mdc_hits, mdc_accesses; /* Metadata cache totals */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", file_id, stats);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(NULL == stats)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no statistics buffer")
+    if(NULL == file->shared->stats)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "statistics not collected for file")
+
+    /* Metadata cache hits are counted by the cache itself */
+    if(H5AC_get_cache_hit_totals(file->shared->cache, &mdc_hits, &mdc_accesses) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't get metadata cache totals")
+    file->shared->stats->mdc.hits = (hsize_t)(mdc_hits - file->shared->mdc_hits_base);
+    file->shared->stats->mdc.misses = (hsize_t)((mdc_accesses - file->shared->mdc_accesses_base) -
+            (mdc_hits - file->shared->mdc_hits_base));
+
+    *stats = *file->shared->stats;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Fget_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Freset_stats
+ *
+ * Purpose:     Zeroes the statistics collected for a file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Freset_stats(hid_t file_id)
+{
+    H5F_t       *file;                  /* File */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", file_id);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(NULL == file->shared->stats)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "statistics not collected for file")
+
+    if(H5AC_get_cache_hit_totals(file->shared->cache, &file->shared->mdc_hits_base, &file->shared->mdc_accesses_base) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't get metadata cache totals")
+    HDmemset(file->shared->stats, 0, sizeof(H5F_stats_t));
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Freset_stats() */
+
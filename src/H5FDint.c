@@ -187,10 +187,14 @@ H5FD_read(H5FD_t *file, const H5P_genplist_t *dxpl, H5FD_mem_t type, haddr_t add
     size_t size, void *buf/*out*/)
 {
     haddr_t     eoa = HADDR_UNDEF;
+    TRACE_EVENT_VARS
     herr_t      ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    /* Record the trace event for entering this routine */
+    BEGIN_TRACE_EVENT
+
     HDassert(file && file->cls);
     HDassert(TRUE == H5P_class_isa(H5P_CLASS(dxpl), H5P_CLS_DATASET_XFER_g));
     HDassert(buf);
@@ -214,6 +218,7 @@ H5FD_read(H5FD_t *file, const H5P_genplist_t *dxpl, H5FD_mem_t type, haddr_t add
         HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read request failed")
 
 done:
+    FINISH_TRACE_EVENT
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_read() */
 
@@ -236,10 +241,14 @@ H5FD_write(H5FD_t *file, const H5P_genplist_t *dxpl, H5FD_mem_t type, haddr_t ad
     size_t size, const void *buf)
 {
     haddr_t     eoa = HADDR_UNDEF;
+    TRACE_EVENT_VARS
     herr_t      ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    /* Record the trace event for entering this routine */
+    BEGIN_TRACE_EVENT
+
     HDassert(file && file->cls);
     HDassert(TRUE == H5P_class_isa(H5P_CLASS(dxpl), H5P_CLS_DATASET_XFER_g));
     HDassert(buf);
@@ -263,6 +272,7 @@ H5FD_write(H5FD_t *file, const H5P_genplist_t *dxpl, H5FD_mem_t type, haddr_t ad
         HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write request failed")
 
 done:
+    FINISH_TRACE_EVENT
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_write() */
 
@@ -156,6 +156,7 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
     H5P_genplist_t *old_plist;              /* Old property list */
     void		*driver_info=NULL;
     unsigned            efc_size = 0;
+    hbool_t             collect_stats;
     hid_t		ret_value = SUCCEED;
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -198,6 +199,9 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
         efc_size = H5F_efc_max_nfiles(f->shared->efc);
     if(H5P_set(new_plist, H5F_ACS_EFC_SIZE_NAME, &efc_size) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't set elink file cache size")
+    collect_stats = (hbool_t)(f->shared->stats != NULL);
+    if(H5P_set(new_plist, H5F_ACS_COLLECT_STATS_NAME, &collect_stats) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set statistics collection flag")
 
     /*
      * Since we're resetting the driver ID and info, close them if they
@@ -596,6 +600,7 @@ H5F_new(H5F_file_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5FD_t
     else {
         H5P_genplist_t *plist;          /* Property list */
         unsigned        efc_size;       /* External file cache size */
+        hbool_t         collect_stats;  /* Whether to collect statistics */
         size_t u;                       /* Local index variable */
 
         HDassert(lf != NULL);
@@ -664,6 +669,11 @@ H5F_new(H5F_file_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5FD_t
         if(efc_size > 0)
             if(NULL == (f->shared->efc = H5F_efc_create(efc_size)))
                 HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "can't create external file cache")
+        if(H5P_get(plist, H5F_ACS_COLLECT_STATS_NAME, &collect_stats) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get statistics collection flag")
+        if(collect_stats || H5_stats_env_g)
+            if(NULL == (f->shared->stats = (H5F_stats_t *)H5MM_calloc(sizeof(H5F_stats_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "can't allocate file statistics")
 
         /* Get the VFD values to cache */
         f->shared->maxaddr = H5FD_get_maxaddr(lf);
@@ -720,6 +730,7 @@ done:
             if(f->shared->efc)
                 if(H5F_efc_destroy(f->shared->efc) < 0)
                     HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, NULL, "can't destroy external file cache")
+            f->shared->stats = (H5F_stats_t *)H5MM_xfree(f->shared->stats);
             if(f->shared->fcpl_id > 0)
                 if(H5I_dec_ref(f->shared->fcpl_id) < 0)
                     HDONE_ERROR(H5E_FILE, H5E_CANTDEC, NULL, "can't close property list")
@@ -874,6 +885,9 @@ H5F_dest(H5F_t *f, hid_t dxpl_id, hbool_t flush)
         f->shared->mtab.child = (H5F_mount_t *)H5MM_xfree(f->shared->mtab.child);
         f->shared->mtab.nalloc = 0;
 
+        /* Free statistics */
+        f->shared->stats = (H5F_stats_t *)H5MM_xfree(f->shared->stats);
+
         /* Destroy shared file struct */
         f->shared = (H5F_file_t *)H5FL_FREE(H5F_file_t, f->shared);
 
@@ -293,6 +293,11 @@ struct H5F_file_t {
 
     /* Metadata accumulator information */
     H5F_meta_accum_t accum;     /* Metadata accumulator info           	*/
+
+    /* Statistics, when collected (see H5Pset_collect_stats) */
+    H5F_stats_t *stats;         /* Statistics for file, or NULL         */
+    int64_t     mdc_hits_base;  /* Metadata cache hits at last reset    */
+    int64_t     mdc_accesses_base; /* Metadata cache accesses at last reset */
 };
 
 /*
@@ -170,6 +170,31 @@ typedef enum H5F_file_space_type_t {
     H5F_FILE_SPACE_NTYPES	    /* must be last */
 } H5F_file_space_type_t;
 
+/* I/O requests issued to the file driver for one type of file memory */
+typedef struct H5F_io_stats_t {
+    hsize_t     read_ops;       /* Number of read requests */
+    hsize_t     read_bytes;     /* Number of bytes read */
+    hsize_t     write_ops;      /* Number of write requests */
+    hsize_t     write_bytes;    /* Number of bytes written */
+} H5F_io_stats_t;
+
+/* Statistics collected for an open file (see H5Pset_collect_stats) */
+typedef struct H5F_stats_t {
+    H5F_io_stats_t vfd[H5FD_MEM_NTYPES];    /* File driver I/O, by type of file memory */
+    struct {
+        hsize_t hits;           /* Chunks found in a dataset's chunk cache */
+        hsize_t misses;         /* Chunks read from the file */
+    } chunk_cache;
+    struct {
+        hsize_t hits;           /* Metadata cache hits */
+        hsize_t misses;         /* Metadata cache misses */
+    } mdc;
+    struct {
+        hsize_t calls;          /* Number of raw data filter pipeline runs */
+        double  time;           /* Seconds spent in the filter pipeline */
+    } filter;
+} H5F_stats_t;
+
 
 #ifdef __cplusplus
 extern "C" {
@@ -211,6 +236,8 @@ H5_DLL herr_t H5Fget_info2(hid_t obj_id, H5F_info2_t *finfo);
 H5_DLL ssize_t H5Fget_free_sections(hid_t file_id, H5F_mem_t type,
     size_t nsects, H5F_sect_info_t *sect_info/*out*/);
 H5_DLL herr_t H5Fclear_elink_file_cache(hid_t file_id);
+H5_DLL herr_t H5Fget_stats(hid_t file_id, H5F_stats_t *stats /*out*/);
+H5_DLL herr_t H5Freset_stats(hid_t file_id);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5Fset_mpi_atomicity(hid_t file_id, hbool_t flag);
 H5_DLL herr_t H5Fget_mpi_atomicity(hid_t file_id, hbool_t *flag);
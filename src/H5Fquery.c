@@ -777,6 +777,56 @@ H5F_gc_ref(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->gc_ref)
 } /* end H5F_gc_ref() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_get_alignment
+ *
+ * Purpose:	Retrieve the alignment of file space allocations, set with
+ *		H5Pset_alignment().
+ *
+ * Return:	Success:	The alignment (0 or 1 for none)
+ *
+ * 		Failure:	(can't happen)
+ *
+ *-------------------------------------------------------------------------
+ */
+hsize_t
+H5F_get_alignment(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->alignment)
+} /* end H5F_get_alignment() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_get_threshold
+ *
+ * Purpose:	Retrieve the size at and above which file space allocations
+ *		are aligned, set with H5Pset_alignment().
+ *
+ * Return:	Success:	The alignment threshold
+ *
+ * 		Failure:	(can't happen)
+ *
+ *-------------------------------------------------------------------------
+ */
+hsize_t
+H5F_get_threshold(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->threshold)
+} /* end H5F_get_threshold() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_use_latest_format
@@ -1073,3 +1123,28 @@ H5F_use_tmp_space(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->use_tmp_space)
 } /* end H5F_use_tmp_space() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_get_stats
+ *
+ * Purpose:	Quick and dirty routine to retrieve the file's statistics
+ *		(Mainly added to stop non-file routines from poking about in the
+ *		H5F_t data structure)
+ *
+ * Return:	Pointer to statistics, or NULL when they aren't collected
+ *		for this file (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5F_stats_t *
+H5F_get_stats(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->stats)
+} /* end H5F_get_stats() */
+
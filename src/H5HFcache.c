@@ -1659,7 +1659,7 @@ H5HF__cache_dblock_deserialize(const void *_image, size_t len, void *_udata,
         /* Push direct block data through I/O filter pipeline */
         nbytes = read_size;
         filter_mask = udata->filter_mask;
-        if(H5Z_pipeline(&(hdr->pline), H5Z_FLAG_REVERSE, &filter_mask, H5Z_ENABLE_EDC, filter_cb, &nbytes, &read_size, &read_buf) < 0)
+        if(H5Z_pipeline(&(hdr->pline), H5Z_FLAG_REVERSE, &filter_mask, H5Z_ENABLE_EDC, filter_cb, (size_t)dblock->size, &nbytes, &read_size, &read_buf, NULL) < 0)
             HGOTO_ERROR(H5E_HEAP, H5E_CANTFILTER, NULL, "output pipeline failed")
 
         /* Sanity check */
@@ -2048,7 +2048,7 @@ H5HF__cache_dblock_pre_serialize(const H5F_t *f, hid_t dxpl_id, void *_thing,
 
         /* Push direct block data through I/O filter pipeline */
         nbytes = write_size;
-        if(H5Z_pipeline(&(hdr->pline), 0, &filter_mask, H5Z_ENABLE_EDC, filter_cb, &nbytes, &write_size, &write_buf) < 0)
+        if(H5Z_pipeline(&(hdr->pline), 0, &filter_mask, H5Z_ENABLE_EDC, filter_cb, (size_t)0, &nbytes, &write_size, &write_buf, NULL) < 0)
             HGOTO_ERROR(H5E_HEAP, H5E_WRITEERROR, FAIL, "output pipeline failed")
 
         /* Use the compressed number of bytes as the size to write */
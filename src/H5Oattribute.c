@@ -1376,6 +1376,77 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O_attr_iterate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O_attr_build_table
+ *
+ * Purpose:	Builds a table of all the attributes of an object, sorted
+ *              on an index, in one pass over the object header or the
+ *              dense attribute storage.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O_attr_build_table(const H5O_loc_t *loc, hid_t dxpl_id, H5_index_t idx_type,
+    H5_iter_order_t order, H5A_attr_table_t *atable)
+{
+    H5O_t *oh = NULL;                   /* Pointer to actual object header */
+    H5O_ainfo_t ainfo;                  /* Attribute information for object */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(dxpl_id, loc->addr, FAIL)
+
+    /* Check arguments */
+    HDassert(loc);
+    HDassert(loc->file);
+    HDassert(H5F_addr_defined(loc->addr));
+    HDassert(atable);
+
+    /* Protect the object header to read the attributes from */
+    if(NULL == (oh = H5O_protect(loc, dxpl_id, H5AC__READ_ONLY_FLAG)))
+	HGOTO_ERROR(H5E_ATTR, H5E_CANTPROTECT, FAIL, "unable to load object header")
+
+    /* Check for attribute info stored */
+    ainfo.fheap_addr = HADDR_UNDEF;
+    if(oh->version > H5O_VERSION_1) {
+        /* Check for (& retrieve if available) attribute info */
+        if(H5A_get_ainfo(loc->file, dxpl_id, oh, &ainfo) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't check for attribute info message")
+    } /* end if */
+
+    /* Check for attributes stored densely */
+    if(H5F_addr_defined(ainfo.fheap_addr)) {
+        /* Release the object header */
+        if(H5O_unprotect(loc, dxpl_id, oh, H5AC__NO_FLAGS_SET) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+        oh = NULL;
+
+        /* Build table of attributes for dense storage */
+        if(H5A_dense_build_table(loc->file, dxpl_id, &ainfo, idx_type, order, atable) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "error building attribute table")
+    } /* end if */
+    else {
+        /* Build table of attributes for compact storage */
+        if(H5A_compact_build_table(loc->file, dxpl_id, oh, idx_type, order, atable) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "error building attribute table")
+    } /* end else */
+
+    /* Mark the datatypes as being on disk now, as opening an attribute does */
+    for(u = 0; u < atable->nattrs; u++)
+        if(H5T_set_loc(atable->attrs[u]->shared->dt, loc->file, H5T_LOC_DISK) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "invalid datatype location")
+
+done:
+    /* Release resources */
+    if(oh && H5O_unprotect(loc, dxpl_id, oh, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5O_attr_build_table() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5O_attr_remove_update
@@ -61,6 +61,16 @@
 #define H5D_ACS_PREEMPT_READ_CHUNKS_DEF         H5D_CHUNK_CACHE_W0_DEFAULT
 #define H5D_ACS_PREEMPT_READ_CHUNKS_ENC         H5P__encode_double
 #define H5D_ACS_PREEMPT_READ_CHUNKS_DEC         H5P__decode_double
+/* Definition for the ratio at which optional filters are skipped */
+#define H5D_ACS_FILTER_SKIP_RATIO_SIZE          sizeof(double)
+#define H5D_ACS_FILTER_SKIP_RATIO_DEF           1.0F
+#define H5D_ACS_FILTER_SKIP_RATIO_ENC           H5P__encode_double
+#define H5D_ACS_FILTER_SKIP_RATIO_DEC           H5P__decode_double
+/* Definition for the number of chunks optional filters are skipped on */
+#define H5D_ACS_FILTER_SKIP_NCHUNKS_SIZE        sizeof(unsigned)
+#define H5D_ACS_FILTER_SKIP_NCHUNKS_DEF         0
+#define H5D_ACS_FILTER_SKIP_NCHUNKS_ENC         H5P__encode_unsigned
+#define H5D_ACS_FILTER_SKIP_NCHUNKS_DEC         H5P__decode_unsigned
 
 /******************/
 /* Local Typedefs */
@@ -133,6 +143,8 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
     size_t rdcc_nslots = H5D_ACS_DATA_CACHE_NUM_SLOTS_DEF;      /* Default raw data chunk cache # of slots */
     size_t rdcc_nbytes = H5D_ACS_DATA_CACHE_BYTE_SIZE_DEF;      /* Default raw data chunk cache # of bytes */
     double rdcc_w0 = H5D_ACS_PREEMPT_READ_CHUNKS_DEF;           /* Default raw data chunk cache dirty ratio */
+    double skip_ratio = H5D_ACS_FILTER_SKIP_RATIO_DEF;          /* Default filter skip ratio */
+    unsigned skip_nchunks = H5D_ACS_FILTER_SKIP_NCHUNKS_DEF;    /* Default # of chunks to skip filters on */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_STATIC
@@ -152,6 +164,16 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
              NULL, NULL, NULL, H5D_ACS_PREEMPT_READ_CHUNKS_ENC, H5D_ACS_PREEMPT_READ_CHUNKS_DEC, NULL, NULL, NULL, NULL) < 0)
          HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the ratio at which optional filters are skipped */
+    if(H5P_register_real(pclass, H5D_ACS_FILTER_SKIP_RATIO_NAME, H5D_ACS_FILTER_SKIP_RATIO_SIZE, &skip_ratio,
+             NULL, NULL, NULL, H5D_ACS_FILTER_SKIP_RATIO_ENC, H5D_ACS_FILTER_SKIP_RATIO_DEC, NULL, NULL, NULL, NULL) < 0)
+         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the number of chunks optional filters are skipped on */
+    if(H5P_register_real(pclass, H5D_ACS_FILTER_SKIP_NCHUNKS_NAME, H5D_ACS_FILTER_SKIP_NCHUNKS_SIZE, &skip_nchunks,
+             NULL, NULL, NULL, H5D_ACS_FILTER_SKIP_NCHUNKS_ENC, H5D_ACS_FILTER_SKIP_NCHUNKS_DEC, NULL, NULL, NULL, NULL) < 0)
+         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dacc_reg_prop() */
@@ -284,3 +306,90 @@ done:
     FUNC_LEAVE_API(ret_value)
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_filter_skip
+ *
+ * Purpose:	Sets up adaptive skipping of the optional filters of a
+ *		chunked dataset's pipeline for incompressible data.
+ *
+ *		Each chunk written through the optional filters is a sample
+ *		of the data's compressibility.  If the filtered chunk is
+ *		larger than MAX_RATIO times its unfiltered size, or all
+ *		optional filters failed on it, the next NCHUNKS chunks
+ *		written are stored without the optional filters, as though
+ *		they had failed, and the chunk after that is sampled again.
+ *		The filters skipped are recorded in each chunk's filter mask.
+ *
+ *		An NCHUNKS value of zero, the default, always applies the
+ *		optional filters.  MAX_RATIO must be greater than zero and no
+ *		greater than one.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_filter_skip(hid_t dapl_id, double max_ratio, unsigned nchunks)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "idIu", dapl_id, max_ratio, nchunks);
+
+    /* Check arguments */
+    if(!(max_ratio > (double)0.0f && max_ratio <= (double)1.0f))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "filter skip ratio must be greater than 0.0 and at most 1.0")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set values */
+    if(H5P_set(plist, H5D_ACS_FILTER_SKIP_RATIO_NAME, &max_ratio) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set filter skip ratio")
+    if(H5P_set(plist, H5D_ACS_FILTER_SKIP_NCHUNKS_NAME, &nchunks) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set filter skip chunk count")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_filter_skip() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_filter_skip
+ *
+ * Purpose:	Retrieves the settings for adaptive skipping of optional
+ *		filters made with H5Pset_filter_skip.  Either argument may
+ *		be a null pointer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_filter_skip(hid_t dapl_id, double *max_ratio, unsigned *nchunks)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "i*d*Iu", dapl_id, max_ratio, nchunks);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get values */
+    if(max_ratio)
+        if(H5P_get(plist, H5D_ACS_FILTER_SKIP_RATIO_NAME, max_ratio) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get filter skip ratio")
+    if(nchunks)
+        if(H5P_get(plist, H5D_ACS_FILTER_SKIP_NCHUNKS_NAME, nchunks) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get filter skip chunk count")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_filter_skip() */
+
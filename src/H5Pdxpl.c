@@ -167,6 +167,24 @@
 #define H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_DEF		NULL
 #define H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_SIZE	sizeof(uint32_t)
 #define H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_DEF	0
+/* Definitions for properties of batched direct chunk write */
+#define H5D_XFER_DIRECT_CHUNK_WRITE_COUNT_SIZE		sizeof(size_t)
+#define H5D_XFER_DIRECT_CHUNK_WRITE_COUNT_DEF		0
+#define H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_LIST_SIZE	sizeof(uint32_t *)
+#define H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_LIST_DEF	NULL
+#define H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_LIST_SIZE	sizeof(hsize_t **)
+#define H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_LIST_DEF	NULL
+#define H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_LIST_SIZE	sizeof(size_t *)
+#define H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_LIST_DEF	NULL
+/* Definitions for properties of direct chunk read */
+#define H5D_XFER_DIRECT_CHUNK_READ_FLAG_SIZE		sizeof(hbool_t)
+#define H5D_XFER_DIRECT_CHUNK_READ_FLAG_DEF		FALSE
+#define H5D_XFER_DIRECT_CHUNK_READ_OFFSET_SIZE		sizeof(hsize_t *)
+#define H5D_XFER_DIRECT_CHUNK_READ_OFFSET_DEF		NULL
+#define H5D_XFER_DIRECT_CHUNK_READ_BUF_SIZE_SIZE	sizeof(size_t)
+#define H5D_XFER_DIRECT_CHUNK_READ_BUF_SIZE_DEF		0
+#define H5D_XFER_DIRECT_CHUNK_READ_FILTERS_SIZE		sizeof(uint32_t)
+#define H5D_XFER_DIRECT_CHUNK_READ_FILTERS_DEF		0
 
 /******************/
 /* Local Typedefs */
@@ -271,6 +289,14 @@ static const hbool_t H5D_def_direct_chunk_flag_g = H5D_XFER_DIRECT_CHUNK_WRITE_F
 static const uint32_t H5D_def_direct_chunk_filters_g = H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_DEF;	/* Default value for the filters of direct chunk write */
 static const hsize_t *H5D_def_direct_chunk_offset_g = H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_DEF; 	/* Default value for the offset of direct chunk write */
 static const uint32_t H5D_def_direct_chunk_datasize_g = H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_DEF; /* Default value for the datasize of direct chunk write */
+static const size_t H5D_def_direct_chunk_count_g = H5D_XFER_DIRECT_CHUNK_WRITE_COUNT_DEF;	/* Default value for the number of chunks of batched direct chunk write */
+static const uint32_t *H5D_def_direct_chunk_filters_list_g = H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_LIST_DEF;	/* Default value for the filters of batched direct chunk write */
+static const hsize_t **H5D_def_direct_chunk_offset_list_g = H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_LIST_DEF;	/* Default value for the offsets of batched direct chunk write */
+static const size_t *H5D_def_direct_chunk_datasize_list_g = H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_LIST_DEF;	/* Default value for the datasizes of batched direct chunk write */
+static const hbool_t H5D_def_direct_chunk_read_flag_g = H5D_XFER_DIRECT_CHUNK_READ_FLAG_DEF; 	/* Default value for the flag of direct chunk read */
+static const hsize_t *H5D_def_direct_chunk_read_offset_g = H5D_XFER_DIRECT_CHUNK_READ_OFFSET_DEF; 	/* Default value for the offset of direct chunk read */
+static const size_t H5D_def_direct_chunk_read_buf_size_g = H5D_XFER_DIRECT_CHUNK_READ_BUF_SIZE_DEF;	/* Default value for the buffer size of direct chunk read */
+static const uint32_t H5D_def_direct_chunk_read_filters_g = H5D_XFER_DIRECT_CHUNK_READ_FILTERS_DEF;	/* Default value for the filters of direct chunk read */
 
 
 /*-------------------------------------------------------------------------
@@ -465,6 +491,54 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the property of chunk count for batched direct chunk write */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P_register_real(pclass, H5D_XFER_DIRECT_CHUNK_WRITE_COUNT_NAME, H5D_XFER_DIRECT_CHUNK_WRITE_COUNT_SIZE, &H5D_def_direct_chunk_count_g,
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the property of filters for batched direct chunk write */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P_register_real(pclass, H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_LIST_NAME, H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_LIST_SIZE, &H5D_def_direct_chunk_filters_list_g,
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the property of offsets for batched direct chunk write */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P_register_real(pclass, H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_LIST_NAME, H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_LIST_SIZE, &H5D_def_direct_chunk_offset_list_g,
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the property of datasizes for batched direct chunk write */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P_register_real(pclass, H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_LIST_NAME, H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_LIST_SIZE, &H5D_def_direct_chunk_datasize_list_g,
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the property of flag for direct chunk read */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P_register_real(pclass, H5D_XFER_DIRECT_CHUNK_READ_FLAG_NAME, H5D_XFER_DIRECT_CHUNK_READ_FLAG_SIZE, &H5D_def_direct_chunk_read_flag_g,
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the property of offset for direct chunk read */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P_register_real(pclass, H5D_XFER_DIRECT_CHUNK_READ_OFFSET_NAME, H5D_XFER_DIRECT_CHUNK_READ_OFFSET_SIZE, &H5D_def_direct_chunk_read_offset_g,
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the property of buffer size for direct chunk read */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P_register_real(pclass, H5D_XFER_DIRECT_CHUNK_READ_BUF_SIZE_NAME, H5D_XFER_DIRECT_CHUNK_READ_BUF_SIZE_SIZE, &H5D_def_direct_chunk_read_buf_size_g,
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the property of filter mask returned by direct chunk read */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P_register_real(pclass, H5D_XFER_DIRECT_CHUNK_READ_FILTERS_NAME, H5D_XFER_DIRECT_CHUNK_READ_FILTERS_SIZE, &H5D_def_direct_chunk_read_filters_g,
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dxfr_reg_prop() */
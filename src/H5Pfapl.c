@@ -165,6 +165,11 @@
 #define H5F_ACS_CORE_WRITE_TRACKING_FLAG_DEF    FALSE
 #define H5F_ACS_CORE_WRITE_TRACKING_FLAG_ENC    H5P__encode_hbool_t
 #define H5F_ACS_CORE_WRITE_TRACKING_FLAG_DEC    H5P__decode_hbool_t
+/* Definition of file statistics collection flag */
+#define H5F_ACS_COLLECT_STATS_SIZE              sizeof(hbool_t)
+#define H5F_ACS_COLLECT_STATS_DEF               FALSE
+#define H5F_ACS_COLLECT_STATS_ENC               H5P__encode_hbool_t
+#define H5F_ACS_COLLECT_STATS_DEC               H5P__decode_hbool_t
 /* Definition of core VFD write tracking page size */
 #define H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_SIZE      sizeof(size_t)
 #define H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_DEF       524288
@@ -261,6 +266,7 @@ static const unsigned H5F_def_efc_size_g = H5F_ACS_EFC_SIZE_DEF;
 static const H5FD_file_image_info_t H5F_def_file_image_info_g = H5F_ACS_FILE_IMAGE_INFO_DEF;                 /* Default file image info and callbacks */
 static const hbool_t H5F_def_core_write_tracking_flag_g = H5F_ACS_CORE_WRITE_TRACKING_FLAG_DEF;              /* Default setting for core VFD write tracking */
 static const size_t H5F_def_core_write_tracking_page_size_g = H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_DEF;     /* Default core VFD write tracking page size */
+static const hbool_t H5F_def_collect_stats_g = H5F_ACS_COLLECT_STATS_DEF;          /* Default setting for collecting file statistics */
 
 
 /*-------------------------------------------------------------------------
@@ -422,6 +428,12 @@ H5P_facc_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the file statistics collection flag */
+    if(H5P_register_real(pclass, H5F_ACS_COLLECT_STATS_NAME, H5F_ACS_COLLECT_STATS_SIZE, &H5F_def_collect_stats_g, 
+            NULL, NULL, NULL, H5F_ACS_COLLECT_STATS_ENC, H5F_ACS_COLLECT_STATS_DEC, 
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P_facc_reg_prop() */
@@ -3083,3 +3095,70 @@ done:
     FUNC_LEAVE_API(ret_value)
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_collect_stats
+ *
+ * Purpose:     Sets whether statistics are collected for files opened
+ *              with this file access property list.  The statistics are
+ *              retrieved with H5Fget_stats.  Collection is always on
+ *              when the HDF5_STATS environment variable is set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_collect_stats(hid_t plist_id, hbool_t collect)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", plist_id, collect);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_COLLECT_STATS_NAME, &collect) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set statistics collection flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_collect_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_collect_stats
+ *
+ * Purpose:     Gets whether statistics are collected for files opened
+ *              with this file access property list.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_collect_stats(hid_t plist_id, hbool_t *collect)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*b", plist_id, collect);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(collect)
+        if(H5P_get(plist, H5F_ACS_COLLECT_STATS_NAME, collect) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get statistics collection flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_collect_stats() */
+
@@ -348,6 +348,8 @@ H5_DLL herr_t H5Pget_file_image_callbacks(hid_t fapl_id,
 
 H5_DLL herr_t H5Pset_core_write_tracking(hid_t fapl_id, hbool_t is_enabled, size_t page_size);
 H5_DLL herr_t H5Pget_core_write_tracking(hid_t fapl_id, hbool_t *is_enabled, size_t *page_size);
+H5_DLL herr_t H5Pset_collect_stats(hid_t fapl_id, hbool_t collect);
+H5_DLL herr_t H5Pget_collect_stats(hid_t fapl_id, hbool_t *collect);
 
 /* Dataset creation property list (DCPL) routines */
 H5_DLL herr_t H5Pset_layout(hid_t plist_id, H5D_layout_t layout);
@@ -384,6 +386,10 @@ H5_DLL herr_t H5Pget_chunk_cache(hid_t dapl_id,
        size_t *rdcc_nslots/*out*/,
        size_t *rdcc_nbytes/*out*/,
        double *rdcc_w0/*out*/);
+H5_DLL herr_t H5Pset_filter_skip(hid_t dapl_id, double max_ratio,
+       unsigned nchunks);
+H5_DLL herr_t H5Pget_filter_skip(hid_t dapl_id, double *max_ratio/*out*/,
+       unsigned *nchunks/*out*/);
 
 /* Dataset xfer property list (DXPL) routines */
 H5_DLL herr_t H5Pset_data_transform(hid_t plist_id, const char* expression);
@@ -59,6 +59,12 @@
 
 #define H5T_ENCODE_VERSION      0
 
+/* Number of entries in the conversion path lookup cache (a power of two) */
+#define H5T_PATH_CACHE_SIZE     64
+
+/* Path cache key for datatypes whose paths are never cached */
+#define H5T_PATH_KEY_NONE       ((uint64_t)-1)
+
 /*
  * Type initialization macros
  *
@@ -280,6 +286,12 @@
 /* Local Typedefs */
 /******************/
 
+/* An entry in the conversion path lookup cache */
+typedef struct H5T_path_cache_ent_t {
+    uint64_t    src_key;        /* Path key of the source datatype */
+    uint64_t    dst_key;        /* Path key of the destination datatype */
+    H5T_path_t  *path;          /* Conversion path, or NULL if the entry is unused */
+} H5T_path_cache_ent_t;
 
 /********************/
 /* Local Prototypes */
@@ -290,6 +302,8 @@ static herr_t H5T_register(H5T_pers_t pers, const char *name, H5T_t *src,
         H5T_t *dst, H5T_conv_t func, hid_t dxpl_id, hbool_t api_call);
 static htri_t H5T_compiler_conv(H5T_t *src, H5T_t *dst);
 static herr_t H5T_set_size(H5T_t *dt, size_t size);
+static uint64_t H5T_path_key(const H5T_t *dt, hbool_t fixed);
+static void H5T_path_cache_reset(void);
 
 
 /*****************************/
@@ -518,6 +532,18 @@ static struct {
     H5T_soft_t	*soft;		/*unsorted array of soft conversions	*/
 } H5T_g;
 
+/*
+ * Conversion path lookup cache.  Paths found by H5T_path_find() between two
+ * datatypes that cannot change any more are remembered here, keyed by the
+ * path keys of the datatypes, so looking them up again needs no datatype
+ * comparisons.  Entries are dropped whenever a path is removed from the
+ * path database.
+ */
+static H5T_path_cache_ent_t H5T_path_cache_g[H5T_PATH_CACHE_SIZE];
+
+/* Last path key handed out */
+static uint64_t H5T_path_key_g = 0;
+
 /* Declare the free list for H5T_path_t's */
 H5FL_DEFINE_STATIC(H5T_path_t);
 
@@ -1420,6 +1446,7 @@ H5T_term_interface(void)
 	} /* end for */
 
 	/* Clear conversion tables */
+        H5T_path_cache_reset();
 	H5T_g.path = (H5T_path_t **)H5MM_xfree(H5T_g.path);
 	H5T_g.npaths = 0;
 	H5T_g.apaths = 0;
@@ -2370,6 +2397,7 @@ H5T_register(H5T_pers_t pers, const char *name, H5T_t *src, H5T_t *dst,
             H5T_close(old_path->src);
             H5T_close(old_path->dst);
             old_path = H5FL_FREE(H5T_path_t, old_path);
+            H5T_path_cache_reset();
 
             /* Release temporary atoms */
             H5I_dec_ref(tmp_sid);
@@ -2542,6 +2570,7 @@ H5T_unregister(H5T_pers_t pers, const char *name, H5T_t *src, H5T_t *dst,
             H5T_close(path->src);
             H5T_close(path->dst);
             path = H5FL_FREE(H5T_path_t, path);
+            H5T_path_cache_reset();
             H5E_clear_stack(NULL); /*ignore all shutdown errors*/
         } /* end else */
     } /* end for */
@@ -3124,6 +3153,9 @@ H5T_copy(H5T_t *old_dt, H5T_copy_t method)
     /* Copy shared information (entry information is copied last) */
     *(new_dt->shared) = *(old_dt->shared);
 
+    /* The copy may be changed, so it needs its own path cache key */
+    new_dt->shared->path_key = 0;
+
     /* Check what sort of copy we are making */
     switch (method) {
         case H5T_COPY_TRANSIENT:
@@ -4384,6 +4416,8 @@ H5T_path_find(const H5T_t *src, const H5T_t *dst, const char *name,
     H5T_path_t	*table = NULL;		/*path existing in the table	*/
     H5T_path_t	*path = NULL;		/*new path			*/
     hid_t	src_id = -1, dst_id = -1;	/*src and dst type identifiers	*/
+    uint64_t	src_key = 0, dst_key = 0;	/*path cache keys		*/
+    H5T_path_cache_ent_t *cache_ent = NULL;	/*path cache entry for types	*/
     int	i;			/*counter			*/
     int	nprint = 0;		/*lines of output printed	*/
     H5T_path_t	*ret_value;	/*return value			*/
@@ -4417,6 +4451,20 @@ H5T_path_find(const H5T_t *src, const H5T_t *dst, const char *name,
 	H5T_g.npaths = 1;
     } /* end if */
 
+    /*
+     * Look in the path cache first, unless a new hard function is being
+     * registered for the path.
+     */
+    if(!func) {
+        src_key = H5T_path_key(src, FALSE);
+        dst_key = H5T_path_key(dst, FALSE);
+        if(src_key && dst_key) {
+            cache_ent = &H5T_path_cache_g[(size_t)((src_key * 31) ^ dst_key) & (H5T_PATH_CACHE_SIZE - 1)];
+            if(cache_ent->path && cache_ent->src_key == src_key && cache_ent->dst_key == dst_key)
+                HGOTO_DONE(cache_ent->path)
+        } /* end if */
+    } /* end if */
+
     /*
      * Find the conversion path.  If source and destination types are equal
      * then use entry[0], otherwise do a binary search over the
@@ -4582,6 +4630,7 @@ H5T_path_find(const H5T_t *src, const H5T_t *dst, const char *name,
         table = H5FL_FREE(H5T_path_t, table);
 	table = path;
 	H5T_g.path[md] = path;
+        H5T_path_cache_reset();
     } else if(path != table) {
 	HDassert(cmp);
         if((size_t)H5T_g.npaths >= H5T_g.apaths) {
@@ -4606,6 +4655,13 @@ H5T_path_find(const H5T_t *src, const H5T_t *dst, const char *name,
     if(H5T_COMPOUND == H5T_get_class(src, TRUE) && H5T_COMPOUND == H5T_get_class(dst, TRUE))
         path->are_compounds = TRUE;
 
+    /* Remember the path for these types */
+    if(cache_ent) {
+        cache_ent->src_key = src_key;
+        cache_ent->dst_key = dst_key;
+        cache_ent->path = path;
+    } /* end if */
+
     /* Set return value */
     ret_value = path;
 
@@ -4625,6 +4681,88 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T_path_find() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_path_key
+ *
+ * Purpose:	Returns the conversion path cache key of DT, assigning one
+ *		if DT is read-only or FIXED is set.  Datatypes containing
+ *		variable-length or reference types are never cached, since
+ *		changing their location changes the path they need.
+ *
+ * Return:	Success:	The key, or 0 if paths for DT are not
+ *				cached.
+ *
+ *		Failure:	Can't fail
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5T_path_key(const H5T_t *dt, hbool_t fixed)
+{
+    H5T_shared_t *shared = dt->shared;
+    uint64_t    ret_value;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(0 == shared->path_key && (fixed || H5T_STATE_TRANSIENT != shared->state)) {
+        if(H5T_detect_class(dt, H5T_VLEN, FALSE) != FALSE || H5T_detect_class(dt, H5T_REFERENCE, FALSE) != FALSE)
+            shared->path_key = H5T_PATH_KEY_NONE;
+        else
+            shared->path_key = ++H5T_path_key_g;
+    } /* end if */
+
+    ret_value = (H5T_PATH_KEY_NONE == shared->path_key) ? 0 : shared->path_key;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_path_key() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_set_path_key
+ *
+ * Purpose:	Marks DT as a datatype that will not change again, such as
+ *		the datatype of an open dataset or attribute, so that
+ *		conversion paths to and from it can be cached even though
+ *		it is not locked.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T_set_path_key(H5T_t *dt)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(dt);
+
+    (void)H5T_path_key(dt, TRUE);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5T_set_path_key() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_path_cache_reset
+ *
+ * Purpose:	Drops all entries from the conversion path cache.  Called
+ *		whenever a path is removed from the path database.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_path_cache_reset(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDmemset(H5T_path_cache_g, 0, sizeof(H5T_path_cache_g));
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T_path_cache_reset() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T_path_noop
@@ -36,6 +36,7 @@ H5TS_once_t H5TS_first_init_g = PTHREAD_ONCE_INIT;
 #endif /* H5_HAVE_WIN_THREADS */
 H5TS_key_t H5TS_errstk_key_g;
 H5TS_key_t H5TS_funcstk_key_g;
+H5TS_key_t H5TS_tracebuf_key_g;
 H5TS_key_t H5TS_cancel_key_g;
 
 
@@ -112,6 +113,11 @@ H5TS_pthread_first_thread_init(void)
 
     /* initialize key for thread cancellability mechanism */
     pthread_key_create(&H5TS_cancel_key_g, H5TS_key_destructor);
+
+    /* initialize key for thread-specific trace event buffers */
+    /* (Only the thread's reference to its buffer is freed here, the buffers
+     *  outlive their threads and are released by H5CS_trace_term) */
+    pthread_key_create(&H5TS_tracebuf_key_g, H5TS_key_destructor);
 }
 #endif /* H5_HAVE_WIN_THREADS */
 
@@ -355,6 +361,9 @@ H5TS_win32_process_enter(PINIT_ONCE InitOnce, PVOID Parameter, PVOID *lpContex)
         ret_value = FALSE;
 #endif /* H5_HAVE_CODESTACK */
 
+    if(TLS_OUT_OF_INDEXES == (H5TS_tracebuf_key_g = TlsAlloc()))
+        ret_value = FALSE;
+
     return ret_value;
 } /* H5TS_win32_process_enter() */
 #endif /* H5_HAVE_WIN_THREADS */
@@ -425,6 +434,8 @@ H5TS_win32_process_exit(void)
     TlsFree(H5TS_funcstk_key_g);
 #endif /* H5_HAVE_CODESTACK */
 
+    TlsFree(H5TS_tracebuf_key_g);
+
     return;
 } /* H5TS_win32_process_exit() */
 #endif /* H5_HAVE_WIN_THREADS */
@@ -468,6 +479,10 @@ H5TS_win32_thread_exit(void)
         LocalFree((HLOCAL)lpvData);
 #endif /* H5_HAVE_CODESTACK */
 
+    lpvData = TlsGetValue(H5TS_tracebuf_key_g);
+    if(lpvData)
+        LocalFree((HLOCAL)lpvData);
+
     return ret_value;
 } /* H5TS_win32_thread_exit() */
 #endif /* H5_HAVE_WIN_THREADS */
@@ -111,6 +111,7 @@ typedef pthread_once_t H5TS_once_t;
 extern H5TS_once_t H5TS_first_init_g;
 extern H5TS_key_t H5TS_errstk_key_g;
 extern H5TS_key_t H5TS_funcstk_key_g;
+extern H5TS_key_t H5TS_tracebuf_key_g;
 
 #if defined c_plusplus || defined __cplusplus
 extern      "C"
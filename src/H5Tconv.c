@@ -964,6 +964,13 @@ done:                                                                         \
 /* Local Typedefs */
 /******************/
 
+/* A run of bytes copied unchanged from a source to a destination compound */
+typedef struct H5T_conv_struct_run_t {
+    size_t      src_offset;             /*offset of run in source element    */
+    size_t      dst_offset;             /*offset of run in dest. element     */
+    size_t      len;                    /*number of bytes in run             */
+} H5T_conv_struct_run_t;
+
 /* Conversion data for H5T__conv_struct() */
 typedef struct H5T_conv_struct_t {
     int	*src2dst;		/*mapping from src to dst member num */
@@ -972,6 +979,8 @@ typedef struct H5T_conv_struct_t {
     H5T_path_t	**memb_path;		/*conversion path for each member    */
     H5T_subset_info_t   subset_info;    /*info related to compound subsets   */
     unsigned            src_nmembs;     /*needed by free function            */
+    size_t              ncopy_runs;     /*number of runs in copy plan        */
+    H5T_conv_struct_run_t *copy_runs;   /*copy plan, when no member needs conversion */
 } H5T_conv_struct_t;
 
 /* Conversion data for H5T__conv_enum() */
@@ -1886,6 +1895,7 @@ H5T_conv_struct_free(H5T_conv_struct_t *priv)
     H5MM_xfree(src_memb_id);
     H5MM_xfree(dst_memb_id);
     H5MM_xfree(priv->memb_path);
+    H5MM_xfree(priv->copy_runs);
 
     FUNC_LEAVE_NOAPI((H5T_conv_struct_t *)H5MM_xfree(priv))
 } /* end H5T_conv_struct_free() */
@@ -1937,6 +1947,14 @@ H5T_conv_struct_free(H5T_conv_struct_t *priv)
  *              The optimization is simply moving data to the appropriate
  *              places in the buffer.
  *
+ *              When no member needs converting (every member path is a
+ *              no-op) but the members are reordered or only partially
+ *              shared, a copy plan is built instead: a list of
+ *              (source offset, destination offset, length) runs, with
+ *              members that are adjacent in both types merged into one
+ *              run.  The conversion functions then apply the plan to each
+ *              element with plain memory copies.
+ *
  *-------------------------------------------------------------------------
  */
 static herr_t
@@ -2034,6 +2052,42 @@ H5T_conv_struct_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata, hid_t dxpl_id)
         } /* end if */
     } /* end for */
 
+    /*
+     * (Re)build the copy plan.  Members are sorted by offset, so walking the
+     * source members in order lets runs that are contiguous in both the
+     * source and destination be merged.
+     */
+    priv->copy_runs = (H5T_conv_struct_run_t *)H5MM_xfree(priv->copy_runs);
+    priv->ncopy_runs = 0;
+    for(i = 0; i < src_nmembs; i++)
+        if(src2dst[i] >= 0 && !priv->memb_path[i]->is_noop)
+            break;
+    if(i == src_nmembs) {
+        H5T_conv_struct_run_t *run = NULL;
+
+        if(NULL == (priv->copy_runs = (H5T_conv_struct_run_t *)H5MM_malloc(MAX(src_nmembs, 1) * sizeof(H5T_conv_struct_run_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        for(i = 0; i < src_nmembs; i++) {
+            const H5T_cmemb_t *src_memb, *dst_memb;
+
+            if(src2dst[i] < 0)
+                continue;
+            src_memb = src->shared->u.compnd.memb + i;
+            dst_memb = dst->shared->u.compnd.memb + src2dst[i];
+            HDassert(src_memb->size == dst_memb->size);
+
+            if(run && run->src_offset + run->len == src_memb->offset
+                    && run->dst_offset + run->len == dst_memb->offset)
+                run->len += src_memb->size;
+            else {
+                run = priv->copy_runs + priv->ncopy_runs++;
+                run->src_offset = src_memb->offset;
+                run->dst_offset = dst_memb->offset;
+                run->len = src_memb->size;
+            } /* end else */
+        } /* end for */
+    } /* end if */
+
     /* The compound conversion functions need a background buffer */
     cdata->need_bkg = H5T_BKG_YES;
 
@@ -2084,6 +2138,62 @@ done:
 } /* end H5T_conv_struct_init() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_copy
+ *
+ * Purpose:	Converts NELMTS compound elements by applying the copy plan
+ *		built by H5T_conv_struct_init().  Source elements are
+ *		SRC_STRIDE bytes apart in BUF; the plan's runs are copied
+ *		into the background elements (BKG_STRIDE bytes apart), which
+ *		are then moved into BUF at DST_STRIDE bytes apart.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_conv_struct_copy(const H5T_conv_struct_t *priv, size_t dst_size,
+    size_t nelmts, size_t src_stride, size_t bkg_stride, size_t dst_stride,
+    uint8_t *buf, uint8_t *bkg)
+{
+    const H5T_conv_struct_run_t *runs = priv->copy_runs;
+    size_t      nruns = priv->ncopy_runs;
+    uint8_t     *xbuf, *xbkg;
+    size_t      elmtno, r;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(runs);
+
+    if(dst_stride <= src_stride) {
+        /* A converted element never reaches a source element that has not
+         * been read yet, so do both steps in one pass */
+        for(elmtno = 0; elmtno < nelmts; elmtno++) {
+            xbuf = buf + elmtno * src_stride;
+            xbkg = bkg + elmtno * bkg_stride;
+            for(r = 0; r < nruns; r++)
+                HDmemcpy(xbkg + runs[r].dst_offset, xbuf + runs[r].src_offset, runs[r].len);
+            HDmemmove(buf + elmtno * dst_stride, xbkg, dst_size);
+        } /* end for */
+    } /* end if */
+    else {
+        for(xbuf = buf, xbkg = bkg, elmtno = 0; elmtno < nelmts; elmtno++) {
+            for(r = 0; r < nruns; r++)
+                HDmemcpy(xbkg + runs[r].dst_offset, xbuf + runs[r].src_offset, runs[r].len);
+            xbuf += src_stride;
+            xbkg += bkg_stride;
+        } /* end for */
+        for(xbuf = buf, xbkg = bkg, elmtno = 0; elmtno < nelmts; elmtno++) {
+            HDmemmove(xbuf, xbkg, dst_size);
+            xbuf += dst_stride;
+            xbkg += bkg_stride;
+        } /* end for */
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T_conv_struct_copy() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5T__conv_struct_subset
  *
@@ -2218,6 +2328,15 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             H5T__sort_value(dst, NULL);
             src2dst = priv->src2dst;
 
+            /* No member needs converting: apply the copy plan */
+            if(priv->copy_runs) {
+                H5T_conv_struct_copy(priv, dst->shared->size, nelmts,
+                        buf_stride ? buf_stride : src->shared->size,
+                        (buf_stride && bkg_stride) ? bkg_stride : dst->shared->size,
+                        buf_stride ? buf_stride : dst->shared->size, buf, bkg);
+                break;
+            } /* end if */
+
             /*
              * Direction of conversion and striding through background.
              */
@@ -2547,6 +2666,12 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
                     xbkg += bkg_stride;
                 } /* end for */
             } /* end if */
+            else if(priv->copy_runs) {
+                /* No member needs converting: apply the copy plan */
+                H5T_conv_struct_copy(priv, dst->shared->size, nelmts, buf_stride,
+                        bkg_stride, no_stride ? dst->shared->size : buf_stride, buf, bkg);
+                break;
+            } /* end else-if */
             else {
                 /*
                  * For each member where the destination is not larger than the
@@ -259,6 +259,7 @@ typedef struct H5T_shared_t {
     size_t		size;	/*total size of an instance of this type     */
     unsigned            version;        /* Version of object header message to encode this object with */
     hbool_t		force_conv;/* Set if this type always needs to be converted and H5T__conv_noop cannot be called */
+    uint64_t		path_key; /* Key for the conversion path cache, 0 if not assigned */
     struct H5T_t	*parent;/*parent type for derived datatypes	     */
     union {
         H5T_atomic_t	atomic; /* an atomic datatype              */
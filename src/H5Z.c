@@ -35,41 +35,104 @@
 #   include "szlib.h"
 #endif
 
-/* Local typedefs */
-#ifdef H5Z_DEBUG
-typedef struct H5Z_stats_t {
-    struct {
-	hsize_t	total;		/*total number of bytes processed	*/
-	hsize_t	errors;		/*bytes of total attributable to errors	*/
-	H5_timer_t timer;	/*execution time including errors	*/
-    } stats[2];			/*0=output, 1=input			*/
-} H5Z_stats_t;
-#endif /* H5Z_DEBUG */
+#ifdef H5_HAVE_FILTER_THREADS
+#   include <pthread.h>
+#endif
 
+/* Local typedefs */
 typedef struct H5Z_object_t {
     H5Z_filter_t filter_id;     /* ID of the filter we're looking for         */
     htri_t       found;         /* Whether we find an object using the filter */
 } H5Z_object_t;
 
+/* Buffer kept in the filter buffer pool */
+typedef struct H5Z_buf_pool_ent_t {
+    void        *buf;           /* Pooled buffer (from H5MM_malloc) */
+    size_t      size;           /* Size of the buffer, in bytes */
+} H5Z_buf_pool_ent_t;
+
+/* Sub-block of a buffer being filtered by a "split" filter */
+typedef struct H5Z_split_block_t {
+    void        *buf;           /* Sub-block's own buffer */
+    size_t      buf_size;       /* Allocated size of the buffer */
+    size_t      nbytes;         /* Bytes in buffer, zero if the filter failed */
+} H5Z_split_block_t;
+
+/* Work shared out to the threads filtering the sub-blocks of a buffer */
+typedef struct H5Z_split_work_t {
+    const H5Z_class3_t *fclass; /* Filter class */
+    unsigned    flags;          /* Filter invocation flags */
+    size_t      cd_nelmts;      /* Number of filter client data values */
+    const unsigned *cd_values;  /* Filter client data values */
+    H5Z_split_block_t *blocks;  /* Sub-blocks */
+    size_t      nblocks;        /* Number of sub-blocks */
+    size_t      first;          /* First sub-block for this thread */
+    size_t      stride;         /* Distance between this thread's sub-blocks */
+} H5Z_split_work_t;
+
 /* Enumerated type for dataset creation prelude callbacks */
 typedef enum {
     H5Z_PRELUDE_CAN_APPLY,      /* Call "can apply" callback */
     H5Z_PRELUDE_SET_LOCAL       /* Call "set local" callback */
 } H5Z_prelude_type_t;
 
+/* Filter buffer pool limits */
+#define H5Z_BUF_POOL_NSLOTS     8                       /* Buffers kept */
+#define H5Z_BUF_POOL_MIN_SIZE   4096                    /* Smallest buffer kept */
+#define H5Z_BUF_POOL_MAX_BYTES  (8 * 1024 * 1024)       /* Bytes kept in all */
+
+/* Limits for filters that split buffers into sub-blocks */
+#define H5Z_SPLIT_MAX_NBLOCKS   64      /* Sub-blocks per buffer */
+#define H5Z_SPLIT_MAX_NTHREADS  8       /* Threads filtering one buffer */
+
+/* Sub-blocks of thread-safe filters are filtered on POSIX threads, whether
+ * or not the library is thread-safe: the thread that entered the library
+ * waits for them, and they run nothing but the filter function.
+ */
+#ifdef H5_HAVE_FILTER_THREADS
+#define H5Z_SPLIT_THREADS
+#endif /* H5_HAVE_FILTER_THREADS */
+
+/* Package variables */
+size_t H5Z_size_hint_g = 0;
+size_t H5Z_buf_pool_nbytes_g = 0;
+
 /* Local variables */
 static size_t		H5Z_table_alloc_g = 0;
 static size_t		H5Z_table_used_g = 0;
-static H5Z_class2_t	*H5Z_table_g = NULL;
-#ifdef H5Z_DEBUG
-static H5Z_stats_t	*H5Z_stat_table_g = NULL;
-#endif /* H5Z_DEBUG */
+static H5Z_class3_t	*H5Z_table_g = NULL;
+static H5Z_filter_stats_t *H5Z_stat_table_g = NULL;
+static H5Z_buf_pool_ent_t H5Z_buf_pool_g[H5Z_BUF_POOL_NSLOTS];
+#ifdef H5Z_SPLIT_THREADS
+static pthread_mutex_t  H5Z_buf_pool_mutex_g = PTHREAD_MUTEX_INITIALIZER;
+#define H5Z_BUF_POOL_LOCK       pthread_mutex_lock(&H5Z_buf_pool_mutex_g);
+#define H5Z_BUF_POOL_UNLOCK     pthread_mutex_unlock(&H5Z_buf_pool_mutex_g);
+#else /* H5Z_SPLIT_THREADS */
+#define H5Z_BUF_POOL_LOCK       /* void */
+#define H5Z_BUF_POOL_UNLOCK     /* void */
+#endif /* H5Z_SPLIT_THREADS */
 
 /* Local functions */
 static int H5Z_find_idx(H5Z_filter_t id);
+static void H5Z__filter_stats(H5Z_filter_dir_stats_t *fstats, size_t nbytes_in,
+    size_t nbytes_out, double *prev);
+static size_t H5Z__filter_apply(const H5Z_class3_t *fclass, unsigned flags,
+    const H5Z_filter_info_t *filter, size_t nbytes, size_t *buf_size,
+    void **buf);
+static void *H5Z__split_worker(void *_work);
 static int H5Z__check_unregister_dset_cb(void *obj_ptr, hid_t obj_id, void *key);
 static int H5Z__check_unregister_group_cb(void *obj_ptr, hid_t obj_id, void *key);
 static int H5Z__flush_file_cb(void *obj_ptr, hid_t obj_id, void *key);
+static H5_INLINE uint64_t H5Z_bits_get_elmt(const unsigned char *elmt,
+    size_t size, hbool_t little_endian);
+static H5_INLINE void H5Z_bits_set_elmt(unsigned char *elmt, size_t size,
+    hbool_t little_endian, uint64_t val);
+static H5_INLINE void H5Z_pack_bits_kernel(const unsigned char *data,
+    size_t nelmts, size_t size, hbool_t little_endian, unsigned precision,
+    unsigned offset, unsigned char *buffer);
+static H5_INLINE void H5Z_unpack_bits_kernel(unsigned char *data,
+    size_t nelmts, size_t size, hbool_t little_endian, unsigned precision,
+    unsigned offset, const unsigned char *buffer, size_t buffer_size);
 
 
 /*-------------------------------------------------------------------------
@@ -147,20 +210,23 @@ H5Z_term_interface(void)
 	if (H5DEBUG(Z)) {
 	    for (i=0; i<H5Z_table_used_g; i++) {
 		for (dir=0; dir<2; dir++) {
-		    if (0==H5Z_stat_table_g[i].stats[dir].total) continue;
+                    const H5Z_filter_dir_stats_t *fstats = dir ?
+                            &H5Z_stat_table_g[i].decode : &H5Z_stat_table_g[i].encode;
+
+		    if (0==fstats->calls) continue;
 
 		    if (0==nprint++) {
 			/* Print column headers */
 			HDfprintf (H5DEBUG(Z), "H5Z: filter statistics "
 				   "accumulated over life of library:\n");
 			HDfprintf (H5DEBUG(Z),
-				   "   %-16s %10s %10s %8s %8s %8s %10s\n",
-				   "Filter", "Total", "Errors", "User",
-				   "System", "Elapsed", "Bandwidth");
+				   "   %-16s %8s %8s %12s %12s %8s %10s\n",
+				   "Filter", "Calls", "Failed", "Bytes in",
+				   "Bytes out", "Elapsed", "Bandwidth");
 			HDfprintf (H5DEBUG(Z),
-				   "   %-16s %10s %10s %8s %8s %8s %10s\n",
-				   "------", "-----", "------", "----",
-				   "------", "-------", "---------");
+				   "   %-16s %8s %8s %12s %12s %8s %10s\n",
+				   "------", "-----", "------", "--------",
+				   "---------", "-------", "---------");
 		    }
 
 		    /* Truncate the comment to fit in the field */
@@ -174,29 +240,27 @@ H5Z_term_interface(void)
 		     * the word `Inf' if the elapsed time is zero.
 		     */
 		    H5_bandwidth(bandwidth,
-				 (double)(H5Z_stat_table_g[i].stats[dir].total),
-				 H5Z_stat_table_g[i].stats[dir].timer.etime);
+				 (double)MAX(fstats->bytes_in, fstats->bytes_out),
+				 fstats->time);
 
 		    /* Print the statistics */
 		    HDfprintf (H5DEBUG(Z),
-			       "   %s%-15s %10Hd %10Hd %8.2f %8.2f %8.2f "
+			       "   %s%-15s %8Hd %8Hd %12Hd %12Hd %8.2f "
 			       "%10s\n", dir?"<":">", comment,
-			       H5Z_stat_table_g[i].stats[dir].total,
-			       H5Z_stat_table_g[i].stats[dir].errors,
-			       H5Z_stat_table_g[i].stats[dir].timer.utime,
-			       H5Z_stat_table_g[i].stats[dir].timer.stime,
-			       H5Z_stat_table_g[i].stats[dir].timer.etime,
-			       bandwidth);
+			       fstats->calls, fstats->failed, fstats->bytes_in,
+			       fstats->bytes_out, fstats->time, bandwidth);
 		}
 	    }
 	}
 #endif /* H5Z_DEBUG */
 	/* Free the table of filters */
-	H5Z_table_g = (H5Z_class2_t *)H5MM_xfree(H5Z_table_g);
-#ifdef H5Z_DEBUG
-	H5Z_stat_table_g = (H5Z_stats_t *)H5MM_xfree(H5Z_stat_table_g);
-#endif /* H5Z_DEBUG */
+	H5Z_table_g = (H5Z_class3_t *)H5MM_xfree(H5Z_table_g);
+	H5Z_stat_table_g = (H5Z_filter_stats_t *)H5MM_xfree(H5Z_stat_table_g);
 	H5Z_table_used_g = H5Z_table_alloc_g = 0;
+
+        /* Release the pooled filter buffers */
+        H5Z_garbage_coll();
+
 	H5_interface_initialize_g = 0;
     } /* end if */
 
@@ -209,6 +273,10 @@ H5Z_term_interface(void)
  *
  * Purpose:	This function registers new filter.
  *
+ *		CLS may point to an H5Z_class2_t, to an H5Z_class3_t, which
+ *		adds the capability flags and the "split" and "merge"
+ *		callbacks, or to an H5Z_class1_t.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -244,7 +312,7 @@ H5Zregister(const void *cls)
      * at least 256, there should be no overlap and the version of the struct
      * can be determined by the value of the first field.
      */
-    if(cls_real->version != H5Z_CLASS_T_VERS) {
+    if(cls_real->version != H5Z_CLASS_T_VERS && cls_real->version != H5Z_CLASS3_T_VERS) {
 #ifndef H5_NO_DEPRECATED_SYMBOLS
         /* Assume it is an old "H5Z_class1_t" instead */
         const H5Z_class1_t *cls_old = (const H5Z_class1_t *) cls;
@@ -283,13 +351,17 @@ done:
     FUNC_LEAVE_API(ret_value)
 }
 
-
+
 /*-------------------------------------------------------------------------
  * Function:	H5Z_register
  *
  * Purpose:	Same as the public version except this one allows filters
  *		to be set for predefined method numbers <H5Z_FILTER_RESERVED
  *
+ *		CLS points to an H5Z_class2_t or to an H5Z_class3_t, told
+ *		apart by their version numbers.  An H5Z_class2_t is entered
+ *		in the table as an H5Z_class3_t with no capabilities.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -300,58 +372,77 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5Z_register (const H5Z_class2_t *cls)
+H5Z_register (const void *cls)
 {
+    const H5Z_class2_t *cls2 = (const H5Z_class2_t *)cls; /* Fields common to both versions */
+    const H5Z_class3_t *cls3 = NULL;    /* Version 3 class, if given one */
     size_t	i;
     herr_t      ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
-    HDassert(cls);
-    HDassert(cls->id >= 0 && cls->id <= H5Z_FILTER_MAX);
+    HDassert(cls2);
+    HDassert(cls2->id >= 0 && cls2->id <= H5Z_FILTER_MAX);
+
+    /* Check the capabilities of a version 3 class */
+    if(cls2->version == H5Z_CLASS3_T_VERS) {
+        cls3 = (const H5Z_class3_t *)cls;
+        if(cls3->flags & ~((unsigned)H5Z_CLASS_ALL_FLAGS))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown filter class flags")
+        if(cls3->merge && cls3->split == NULL)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "\"merge\" callback specified without \"split\" callback")
+    } /* end if */
+    else if(cls2->version != H5Z_CLASS_T_VERS)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid H5Z_class_t version number")
 
     /* Is the filter already registered? */
     for(i = 0; i < H5Z_table_used_g; i++)
-	if(H5Z_table_g[i].id == cls->id)
+	if(H5Z_table_g[i].id == cls2->id)
             break;
 
     /* Filter not already registered */
     if(i >= H5Z_table_used_g) {
 	if(H5Z_table_used_g >= H5Z_table_alloc_g) {
 	    size_t n = MAX(H5Z_MAX_NFILTERS, 2*H5Z_table_alloc_g);
-	    H5Z_class2_t *table = (H5Z_class2_t *)H5MM_realloc(H5Z_table_g, n * sizeof(H5Z_class2_t));
-#ifdef H5Z_DEBUG
-	    H5Z_stats_t *stat_table = (H5Z_stats_t *)H5MM_realloc(H5Z_stat_table_g, n * sizeof(H5Z_stats_t));
-#endif /* H5Z_DEBUG */
+	    H5Z_class3_t *table = (H5Z_class3_t *)H5MM_realloc(H5Z_table_g, n * sizeof(H5Z_class3_t));
+	    H5Z_filter_stats_t *stat_table;
+
 	    if(!table)
 		HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to extend filter table")
 	    H5Z_table_g = table;
-#ifdef H5Z_DEBUG
-	    if(!stat_table)
+	    if(NULL == (stat_table = (H5Z_filter_stats_t *)H5MM_realloc(H5Z_stat_table_g, n * sizeof(H5Z_filter_stats_t))))
 		HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to extend filter statistics table")
 	    H5Z_stat_table_g = stat_table;
-#endif /* H5Z_DEBUG */
 	    H5Z_table_alloc_g = n;
 	} /* end if */
 
 	/* Initialize */
 	i = H5Z_table_used_g++;
-	HDmemcpy(H5Z_table_g+i, cls, sizeof(H5Z_class2_t));
-#ifdef H5Z_DEBUG
-	HDmemset(H5Z_stat_table_g+i, 0, sizeof(H5Z_stats_t));
-#endif /* H5Z_DEBUG */
+	HDmemset(H5Z_stat_table_g+i, 0, sizeof(H5Z_filter_stats_t));
     } /* end if */
-    /* Filter already registered */
+
+    /* Set (or replace) the table entry */
+    if(cls3)
+	HDmemcpy(H5Z_table_g+i, cls3, sizeof(H5Z_class3_t));
     else {
-	/* Replace old contents */
-	HDmemcpy(H5Z_table_g+i, cls, sizeof(H5Z_class2_t));
+        H5Z_table_g[i].version = H5Z_CLASS3_T_VERS;
+        H5Z_table_g[i].id = cls2->id;
+        H5Z_table_g[i].encoder_present = cls2->encoder_present;
+        H5Z_table_g[i].decoder_present = cls2->decoder_present;
+        H5Z_table_g[i].name = cls2->name;
+        H5Z_table_g[i].can_apply = cls2->can_apply;
+        H5Z_table_g[i].set_local = cls2->set_local;
+        H5Z_table_g[i].filter = cls2->filter;
+        H5Z_table_g[i].flags = 0;
+        H5Z_table_g[i].split = NULL;
+        H5Z_table_g[i].merge = NULL;
     } /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
-
+
 /*-------------------------------------------------------------------------
  * Function:	H5Zunregister
  *
@@ -444,10 +535,8 @@ H5Z_unregister(H5Z_filter_t filter_id)
 
     /* Remove filter from table */
     /* Don't worry about shrinking table size (for now) */
-    HDmemmove(&H5Z_table_g[filter_index],&H5Z_table_g[filter_index+1],sizeof(H5Z_class2_t)*((H5Z_table_used_g-1)-filter_index));
-#ifdef H5Z_DEBUG
-    HDmemmove(&H5Z_stat_table_g[filter_index],&H5Z_stat_table_g[filter_index+1],sizeof(H5Z_stats_t)*((H5Z_table_used_g-1)-filter_index));
-#endif /* H5Z_DEBUG */
+    HDmemmove(&H5Z_table_g[filter_index],&H5Z_table_g[filter_index+1],sizeof(H5Z_class3_t)*((H5Z_table_used_g-1)-filter_index));
+    HDmemmove(&H5Z_stat_table_g[filter_index],&H5Z_stat_table_g[filter_index+1],sizeof(H5Z_filter_stats_t)*((H5Z_table_used_g-1)-filter_index));
     H5Z_table_used_g--;
 
 done:
@@ -722,7 +811,7 @@ static herr_t
 H5Z_prelude_callback(const H5O_pline_t *pline, hid_t dcpl_id, hid_t type_id,
     hid_t space_id, H5Z_prelude_type_t prelude_type)
 {
-    H5Z_class2_t    *fclass;                /* Individual filter information */
+    H5Z_class3_t    *fclass;                /* Individual filter information */
     size_t          u;                      /* Local index variable */
     htri_t          ret_value = TRUE;    /* Return value */
 
@@ -1234,11 +1323,11 @@ done:
  *
  *-------------------------------------------------------------------------
  */
-H5Z_class2_t *
+H5Z_class3_t *
 H5Z_find(H5Z_filter_t id)
 {
     int	idx;                            /* Filter index in global table */
-    H5Z_class2_t *ret_value=NULL;        /* Return value */
+    H5Z_class3_t *ret_value=NULL;        /* Return value */
 
     FUNC_ENTER_NOAPI(NULL)
 
@@ -1269,10 +1358,21 @@ done:
  *		number of resulting bytes while BUF_SIZE holds the total
  *		allocated size of the buffer, which is pointed to BUF.
  *
+ *		On the reverse path SIZE_HINT, when non-zero, is the number
+ *		of bytes the fully de-filtered data is expected to occupy.
+ *		It is made available to the filters so that they can size
+ *		their output buffers once instead of growing them.
+ *
  *		If the buffer must grow during processing of the pipeline
  *		then the pipeline function should free the original buffer
  *		and return a fresh buffer, adjusting BUF_SIZE accordingly.
  *
+ *		The time spent in each filter is added to its statistics,
+ *		reading the clock once before the first filter and once
+ *		after each filter.  If ELAPSED is non-NULL the total time
+ *		spent filtering is returned in it, so callers that keep
+ *		their own statistics don't need to read the clock again.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -1285,22 +1385,25 @@ done:
 herr_t
 H5Z_pipeline(const H5O_pline_t *pline, unsigned flags,
  	     unsigned *filter_mask/*in,out*/, H5Z_EDC_t edc_read,
-             H5Z_cb_t cb_struct, size_t *nbytes/*in,out*/,
-             size_t *buf_size/*in,out*/, void **buf/*in,out*/)
+             H5Z_cb_t cb_struct, size_t size_hint, size_t *nbytes/*in,out*/,
+             size_t *buf_size/*in,out*/, void **buf/*in,out*/,
+             double *elapsed/*out*/)
 {
     size_t	i, idx, new_nbytes;
     int fclass_idx;             /* Index of filter class in global table */
-    H5Z_class2_t	*fclass=NULL;   /* Filter class pointer */
-#ifdef H5Z_DEBUG
-    H5Z_stats_t	*fstats=NULL;   /* Filter stats pointer */
-    H5_timer_t	timer;
-#endif
+    H5Z_class3_t	*fclass=NULL;   /* Filter class pointer */
+    double      start = 0.0F;           /* Time the pipeline was started */
+    double      prev = 0.0F;            /* Time the last filter finished */
     unsigned	failed = 0;
     unsigned	tmp_flags;
+    TRACE_EVENT_VARS
     herr_t      ret_value=SUCCEED;       /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    /* Record the trace event for entering this routine */
+    BEGIN_TRACE_EVENT
+
     HDassert(0==(flags & ~((unsigned)H5Z_FLAG_INVMASK)));
     HDassert(filter_mask);
     HDassert(nbytes && *nbytes>0);
@@ -1308,7 +1411,13 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags,
     HDassert(buf && *buf);
     HDassert(!pline || pline->nused<H5Z_MAX_NFILTERS);
 
+    if (pline && pline->nused > 0)
+        start = prev = H5_get_time();
+
     if (pline && (flags & H5Z_FLAG_REVERSE)) { /* Read */
+        /* Let the filters know how large the de-filtered data will be */
+        H5Z_size_hint_g = size_hint;
+
 	for (i=pline->nused; i>0; --i) {
 	    idx = i-1;
 
@@ -1350,20 +1459,10 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags,
             } /* end if */
 
             fclass=&H5Z_table_g[fclass_idx];
-#ifdef H5Z_DEBUG
-            fstats=&H5Z_stat_table_g[fclass_idx];
-	    H5_timer_begin(&timer);
-#endif
             tmp_flags=flags|(pline->filter[idx].flags);
             tmp_flags|=(edc_read== H5Z_DISABLE_EDC) ? H5Z_FLAG_SKIP_EDC : 0;
-	    new_nbytes = (fclass->filter)(tmp_flags, pline->filter[idx].cd_nelmts,
-                                        pline->filter[idx].cd_values, *nbytes, buf_size, buf);
-
-#ifdef H5Z_DEBUG
-	    H5_timer_end(&(fstats->stats[1].timer), &timer);
-	    fstats->stats[1].total += MAX(*nbytes, new_nbytes);
-	    if (0==new_nbytes) fstats->stats[1].errors += *nbytes;
-#endif
+	    new_nbytes = H5Z__filter_apply(fclass, tmp_flags, &pline->filter[idx], *nbytes, buf_size, buf);
+            H5Z__filter_stats(&H5Z_stat_table_g[fclass_idx].decode, *nbytes, new_nbytes, &prev);
 
             if(0==new_nbytes) {
                 if((cb_struct.func && (H5Z_CB_FAIL==cb_struct.func(pline->filter[idx].id, *buf, *buf_size, cb_struct.op_data)))
@@ -1393,17 +1492,9 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags,
 		continue; /*filter excluded*/
 	    }
             fclass=&H5Z_table_g[fclass_idx];
-#ifdef H5Z_DEBUG
-            fstats=&H5Z_stat_table_g[fclass_idx];
-	    H5_timer_begin(&timer);
-#endif
-	    new_nbytes = (fclass->filter)(flags|(pline->filter[idx].flags), pline->filter[idx].cd_nelmts,
-					pline->filter[idx].cd_values, *nbytes, buf_size, buf);
-#ifdef H5Z_DEBUG
-	    H5_timer_end(&(fstats->stats[0].timer), &timer);
-	    fstats->stats[0].total += MAX(*nbytes, new_nbytes);
-	    if (0==new_nbytes) fstats->stats[0].errors += *nbytes;
-#endif
+	    new_nbytes = H5Z__filter_apply(fclass, flags|(pline->filter[idx].flags), &pline->filter[idx], *nbytes, buf_size, buf);
+            H5Z__filter_stats(&H5Z_stat_table_g[fclass_idx].encode, *nbytes, new_nbytes, &prev);
+
             if(0==new_nbytes) {
                 if (0==(pline->filter[idx].flags & H5Z_FLAG_OPTIONAL)) {
                     if((cb_struct.func && (H5Z_CB_FAIL==cb_struct.func(pline->filter[idx].id, *buf, *nbytes, cb_struct.op_data)))
@@ -1422,12 +1513,381 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags,
     }
 
     *filter_mask = failed;
+    if (elapsed)
+        *elapsed = prev - start;
 
 done:
+    H5Z_size_hint_g = 0;
+
+    FINISH_TRACE_EVENT
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_stats
+ *
+ * Purpose:	Records one call of a filter in FSTATS.  The filter took
+ *		NBYTES_IN bytes and returned NBYTES_OUT, which is 0 if it
+ *		failed.  It ran from *PREV until now, and *PREV is set to
+ *		now for the next filter in the pipeline.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__filter_stats(H5Z_filter_dir_stats_t *fstats, size_t nbytes_in,
+    size_t nbytes_out, double *prev)
+{
+    double      now = H5_get_time();    /* Time the filter finished */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    fstats->time += now - *prev;
+    *prev = now;
+    fstats->calls++;
+    fstats->bytes_in += nbytes_in;
+    fstats->bytes_out += nbytes_out;
+    if(0 == nbytes_out)
+        fstats->failed++;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__filter_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_apply
+ *
+ * Purpose:	Runs one filter of a pipeline over a buffer.  FLAGS, NBYTES,
+ *		BUF_SIZE and BUF are as for the filter function itself.
+ *
+ *		If the filter class has a "split" callback and it divides
+ *		the buffer into sub-blocks, each sub-block is copied into a
+ *		buffer of its own and filtered separately, concurrently if
+ *		the filter is thread-safe and Pthreads are available.
+ *		Sub-blocks whose thread can't be started are filtered by
+ *		the calling thread.  The results are then combined by the
+ *		filter's "merge" callback, or concatenated if it has none.
+ *		Otherwise the filter function is called on the whole buffer.
+ *
+ * Return:	Success:	Number of bytes in the output buffer
+ *		Failure:	0, with BUF and BUF_SIZE unchanged
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__filter_apply(const H5Z_class3_t *fclass, unsigned flags,
+    const H5Z_filter_info_t *filter, size_t nbytes, size_t *buf_size, void **buf)
+{
+    H5Z_split_block_t blocks[H5Z_SPLIT_MAX_NBLOCKS];    /* Sub-blocks */
+    size_t      block_off[H5Z_SPLIT_MAX_NBLOCKS];       /* Sub-block offsets in BUF */
+    size_t      block_len[H5Z_SPLIT_MAX_NBLOCKS];       /* Sub-block sizes */
+    H5Z_split_work_t work[H5Z_SPLIT_MAX_NTHREADS];      /* Work for each thread */
+    size_t      nblocks = 0;            /* Number of sub-blocks */
+    size_t      nalloc = 0;             /* Number of sub-block buffers allocated */
+    size_t      nthreads;               /* Number of threads filtering sub-blocks */
+    size_t      size_hint = 0;          /* Size hint for the whole buffer */
+#ifdef H5Z_SPLIT_THREADS
+    hbool_t     join_failed = FALSE;    /* Whether a thread couldn't be joined */
+#endif /* H5Z_SPLIT_THREADS */
+    size_t      u;                      /* Local index variable */
+    size_t      ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(fclass);
+    HDassert(filter);
+
+    /* Let the filter divide the buffer, if it can */
+    if(fclass->split)
+        nblocks = (fclass->split)(flags, filter->cd_nelmts, filter->cd_values,
+                nbytes, *buf, (size_t)H5Z_SPLIT_MAX_NBLOCKS, block_off, block_len);
+    if(nblocks < 2) {
+        ret_value = (fclass->filter)(flags, filter->cd_nelmts, filter->cd_values,
+                nbytes, buf_size, buf);
+        HGOTO_DONE(ret_value)
+    } /* end if */
+    if(nblocks > H5Z_SPLIT_MAX_NBLOCKS)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "too many sub-blocks from \"split\" callback")
+
+    /* Copy each sub-block into a buffer of its own */
+    for(nalloc = 0; nalloc < nblocks; nalloc++) {
+        if(0 == block_len[nalloc] || block_off[nalloc] > nbytes
+                || block_len[nalloc] > nbytes - block_off[nalloc])
+            HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "invalid sub-block from \"split\" callback")
+        if(NULL == (blocks[nalloc].buf = H5MM_malloc(block_len[nalloc])))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for sub-block")
+        HDmemcpy(blocks[nalloc].buf, (const uint8_t *)*buf + block_off[nalloc], block_len[nalloc]);
+        blocks[nalloc].buf_size = blocks[nalloc].nbytes = block_len[nalloc];
+    } /* end for */
+
+    /* Filter the sub-blocks.  Each thread takes every NTHREADS'th one and
+     * this thread takes the first share itself.  The size hint describes
+     * the whole buffer, so it is cleared until all of them are done.
+     */
+    size_hint = H5Z_size_hint_g;
+    H5Z_size_hint_g = 0;
+#ifdef H5Z_SPLIT_THREADS
+    nthreads = (fclass->flags & H5Z_CLASS_THREADSAFE) ? MIN(nblocks, H5Z_SPLIT_MAX_NTHREADS) : 1;
+#else /* H5Z_SPLIT_THREADS */
+    nthreads = 1;
+#endif /* H5Z_SPLIT_THREADS */
+    for(u = 0; u < nthreads; u++) {
+        work[u].fclass = fclass;
+        work[u].flags = flags;
+        work[u].cd_nelmts = filter->cd_nelmts;
+        work[u].cd_values = filter->cd_values;
+        work[u].blocks = blocks;
+        work[u].nblocks = nblocks;
+        work[u].first = u;
+        work[u].stride = nthreads;
+    } /* end for */
+#ifdef H5Z_SPLIT_THREADS
+    if(nthreads > 1) {
+        pthread_t   threads[H5Z_SPLIT_MAX_NTHREADS];    /* Threads started */
+        hbool_t     started[H5Z_SPLIT_MAX_NTHREADS];    /* Whether each thread started */
+
+        for(u = 1; u < nthreads; u++)
+            started[u] = (0 == pthread_create(&threads[u], NULL, H5Z__split_worker, &work[u]));
+        H5Z__split_worker(&work[0]);
+
+        /* Filter the shares of threads that couldn't be started here */
+        for(u = 1; u < nthreads; u++)
+            if(!started[u])
+                H5Z__split_worker(&work[u]);
+
+        for(u = 1; u < nthreads; u++)
+            if(started[u] && 0 != pthread_join(threads[u], NULL))
+                join_failed = TRUE;
+    } /* end if */
+    else
+#endif /* H5Z_SPLIT_THREADS */
+        H5Z__split_worker(&work[0]);
+    H5Z_size_hint_g = size_hint;
+#ifdef H5Z_SPLIT_THREADS
+    if(join_failed)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "can't join sub-block filter thread")
+#endif /* H5Z_SPLIT_THREADS */
+
+    for(u = 0; u < nblocks; u++)
+        if(0 == blocks[u].nbytes)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "filter failed on sub-block")
+
+    /* Combine the filtered sub-blocks */
+    if(fclass->merge) {
+        size_t      merge_nbytes[H5Z_SPLIT_MAX_NBLOCKS];    /* Filtered sub-block sizes */
+        const void  *merge_bufs[H5Z_SPLIT_MAX_NBLOCKS];     /* Filtered sub-blocks */
+
+        for(u = 0; u < nblocks; u++) {
+            merge_nbytes[u] = blocks[u].nbytes;
+            merge_bufs[u] = blocks[u].buf;
+        } /* end for */
+        if(0 == (ret_value = (fclass->merge)(flags, filter->cd_nelmts, filter->cd_values,
+                nblocks, merge_nbytes, merge_bufs, buf_size, buf)))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "\"merge\" callback failed")
+    } /* end if */
+    else {
+        size_t      total = 0;          /* Size of the concatenated sub-blocks */
+        uint8_t     *p;                 /* Pointer into output buffer */
+
+        for(u = 0; u < nblocks; u++)
+            total += blocks[u].nbytes;
+        if(total > *buf_size) {
+            void *new_buf;              /* Larger output buffer */
+
+            if(NULL == (new_buf = H5Z_buf_alloc(total)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for filter buffer")
+            H5Z_buf_free(*buf, *buf_size);
+            *buf = new_buf;
+            *buf_size = total;
+        } /* end if */
+        for(u = 0, p = (uint8_t *)*buf; u < nblocks; u++) {
+            HDmemcpy(p, blocks[u].buf, blocks[u].nbytes);
+            p += blocks[u].nbytes;
+        } /* end for */
+        ret_value = total;
+    } /* end else */
+
+done:
+    for(u = 0; u < nalloc; u++)
+        H5MM_xfree(blocks[u].buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_apply() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__split_worker
+ *
+ * Purpose:	Runs a filter over one thread's share of the sub-blocks of
+ *		a buffer.  This may be called from threads other than the
+ *		one that entered the library, so it calls nothing but the
+ *		filter function.
+ *
+ * Return:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5Z__split_worker(void *_work)
+{
+    H5Z_split_work_t *work = (H5Z_split_work_t *)_work;
+    size_t      u;                      /* Local index variable */
+
+    for(u = work->first; u < work->nblocks; u += work->stride) {
+        H5Z_split_block_t *block = &work->blocks[u];
+
+        block->nbytes = (work->fclass->filter)(work->flags, work->cd_nelmts,
+                work->cd_values, block->nbytes, &block->buf_size, &block->buf);
+    } /* end for */
+
+    return NULL;
+} /* end H5Z__split_worker() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_buf_alloc
+ *
+ * Purpose:	Allocate a buffer for filtered data, reusing one from the
+ *		filter buffer pool when a suitable one is available.  The
+ *		buffer returned is an ordinary H5MM_malloc() block of at
+ *		least SIZE bytes, so filters that know nothing of the pool
+ *		may resize or free it as usual.
+ *
+ *		A pooled buffer is only handed out if it is no more than
+ *		twice the size requested, so that small requests don't tie
+ *		up large buffers.  The pool is locked when filters may run
+ *		on several threads.
+ *
+ * Return:	Success:	Pointer to the buffer
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5Z_buf_alloc(size_t size)
+{
+    size_t      best = H5Z_BUF_POOL_NSLOTS;     /* Best fitting pool entry */
+    size_t      u;                              /* Local index variable */
+    void        *ret_value = NULL;              /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(size);
+
+    /* Look for the smallest pooled buffer that's big enough */
+    H5Z_BUF_POOL_LOCK
+    for(u = 0; u < H5Z_BUF_POOL_NSLOTS; u++)
+        if(H5Z_buf_pool_g[u].buf && H5Z_buf_pool_g[u].size >= size
+                && (H5Z_buf_pool_g[u].size / 2) <= size
+                && (best == H5Z_BUF_POOL_NSLOTS
+                    || H5Z_buf_pool_g[u].size < H5Z_buf_pool_g[best].size))
+            best = u;
+
+    if(best < H5Z_BUF_POOL_NSLOTS) {
+        ret_value = H5Z_buf_pool_g[best].buf;
+        H5Z_buf_pool_nbytes_g -= H5Z_buf_pool_g[best].size;
+        H5Z_buf_pool_g[best].buf = NULL;
+        H5Z_buf_pool_g[best].size = 0;
+    } /* end if */
+    H5Z_BUF_POOL_UNLOCK
+
+    if(NULL == ret_value)
+        ret_value = H5MM_malloc(size);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_buf_alloc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_buf_free
+ *
+ * Purpose:	Release a buffer for filtered data, keeping it in the
+ *		filter buffer pool for reuse when there's room.  BUF must
+ *		have been allocated with H5MM_malloc() (or H5Z_buf_alloc())
+ *		and SIZE must not exceed its allocated size; a smaller
+ *		SIZE only means the buffer is reused less often.
+ *
+ *		When the pool is full the smallest pooled buffer is
+ *		replaced, if BUF is larger than it.
+ *
+ * Return:	NULL (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5Z_buf_free(void *buf, size_t size)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(buf) {
+        void    *evicted = buf;                 /* Buffer to free */
+        size_t  victim = H5Z_BUF_POOL_NSLOTS;   /* Pool entry to store into */
+        size_t  u;                              /* Local index variable */
+
+        /* Find an empty pool entry, or else the one with the smallest buffer */
+        H5Z_BUF_POOL_LOCK
+        if(size >= H5Z_BUF_POOL_MIN_SIZE)
+            for(u = 0; u < H5Z_BUF_POOL_NSLOTS; u++) {
+                if(NULL == H5Z_buf_pool_g[u].buf) {
+                    victim = u;
+                    break;
+                } /* end if */
+                if(victim == H5Z_BUF_POOL_NSLOTS
+                        || H5Z_buf_pool_g[u].size < H5Z_buf_pool_g[victim].size)
+                    victim = u;
+            } /* end for */
+
+        if(victim < H5Z_BUF_POOL_NSLOTS && H5Z_buf_pool_g[victim].size < size
+                && (H5Z_buf_pool_nbytes_g - H5Z_buf_pool_g[victim].size + size) <= H5Z_BUF_POOL_MAX_BYTES) {
+            /* Evict the buffer in the entry, if there is one */
+            evicted = H5Z_buf_pool_g[victim].buf;
+            H5Z_buf_pool_nbytes_g -= H5Z_buf_pool_g[victim].size;
+
+            H5Z_buf_pool_g[victim].buf = buf;
+            H5Z_buf_pool_g[victim].size = size;
+            H5Z_buf_pool_nbytes_g += size;
+        } /* end if */
+        H5Z_BUF_POOL_UNLOCK
+
+        H5MM_xfree(evicted);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(NULL)
+} /* end H5Z_buf_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_garbage_coll
+ *
+ * Purpose:	Free all the buffers in the filter buffer pool.  Called
+ *		from H5garbage_collect() and when the interface is shut
+ *		down.
+ *
+ * Return:	Non-negative (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Z_garbage_coll(void)
+{
+    size_t      u;              /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    H5Z_BUF_POOL_LOCK
+    for(u = 0; u < H5Z_BUF_POOL_NSLOTS; u++) {
+        H5Z_buf_pool_g[u].buf = H5MM_xfree(H5Z_buf_pool_g[u].buf);
+        H5Z_buf_pool_g[u].size = 0;
+    } /* end for */
+    H5Z_buf_pool_nbytes_g = 0;
+    H5Z_BUF_POOL_UNLOCK
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5Z_garbage_coll() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5Z_filter_info
  *
@@ -1689,7 +2149,7 @@ done:
 herr_t
 H5Z_get_filter_info(H5Z_filter_t filter, unsigned int *filter_config_flags)
 {
-    H5Z_class2_t *fclass;
+    H5Z_class3_t *fclass;
     herr_t ret_value = SUCCEED;
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -1706,9 +2166,389 @@ H5Z_get_filter_info(H5Z_filter_t filter, unsigned int *filter_config_flags)
             *filter_config_flags |= H5Z_FILTER_CONFIG_ENCODE_ENABLED;
         if(fclass->decoder_present)
             *filter_config_flags |= H5Z_FILTER_CONFIG_DECODE_ENABLED;
+        if(fclass->flags & H5Z_CLASS_THREADSAFE)
+            *filter_config_flags |= H5Z_FILTER_CONFIG_THREADSAFE;
+        if(fclass->split)
+            *filter_config_flags |= H5Z_FILTER_CONFIG_SPLIT;
     } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5Z_get_filter_info() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5Zget_filter_stats
+ *
+ * Purpose: Retrieves the statistics collected for a registered filter
+ *          since it was registered or since the last call to
+ *          H5Zreset_filter_stats.  Statistics are kept for every run of
+ *          the filter through a pipeline, in every file.
+ *
+ * Return: Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Zget_filter_stats(H5Z_filter_t id, H5Z_filter_stats_t *stats)
+{
+    int         idx;                    /* Filter index in global table */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "Zf*x", id, stats);
+
+    /* Check args */
+    if(id < 0 || id > H5Z_FILTER_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid filter identification number")
+    if(NULL == stats)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no statistics buffer")
+    if((idx = H5Z_find_idx(id)) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_NOTFOUND, FAIL, "filter is not registered")
+
+    *stats = H5Z_stat_table_g[idx];
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Zget_filter_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: H5Zreset_filter_stats
+ *
+ * Purpose: Zeroes the statistics collected for a registered filter, or
+ *          for all registered filters if ID is H5Z_FILTER_ALL.
+ *
+ * Return: Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Zreset_filter_stats(H5Z_filter_t id)
+{
+    int         idx;                    /* Filter index in global table */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "Zf", id);
+
+    /* Check args */
+    if(id < 0 || id > H5Z_FILTER_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid filter identification number")
+
+    if(H5Z_FILTER_ALL == id) {
+        if(H5Z_table_used_g > 0)
+            HDmemset(H5Z_stat_table_g, 0, H5Z_table_used_g * sizeof(H5Z_filter_stats_t));
+    } /* end if */
+    else {
+        if((idx = H5Z_find_idx(id)) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_NOTFOUND, FAIL, "filter is not registered")
+        HDmemset(&H5Z_stat_table_g[idx], 0, sizeof(H5Z_filter_stats_t));
+    } /* end else */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Zreset_filter_stats() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Bit packing for the n-bit and scale-offset filters.
+ *
+ * Both filters store the PRECISION significant bits of each element,
+ * starting OFFSET bits above the element's least significant bit, as a
+ * continuous big-endian bit stream: the most significant stored bit of
+ * an element comes first, and the first bit of the stream is the most
+ * significant bit of the first byte.  The routines below move those bits
+ * through a 64-bit accumulator, 32 bits at a time, instead of one output
+ * byte at a time.
+ *-------------------------------------------------------------------------
+ */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_bits_get_elmt
+ *
+ * Purpose:	Loads an element of SIZE (<= 8) bytes in the given byte
+ *              order into an integer.
+ *
+ * Return:	The element's value
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE uint64_t
+H5Z_bits_get_elmt(const unsigned char *elmt, size_t size, hbool_t little_endian)
+{
+    uint64_t val = 0;
+    size_t u;
+
+    if(little_endian)
+        for(u = size; u > 0; u--)
+            val = (val << 8) | elmt[u - 1];
+    else
+        for(u = 0; u < size; u++)
+            val = (val << 8) | elmt[u];
+
+    return val;
+} /* end H5Z_bits_get_elmt() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_bits_set_elmt
+ *
+ * Purpose:	Stores an integer into an element of SIZE (<= 8) bytes in
+ *              the given byte order.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE void
+H5Z_bits_set_elmt(unsigned char *elmt, size_t size, hbool_t little_endian,
+    uint64_t val)
+{
+    size_t u;
+
+    if(little_endian)
+        for(u = 0; u < size; u++, val >>= 8)
+            elmt[u] = (unsigned char)val;
+    else
+        for(u = size; u > 0; u--, val >>= 8)
+            elmt[u - 1] = (unsigned char)val;
+} /* end H5Z_bits_set_elmt() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_pack_bits_kernel
+ *
+ * Purpose:	Packs the significant bits of NELMTS elements into BUFFER.
+ *              Inlined into H5Z_pack_bits() once per common element size,
+ *              so the element loads are specialized for that size.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE void
+H5Z_pack_bits_kernel(const unsigned char *data, size_t nelmts, size_t size,
+    hbool_t little_endian, unsigned precision, unsigned offset,
+    unsigned char *buffer)
+{
+    uint64_t mask = (precision < 64) ? (((uint64_t)1 << precision) - 1) : ~(uint64_t)0;
+    uint64_t acc = 0;           /* Pending bits, most significant bit first */
+    unsigned nbits = 0;         /* Number of pending bits (always < 32 between elements) */
+    size_t i;
+
+    for(i = 0; i < nelmts; i++, data += size) {
+        uint64_t val = (H5Z_bits_get_elmt(data, size, little_endian) >> offset) & mask;
+        unsigned len = precision;
+
+        /* Append values wider than 32 bits in two pieces, so the pending
+         * bits and the new ones always fit in the accumulator */
+        if(len > 32) {
+            len -= 32;
+            acc |= (val >> 32) << (64 - nbits - len);
+            nbits += len;
+            if(nbits >= 32) {
+                buffer[0] = (unsigned char)(acc >> 56);
+                buffer[1] = (unsigned char)(acc >> 48);
+                buffer[2] = (unsigned char)(acc >> 40);
+                buffer[3] = (unsigned char)(acc >> 32);
+                buffer += 4;
+                acc <<= 32;
+                nbits -= 32;
+            } /* end if */
+            val &= 0xffffffff;
+            len = 32;
+        } /* end if */
+
+        acc |= val << (64 - nbits - len);
+        nbits += len;
+
+        /* Flush a full 32-bit word */
+        if(nbits >= 32) {
+            buffer[0] = (unsigned char)(acc >> 56);
+            buffer[1] = (unsigned char)(acc >> 48);
+            buffer[2] = (unsigned char)(acc >> 40);
+            buffer[3] = (unsigned char)(acc >> 32);
+            buffer += 4;
+            acc <<= 32;
+            nbits -= 32;
+        } /* end if */
+    } /* end for */
+
+    /* Flush the remaining bits, padding the last byte with zeroes */
+    while(nbits > 0) {
+        *buffer++ = (unsigned char)(acc >> 56);
+        acc <<= 8;
+        nbits = (nbits > 8) ? (nbits - 8) : 0;
+    } /* end while */
+} /* end H5Z_pack_bits_kernel() */
+
+
+/* Take the next LEN (1..32) bits from the stream into VAL, refilling the
+ * accumulator a whole 32-bit word at a time when there is one, and bytewise
+ * near the end of the buffer (a short buffer reads as zero bits) */
+#define H5Z_UNPACK_BITS_GET(VAL, LEN)                                         \
+do {                                                                          \
+    if(nbits < (LEN)) {                                                       \
+        if(buffer + 4 <= buf_end) {                                           \
+            acc |= (((uint64_t)buffer[0] << 24) | ((uint64_t)buffer[1] << 16) | \
+                    ((uint64_t)buffer[2] << 8) | (uint64_t)buffer[3]) << (32 - nbits); \
+            buffer += 4;                                                      \
+            nbits += 32;                                                      \
+        }                                                                     \
+        else                                                                  \
+            while(nbits < (LEN)) {                                            \
+                if(buffer < buf_end)                                          \
+                    acc |= (uint64_t)*buffer++ << (56 - nbits);               \
+                nbits += 8;                                                   \
+            }                                                                 \
+    }                                                                         \
+    (VAL) = acc >> (64 - (LEN));                                              \
+    acc <<= (LEN);                                                            \
+    nbits -= (LEN);                                                           \
+} while(0)
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_unpack_bits_kernel
+ *
+ * Purpose:	Unpacks NELMTS elements from BUFFER.  Inlined into
+ *              H5Z_unpack_bits() once per common element size.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE void
+H5Z_unpack_bits_kernel(unsigned char *data, size_t nelmts, size_t size,
+    hbool_t little_endian, unsigned precision, unsigned offset,
+    const unsigned char *buffer, size_t buffer_size)
+{
+    const unsigned char *buf_end = buffer + buffer_size;
+    uint64_t acc = 0;           /* Unread bits, most significant bit first */
+    unsigned nbits = 0;         /* Number of unread bits */
+    unsigned hi_len = (precision > 32) ? (precision - 32) : 0;  /* Bits above the low 32 */
+    unsigned lo_len = precision - hi_len;                       /* Bits in the low 32 */
+    size_t i;
+
+    for(i = 0; i < nelmts; i++, data += size) {
+        uint64_t val = 0;
+
+        /* Take values wider than 32 bits in two pieces */
+        if(hi_len > 0) {
+            H5Z_UNPACK_BITS_GET(val, hi_len);
+            val <<= lo_len;
+        } /* end if */
+        {
+            uint64_t lo;
+
+            H5Z_UNPACK_BITS_GET(lo, lo_len);
+            val |= lo;
+        }
+
+        H5Z_bits_set_elmt(data, size, little_endian, val << offset);
+    } /* end for */
+} /* end H5Z_unpack_bits_kernel() */
+
+#undef H5Z_UNPACK_BITS_GET
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_pack_bits
+ *
+ * Purpose:	Packs the PRECISION bits starting at bit OFFSET of each of
+ *              NELMTS elements of SIZE (<= 8) bytes into the bit stream
+ *              used by the n-bit and scale-offset filters.  BUFFER must
+ *              hold at least (NELMTS * PRECISION + 7) / 8 bytes; bits of
+ *              elements outside the selected range are ignored.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5Z_pack_bits(const unsigned char *data, size_t nelmts, size_t size,
+    hbool_t little_endian, unsigned precision, unsigned offset,
+    unsigned char *buffer)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(data);
+    HDassert(buffer);
+    HDassert(size > 0 && size <= 8);
+    HDassert(precision > 0 && precision + offset <= size * 8);
+
+    switch(size) {
+        case 1:
+            H5Z_pack_bits_kernel(data, nelmts, (size_t)1, little_endian, precision, offset, buffer);
+            break;
+
+        case 2:
+            H5Z_pack_bits_kernel(data, nelmts, (size_t)2, little_endian, precision, offset, buffer);
+            break;
+
+        case 4:
+            H5Z_pack_bits_kernel(data, nelmts, (size_t)4, little_endian, precision, offset, buffer);
+            break;
+
+        case 8:
+            H5Z_pack_bits_kernel(data, nelmts, (size_t)8, little_endian, precision, offset, buffer);
+            break;
+
+        default:
+            H5Z_pack_bits_kernel(data, nelmts, size, little_endian, precision, offset, buffer);
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z_pack_bits() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_unpack_bits
+ *
+ * Purpose:	Reverses H5Z_pack_bits(), reading the bit stream from
+ *              BUFFER_SIZE bytes of BUFFER.  Every byte of the NELMTS
+ *              elements in DATA is written; bits outside the selected
+ *              range are set to zero.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5Z_unpack_bits(unsigned char *data, size_t nelmts, size_t size,
+    hbool_t little_endian, unsigned precision, unsigned offset,
+    const unsigned char *buffer, size_t buffer_size)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(data);
+    HDassert(buffer);
+    HDassert(size > 0 && size <= 8);
+    HDassert(precision > 0 && precision + offset <= size * 8);
+
+    switch(size) {
+        case 1:
+            H5Z_unpack_bits_kernel(data, nelmts, (size_t)1, little_endian, precision, offset, buffer, buffer_size);
+            break;
+
+        case 2:
+            H5Z_unpack_bits_kernel(data, nelmts, (size_t)2, little_endian, precision, offset, buffer, buffer_size);
+            break;
+
+        case 4:
+            H5Z_unpack_bits_kernel(data, nelmts, (size_t)4, little_endian, precision, offset, buffer, buffer_size);
+            break;
+
+        case 8:
+            H5Z_unpack_bits_kernel(data, nelmts, (size_t)8, little_endian, precision, offset, buffer, buffer_size);
+            break;
+
+        default:
+            H5Z_unpack_bits_kernel(data, nelmts, size, little_endian, precision, offset, buffer, buffer_size);
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z_unpack_bits() */
@@ -95,8 +95,12 @@ H5Z_filter_deflate (unsigned flags, size_t cd_nelmts,
 	z_stream	z_strm;                 /* zlib parameters */
 	size_t		nalloc = *buf_size;     /* Number of bytes for output (compressed) buffer */
 
+        /* Start with the expected size of the uncompressed data, if known */
+        if(H5Z_size_hint_g > 0)
+            nalloc = H5Z_size_hint_g;
+
         /* Allocate space for the compressed buffer */
-	if (NULL==(outbuf = H5MM_malloc(nalloc)))
+	if (NULL==(outbuf = H5Z_buf_alloc(nalloc)))
 	    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for deflate uncompression")
 
         /* Set the uncompression parameters */
@@ -145,7 +149,7 @@ H5Z_filter_deflate (unsigned flags, size_t cd_nelmts,
 	} while(status==Z_OK);
 
         /* Free the input buffer */
-	H5MM_xfree(*buf);
+	H5Z_buf_free(*buf, *buf_size);
 
         /* Set return values */
 	*buf = outbuf;
@@ -172,7 +176,7 @@ H5Z_filter_deflate (unsigned flags, size_t cd_nelmts,
         H5_CHECKED_ASSIGN(aggression, int, cd_values[0], unsigned);
 
         /* Allocate output (compressed) buffer */
-	if(NULL == (outbuf = H5MM_malloc(z_dst_nbytes)))
+	if(NULL == (outbuf = H5Z_buf_alloc(z_dst_nbytes)))
 	    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate deflate destination buffer")
         z_dst = (Bytef *)outbuf;
 
@@ -189,7 +193,7 @@ H5Z_filter_deflate (unsigned flags, size_t cd_nelmts,
         /* Successfully uncompressed the buffer */
         else {
             /* Free the input buffer */
-	    H5MM_xfree(*buf);
+	    H5Z_buf_free(*buf, *buf_size);
 
             /* Set return values */
 	    *buf = outbuf;
@@ -64,7 +64,7 @@ static void H5Z_nbit_decompress_one_array(unsigned char *data, size_t data_offse
            unsigned char *buffer, size_t *j, int *buf_len, const unsigned parms[]);
 static void H5Z_nbit_decompress_one_compound(unsigned char *data, size_t data_offset,
               unsigned char *buffer, size_t *j, int *buf_len, const unsigned parms[]);
-static void H5Z_nbit_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
+static void H5Z_nbit_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer, size_t buffer_size,
                                 const unsigned parms[]);
 static void H5Z_nbit_compress_one_nooptype(unsigned char *data, size_t data_offset,
                      unsigned char *buffer, size_t *j, int *buf_len, unsigned size);
@@ -893,11 +893,11 @@ H5Z_filter_nbit(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
         size_out = d_nelmts * cd_values[4]; /* cd_values[4] stores datatype size */
 
         /* allocate memory space for decompressed buffer */
-        if(NULL == (outbuf = (unsigned char *)H5MM_malloc(size_out)))
+        if(NULL == (outbuf = (unsigned char *)H5Z_buf_alloc(size_out)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for nbit decompression")
 
         /* decompress the buffer */
-        H5Z_nbit_decompress(outbuf, d_nelmts, (unsigned char *)*buf, cd_values);
+        H5Z_nbit_decompress(outbuf, d_nelmts, (unsigned char *)*buf, nbytes, cd_values);
     } /* end if */
     /* output; compress */
     else {
@@ -906,7 +906,7 @@ H5Z_filter_nbit(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
         size_out = nbytes;
 
         /* allocate memory space for compressed buffer */
-        if(NULL == (outbuf = (unsigned char *)H5MM_malloc(size_out)))
+        if(NULL == (outbuf = (unsigned char *)H5Z_buf_alloc(size_out)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for nbit compression")
 
         /* compress the buffer, size_out will be changed */
@@ -914,7 +914,7 @@ H5Z_filter_nbit(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
     } /* end else */
 
     /* free the input buffer */
-    H5MM_xfree(*buf);
+    H5Z_buf_free(*buf, *buf_size);
 
     /* set return values */
     *buf = outbuf;
@@ -1139,7 +1139,7 @@ H5Z_nbit_decompress_one_compound(unsigned char *data, size_t data_offset,
 
 static void
 H5Z_nbit_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
-                                const unsigned parms[])
+                    size_t buffer_size, const unsigned parms[])
 {
    /* i: index of data, j: index of buffer,
       buf_len: number of bits to be filled in current byte */
@@ -1147,6 +1147,14 @@ H5Z_nbit_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffe
    int buf_len;
    parms_atomic p;
 
+   /* atomic datatypes of up to 8 bytes are unpacked a word at a time */
+   if(parms[3] == H5Z_NBIT_ATOMIC && parms[4] <= 8) {
+      H5Z_unpack_bits(data, (size_t)d_nelmts, (size_t)parms[4],
+                      (hbool_t)(parms[5] == H5Z_NBIT_ORDER_LE), parms[6], parms[7],
+                      buffer, buffer_size);
+      return;
+   }
+
    /* may not have to initialize to zeros */
    for(i = 0; i < d_nelmts*parms[4]; i++) data[i] = 0;
 
@@ -1380,6 +1388,21 @@ static void H5Z_nbit_compress(unsigned char *data, unsigned d_nelmts, unsigned c
    int buf_len;
    parms_atomic p;
 
+   /* atomic datatypes of up to 8 bytes are packed a word at a time */
+   if(parms[3] == H5Z_NBIT_ATOMIC && parms[4] <= 8) {
+      size_t nbits = (size_t)d_nelmts * parms[6];
+
+      H5Z_pack_bits(data, (size_t)d_nelmts, (size_t)parms[4],
+                    (hbool_t)(parms[5] == H5Z_NBIT_ORDER_LE), parms[6], parms[7],
+                    buffer);
+
+      /* zero the rest of the buffer, and report the size the same way as
+       * the bytewise code below: the number of complete bytes plus one */
+      HDmemset(buffer + (nbits + 7) / 8, 0, *buffer_size - (nbits + 7) / 8);
+      *buffer_size = nbits / 8 + 1;
+      return;
+   }
+
    /* must initialize buffer to be zeros */
    HDmemset(buffer, 0, *buffer_size);
 
@@ -53,5 +53,31 @@ H5_DLLVAR const H5Z_class2_t H5Z_DEFLATE[1];
 H5_DLLVAR H5Z_class2_t H5Z_SZIP[1];
 #endif /* H5_HAVE_FILTER_SZIP */
 
+/*****************************/
+/* Package Private Variables */
+/*****************************/
+
+/* Expected size of the de-filtered data on the reverse path (0 if unknown).
+ * Only the thread that entered the library sets it, and it is 0 while the
+ * sub-blocks of a buffer are filtered, so each call of a filter sees the
+ * hint for the buffer it was given.
+ */
+H5_DLLVAR size_t H5Z_size_hint_g;
+
+/* Bytes held in the filter buffer pool */
+H5_DLLVAR size_t H5Z_buf_pool_nbytes_g;
+
+/******************************/
+/* Package Private Prototypes */
+/******************************/
+
+/* Bit packing shared by the n-bit and scale-offset filters */
+H5_DLL void H5Z_pack_bits(const unsigned char *data, size_t nelmts,
+    size_t size, hbool_t little_endian, unsigned precision, unsigned offset,
+    unsigned char *buffer);
+H5_DLL void H5Z_unpack_bits(unsigned char *data, size_t nelmts, size_t size,
+    hbool_t little_endian, unsigned precision, unsigned offset,
+    const unsigned char *buffer, size_t buffer_size);
+
 #endif /* _H5Zpkg_H */
 
@@ -73,17 +73,20 @@ struct H5O_pline_t; /*forward decl*/
 
 /* Internal API routines */
 H5_DLL herr_t H5Z_init(void);
-H5_DLL herr_t H5Z_register(const H5Z_class2_t *cls);
+H5_DLL herr_t H5Z_register(const void *cls);
 H5_DLL herr_t H5Z_append(struct H5O_pline_t *pline, H5Z_filter_t filter,
         unsigned flags, size_t cd_nelmts, const unsigned int cd_values[]);
 H5_DLL herr_t H5Z_modify(const struct H5O_pline_t *pline, H5Z_filter_t filter,
         unsigned flags, size_t cd_nelmts, const unsigned int cd_values[]);
 H5_DLL herr_t H5Z_pipeline(const struct H5O_pline_t *pline,
 			    unsigned flags, unsigned *filter_mask/*in,out*/,
- 			    H5Z_EDC_t edc_read, H5Z_cb_t cb_struct,
+ 			    H5Z_EDC_t edc_read, H5Z_cb_t cb_struct, size_t size_hint,
 			    size_t *nbytes/*in,out*/, size_t *buf_size/*in,out*/,
-                            void **buf/*in,out*/);
-H5_DLL H5Z_class2_t *H5Z_find(H5Z_filter_t id);
+                            void **buf/*in,out*/, double *elapsed/*out*/);
+H5_DLL void *H5Z_buf_alloc(size_t size);
+H5_DLL void *H5Z_buf_free(void *buf, size_t size);
+H5_DLL herr_t H5Z_garbage_coll(void);
+H5_DLL H5Z_class3_t *H5Z_find(H5Z_filter_t id);
 H5_DLL herr_t H5Z_can_apply(hid_t dcpl_id, hid_t type_id);
 H5_DLL herr_t H5Z_set_local(hid_t dcpl_id, hid_t type_id);
 H5_DLL herr_t H5Z_can_apply_direct(const struct H5O_pline_t *pline);
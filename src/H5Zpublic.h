@@ -105,6 +105,13 @@ typedef enum H5Z_SO_scale_type_t {
 /* Current version of the H5Z_class_t struct */
 #define H5Z_CLASS_T_VERS (1)
 
+/* Version of the H5Z_class3_t struct */
+#define H5Z_CLASS3_T_VERS (3)
+
+/* Filter class capability flags (for the "flags" field of H5Z_class3_t) */
+#define H5Z_CLASS_THREADSAFE    (0x0001)   /* Filter function is reentrant */
+#define H5Z_CLASS_ALL_FLAGS     (H5Z_CLASS_THREADSAFE)
+
 /* Values to decide if EDC is enabled for reading data */
 typedef enum H5Z_EDC_t {
     H5Z_ERROR_EDC       = -1,   /* error value */
@@ -116,6 +123,8 @@ typedef enum H5Z_EDC_t {
 /* Bit flags for H5Zget_filter_info */
 #define H5Z_FILTER_CONFIG_ENCODE_ENABLED (0x0001)
 #define H5Z_FILTER_CONFIG_DECODE_ENABLED (0x0002)
+#define H5Z_FILTER_CONFIG_THREADSAFE     (0x0004)
+#define H5Z_FILTER_CONFIG_SPLIT          (0x0008)
 
 /* Return values for filter callback function */
 typedef enum H5Z_cb_return_t {
@@ -203,6 +212,46 @@ typedef size_t (*H5Z_func_t)(unsigned int flags, size_t cd_nelmts,
 			     const unsigned int cd_values[], size_t nbytes,
 			     size_t *buf_size, void **buf);
 
+/*
+ * A filter that can process a buffer as a number of independent sub-blocks
+ * may supply a "split" callback.  It receives the same arguments as the
+ * filter function, plus the data in BUF, and describes up to MAX_BLOCKS
+ * sub-blocks of it by storing their offsets and sizes in BLOCK_OFFSET and
+ * BLOCK_NBYTES.  When H5Z_FLAG_REVERSE is clear the data is unfiltered and
+ * the filter may partition it as it likes; when it is set the data is the
+ * output of a previous "merge" and the callback must locate the filtered
+ * sub-blocks within it.
+ *
+ * The library runs the filter function on each sub-block separately, in
+ * its own buffer, and then hands the results to the "merge" callback.
+ * That callback stores the combined result in *BUF, following the same
+ * rules as the filter function for replacing the buffer, and returns the
+ * number of bytes in it.  When the "merge" callback is the NULL pointer
+ * the library simply concatenates the sub-blocks.
+ *
+ * The "split" callback returns the number of sub-blocks it described; a
+ * value less than two makes the library pass the whole buffer to the
+ * filter function as usual, so the filter function must always be able to
+ * handle the merged form of its own output.  The "merge" callback returns
+ * zero on failure.
+ *
+ * If the filter class also sets H5Z_CLASS_THREADSAFE, the sub-blocks may
+ * be filtered concurrently in threads other than the one that called the
+ * library.  The filter function must then not call the HDF5 library.
+ * Chunks themselves are still filtered one at a time.  The library's own
+ * filters have no "split" callbacks, since dividing their output would
+ * change the data they store.
+ */
+typedef size_t (*H5Z_split_func_t)(unsigned int flags, size_t cd_nelmts,
+                                   const unsigned int cd_values[], size_t nbytes,
+                                   const void *buf, size_t max_blocks,
+                                   size_t block_offset[], size_t block_nbytes[]);
+typedef size_t (*H5Z_merge_func_t)(unsigned int flags, size_t cd_nelmts,
+                                   const unsigned int cd_values[], size_t nblocks,
+                                   const size_t block_nbytes[],
+                                   const void *const blocks[],
+                                   size_t *buf_size, void **buf);
+
 /*
  * The filter table maps filter identification numbers to structs that
  * contain a pointers to the filter function and timing statistics.
@@ -218,10 +267,50 @@ typedef struct H5Z_class2_t {
     H5Z_func_t filter;		/* The actual filter function		     */
 } H5Z_class2_t;
 
+/*
+ * Filters with capability flags or "split" and "merge" callbacks register
+ * an H5Z_class3_t instead, with its version set to H5Z_CLASS3_T_VERS.
+ * Filters registered with an H5Z_class2_t have none of the capabilities,
+ * and are always run serially on whole buffers.
+ */
+typedef struct H5Z_class3_t {
+    int version;                /* Version number of the struct (H5Z_CLASS3_T_VERS) */
+    H5Z_filter_t id;		/* Filter ID number			     */
+    unsigned encoder_present;   /* Does this filter have an encoder? */
+    unsigned decoder_present;   /* Does this filter have a decoder? */
+    const char	*name;		/* Comment for debugging		     */
+    H5Z_can_apply_func_t can_apply; /* The "can apply" callback for a filter */
+    H5Z_set_local_func_t set_local; /* The "set local" callback for a filter */
+    H5Z_func_t filter;		/* The actual filter function		     */
+    unsigned flags;             /* Capability flags (H5Z_CLASS_*)            */
+    H5Z_split_func_t split;     /* The "split" callback for a filter         */
+    H5Z_merge_func_t merge;     /* The "merge" callback for a filter         */
+} H5Z_class3_t;
+
+/*
+ * Statistics collected for each registered filter, retrieved with
+ * H5Zget_filter_stats().  Failed calls count towards the bytes passed to a
+ * filter and its time, but produce no output bytes.
+ */
+typedef struct H5Z_filter_dir_stats_t {
+    hsize_t     calls;          /* Number of times the filter was applied */
+    hsize_t     failed;         /* Number of those calls that failed */
+    hsize_t     bytes_in;       /* Bytes passed to the filter */
+    hsize_t     bytes_out;      /* Bytes produced by the filter */
+    double      time;           /* Seconds spent in the filter */
+} H5Z_filter_dir_stats_t;
+
+typedef struct H5Z_filter_stats_t {
+    H5Z_filter_dir_stats_t encode;      /* Filtering data for writing */
+    H5Z_filter_dir_stats_t decode;      /* Filtering data read (H5Z_FLAG_REVERSE) */
+} H5Z_filter_stats_t;
+
 H5_DLL herr_t H5Zregister(const void *cls);
 H5_DLL herr_t H5Zunregister(H5Z_filter_t id);
 H5_DLL htri_t H5Zfilter_avail(H5Z_filter_t id);
 H5_DLL herr_t H5Zget_filter_info(H5Z_filter_t filter, unsigned int *filter_config_flags);
+H5_DLL herr_t H5Zget_filter_stats(H5Z_filter_t id, H5Z_filter_stats_t *stats /*out*/);
+H5_DLL herr_t H5Zreset_filter_stats(H5Z_filter_t id);
 
 /* Symbols defined for compatibility with previous versions of the HDF5 API.
  *
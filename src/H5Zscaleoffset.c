@@ -62,19 +62,8 @@ static herr_t H5Z_scaleoffset_precompress_fd(void *data, unsigned d_nelmts,
 static herr_t H5Z_scaleoffset_postdecompress_fd(void *data, unsigned d_nelmts,
     enum H5Z_scaleoffset_t type, unsigned filavail, const unsigned cd_values[],
     uint32_t minbits, unsigned long long minval, double D_val);
-static void H5Z_scaleoffset_next_byte(size_t *j, unsigned *buf_len);
-static void H5Z_scaleoffset_decompress_one_byte(unsigned char *data, size_t data_offset,
-    unsigned k, unsigned begin_i, unsigned char *buffer, size_t *j, unsigned *buf_len,
-    parms_atomic p, unsigned dtype_len);
-static void H5Z_scaleoffset_compress_one_byte(unsigned char *data, size_t data_offset,
-    unsigned k, unsigned begin_i, unsigned char *buffer, size_t *j, unsigned *buf_len,
-    parms_atomic p, unsigned dtype_len);
-static void H5Z_scaleoffset_decompress_one_atomic(unsigned char *data, size_t data_offset,
-    unsigned char *buffer, size_t *j, unsigned *buf_len, parms_atomic p);
-static void H5Z_scaleoffset_compress_one_atomic(unsigned char *data, size_t data_offset,
-    unsigned char *buffer, size_t *j, unsigned *buf_len, parms_atomic p);
 static void H5Z_scaleoffset_decompress(unsigned char *data, unsigned d_nelmts,
-    unsigned char *buffer, parms_atomic p);
+    unsigned char *buffer, size_t buffer_size, parms_atomic p);
 static void H5Z_scaleoffset_compress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
     size_t buffer_size, parms_atomic p);
 
@@ -1169,7 +1158,7 @@ H5Z_filter_scaleoffset(unsigned flags, size_t cd_nelmts, const unsigned cd_value
         size_out = d_nelmts * p.size;
 
         /* allocate memory space for decompressed buffer */
-        if(NULL == (outbuf = (unsigned char *)H5MM_malloc(size_out)))
+        if(NULL == (outbuf = (unsigned char *)H5Z_buf_alloc(size_out)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for scaleoffset decompression")
 
         /* special case: minbits equal to full precision */
@@ -1189,7 +1178,7 @@ H5Z_filter_scaleoffset(unsigned flags, size_t cd_nelmts, const unsigned cd_value
 
         /* decompress the buffer if minbits not equal to zero */
         if(minbits != 0)
-            H5Z_scaleoffset_decompress(outbuf, d_nelmts, (unsigned char*)(*buf)+buf_offset, p);
+            H5Z_scaleoffset_decompress(outbuf, d_nelmts, (unsigned char*)(*buf)+buf_offset, nbytes - buf_offset, p);
         else {
             /* fill value is not defined and all data elements have the same value */
             for(i = 0; i < size_out; i++) outbuf[i] = 0;
@@ -1248,7 +1237,7 @@ H5Z_filter_scaleoffset(unsigned flags, size_t cd_nelmts, const unsigned cd_value
         size_out = buf_offset + nbytes * p.minbits / (p.size * 8) + 1; /* may be 1 larger */
 
         /* allocate memory space for compressed buffer */
-        if(NULL == (outbuf = (unsigned char *)H5MM_malloc(size_out)))
+        if(NULL == (outbuf = (unsigned char *)H5Z_buf_alloc(size_out)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for scaleoffset compression")
 
         /* store minbits and minval in the front of output compressed buffer
@@ -1291,7 +1280,7 @@ H5Z_filter_scaleoffset(unsigned flags, size_t cd_nelmts, const unsigned cd_value
     }
 
     /* free the input buffer */
-    H5MM_xfree(*buf);
+    H5Z_buf_free(*buf, *buf_size);
 
     /* set return values */
     *buf = outbuf;
@@ -1547,177 +1536,32 @@ done:
    FUNC_LEAVE_NOAPI(ret_value)
 }
 
-static void
-H5Z_scaleoffset_next_byte(size_t *j, unsigned *buf_len)
-{
-   ++(*j);
-   *buf_len = 8 * sizeof(unsigned char);
-}
-
-static void
-H5Z_scaleoffset_decompress_one_byte(unsigned char *data, size_t data_offset,
-    unsigned k, unsigned begin_i, unsigned char *buffer, size_t *j, unsigned *buf_len,
-    parms_atomic p, unsigned dtype_len)
-{
-   unsigned dat_len;    /* dat_len is the number of bits to be copied in each data byte */
-   unsigned char val;   /* value to be copied in each data byte */
-
-   /* initialize value and bits of unsigned char to be copied */
-   val = buffer[*j];
-   if(k == begin_i)
-      dat_len = 8 - (dtype_len - p.minbits) % 8;
-   else
-      dat_len = 8;
-
-   if(*buf_len > dat_len) {
-      data[data_offset + k] = (unsigned char)((val >> (*buf_len - dat_len)) & ~(~0 << dat_len));
-      *buf_len -= dat_len;
-   } /* end if */
-   else {
-      data[data_offset + k] = (unsigned char)((val & ~(~0 << *buf_len)) << (dat_len - *buf_len));
-      dat_len -= *buf_len;
-      H5Z_scaleoffset_next_byte(j, buf_len);
-      if(dat_len == 0)
-          return;
-
-      val = buffer[*j];
-      data[data_offset + k] |= (unsigned char)((val >> (*buf_len - dat_len)) & ~(~0 << dat_len));
-      *buf_len -= dat_len;
-   } /* end else */
-}
-
-static void
-H5Z_scaleoffset_decompress_one_atomic(unsigned char *data, size_t data_offset,
-    unsigned char *buffer, size_t *j, unsigned *buf_len, parms_atomic p)
-{
-   /* begin_i: the index of byte having first significant bit */
-   unsigned begin_i;
-   unsigned dtype_len;
-   int k;
-
-   HDassert(p.minbits > 0);
-
-   dtype_len = p.size * 8;
-
-   if(p.mem_order == H5Z_SCALEOFFSET_ORDER_LE) { /* little endian */
-      begin_i = p.size - 1 - (dtype_len - p.minbits) / 8;
-
-      for(k = (int)begin_i; k >= 0; k--)
-         H5Z_scaleoffset_decompress_one_byte(data, data_offset, (unsigned)k, begin_i,
-                                             buffer, j, buf_len, p, dtype_len);
-   }
-   else { /* big endian */
-      HDassert(p.mem_order == H5Z_SCALEOFFSET_ORDER_BE);
-
-      begin_i = (dtype_len - p.minbits) / 8;
-
-      for(k = (int)begin_i; k <= (int)(p.size - 1); k++)
-         H5Z_scaleoffset_decompress_one_byte(data, data_offset, (unsigned)k, begin_i,
-                                             buffer, j, buf_len, p, dtype_len);
-   }
-}
-
 static void
 H5Z_scaleoffset_decompress(unsigned char *data, unsigned d_nelmts,
-    unsigned char *buffer, parms_atomic p)
-{
-    /* i: index of data, j: index of buffer,
-       buf_len: number of bits to be filled in current byte */
-    size_t i, j;
-    unsigned buf_len;
-
-    /* must initialize to zeros */
-    for(i = 0; i < d_nelmts*p.size; i++)
-        data[i] = 0;
-
-    /* initialization before the loop */
-    j = 0;
-    buf_len = sizeof(unsigned char) * 8;
-
-    /* decompress */
-    for(i = 0; i < d_nelmts; i++)
-        H5Z_scaleoffset_decompress_one_atomic(data, i * p.size, buffer, &j, &buf_len, p);
-}
-
-static void
-H5Z_scaleoffset_compress_one_byte(unsigned char *data, size_t data_offset,
-    unsigned k, unsigned begin_i, unsigned char *buffer, size_t *j, unsigned *buf_len,
-    parms_atomic p, unsigned dtype_len)
+    unsigned char *buffer, size_t buffer_size, parms_atomic p)
 {
-   unsigned dat_len;    /* dat_len is the number of bits to be copied in each data byte */
-   unsigned char val;   /* value to be copied in each data byte */
+    HDassert(p.minbits > 0);
 
-   /* initialize value and bits of unsigned char to be copied */
-   val = data[data_offset + k];
-   if(k == begin_i)
-      dat_len = 8 - (dtype_len - p.minbits) % 8;
-   else
-      dat_len = 8;
-
-   if(*buf_len > dat_len) {
-      buffer[*j] |= (unsigned char)((val & ~(~0 << dat_len)) << (*buf_len - dat_len));
-      *buf_len -= dat_len;
-   } else {
-      buffer[*j] |= (unsigned char)((val >> (dat_len - *buf_len)) & ~(~0 << *buf_len));
-      dat_len -= *buf_len;
-      H5Z_scaleoffset_next_byte(j, buf_len);
-      if(dat_len == 0)
-          return;
-
-      buffer[*j] = (unsigned char)((val & ~(~0 << dat_len)) << (*buf_len - dat_len));
-      *buf_len -= dat_len;
-   } /* end else */
+    /* unpack the minbits low bits of each value, a word at a time */
+    H5Z_unpack_bits(data, (size_t)d_nelmts, p.size,
+                    (hbool_t)(p.mem_order == H5Z_SCALEOFFSET_ORDER_LE),
+                    (unsigned)p.minbits, 0, buffer, buffer_size);
 }
 
 static void
-H5Z_scaleoffset_compress_one_atomic(unsigned char *data, size_t data_offset,
-    unsigned char *buffer, size_t *j, unsigned *buf_len, parms_atomic p)
+H5Z_scaleoffset_compress(unsigned char *data, unsigned d_nelmts,
+    unsigned char *buffer, size_t buffer_size, parms_atomic p)
 {
-   /* begin_i: the index of byte having first significant bit */
-   unsigned begin_i;
-   unsigned dtype_len;
-   int k;
+   size_t packed_size = ((size_t)d_nelmts * p.minbits + 7) / 8;
 
    HDassert(p.minbits > 0);
+   HDassert(packed_size <= buffer_size);
 
-   dtype_len = p.size * 8;
-
-   if(p.mem_order == H5Z_SCALEOFFSET_ORDER_LE) { /* little endian */
-      begin_i = p.size - 1 - (dtype_len - p.minbits) / 8;
+   /* pack the minbits low bits of each value, a word at a time */
+   H5Z_pack_bits(data, (size_t)d_nelmts, p.size,
+                 (hbool_t)(p.mem_order == H5Z_SCALEOFFSET_ORDER_LE),
+                 (unsigned)p.minbits, 0, buffer);
 
-      for(k = (int)begin_i; k >= 0; k--)
-         H5Z_scaleoffset_compress_one_byte(data, data_offset, (unsigned)k, begin_i,
-                                           buffer, j, buf_len, p, dtype_len);
-   }
-   else { /* big endian */
-      HDassert(p.mem_order == H5Z_SCALEOFFSET_ORDER_BE);
-      begin_i = (dtype_len - p.minbits) / 8;
-
-      for(k = (int)begin_i; k <= (int)(p.size - 1); k++)
-         H5Z_scaleoffset_compress_one_byte(data, data_offset, (unsigned)k, begin_i,
-                                           buffer, j, buf_len, p, dtype_len);
-   }
-}
-
-static void
-H5Z_scaleoffset_compress(unsigned char *data, unsigned d_nelmts,
-    unsigned char *buffer, size_t buffer_size, parms_atomic p)
-{
-   /* i: index of data, j: index of buffer,
-      buf_len: number of bits to be filled in current byte */
-   size_t i, j;
-   unsigned buf_len;
-
-   /* must initialize buffer to be zeros */
-   for(j = 0; j < buffer_size; j++)
-      buffer[j] = 0;
-
-   /* initialization before the loop */
-   j = 0;
-   buf_len = sizeof(unsigned char) * 8;
-
-   /* compress */
-   for(i = 0; i < d_nelmts; i++)
-       H5Z_scaleoffset_compress_one_atomic(data, i * p.size, buffer, &j, &buf_len, p);
+   /* the rest of the buffer must be zeros */
+   HDmemset(buffer + packed_size, 0, buffer_size - packed_size);
 }
-
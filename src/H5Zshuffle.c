@@ -155,7 +155,7 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
         leftover = nbytes%bytesoftype;
 
         /* Allocate the destination buffer */
-        if (NULL==(dest = H5MM_malloc(nbytes)))
+        if (NULL==(dest = H5Z_buf_alloc(nbytes)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for shuffle buffer")
 
         if(flags & H5Z_FLAG_REVERSE) {
@@ -276,7 +276,7 @@ H5Z_filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
         } /* end else */
 
         /* Free the input buffer */
-        H5MM_xfree(*buf);
+        H5Z_buf_free(*buf, *buf_size);
 
         /* Set the buffer information to return */
         *buf = dest;
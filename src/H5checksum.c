@@ -34,6 +34,17 @@
 /***********/
 #include "H5private.h"		/* Generic Functions			*/
 
+/* Vectorized Fletcher32 kernels need x86 SIMD intrinsics and a compiler
+ * that can build code for a specific target (checked for at run time) */
+#if defined(__GNUC__) && defined(__SSE2__) && (defined(__x86_64__) || defined(__i386__))
+#define H5_CHECKSUM_SSE2
+#include <emmintrin.h>
+#if defined(__clang__) || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)
+#define H5_CHECKSUM_AVX2
+#include <immintrin.h>
+#endif
+#endif
+
 
 /****************/
 /* Local Macros */
@@ -43,11 +54,21 @@
 /* (same as the IEEE 802.3 (Ethernet) quotient) */
 #define H5_CRC_QUOTIENT 0x04C11DB7
 
+/* Buffers shorter than this are always checksummed with the scalar code */
+#define H5_FLETCHER32_VEC_MIN   64
+
+/* Number of vector blocks summed between reductions of the running sums
+ * (keeps the 32-bit lane sums from overflowing) */
+#define H5_FLETCHER32_VEC_NMAX  128
+
 
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Fletcher32 implementation */
+typedef uint32_t (*H5_checksum_fletcher32_func_t)(const uint8_t *data, size_t len);
+
 
 /********************/
 /* Package Typedefs */
@@ -57,6 +78,15 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static uint32_t H5_checksum_fletcher32_scalar(const uint8_t *data, size_t len);
+#ifdef H5_CHECKSUM_SSE2
+static uint32_t H5_checksum_fletcher32_finish(const uint8_t *data, size_t len,
+    uint64_t sum1, uint64_t sum2, const uint8_t *buf, size_t buf_len);
+static uint32_t H5_checksum_fletcher32_sse2(const uint8_t *data, size_t len);
+#endif /* H5_CHECKSUM_SSE2 */
+#ifdef H5_CHECKSUM_AVX2
+static uint32_t H5_checksum_fletcher32_avx2(const uint8_t *data, size_t len);
+#endif /* H5_CHECKSUM_AVX2 */
 
 
 /*********************/
@@ -79,27 +109,38 @@ static uint32_t H5_crc_table[256];
 /* Flag: has the table been computed? */
 static hbool_t H5_crc_table_computed = FALSE;
 
+/* Fletcher32 implementation for this CPU (chosen on first use) */
+static H5_checksum_fletcher32_func_t H5_checksum_fletcher32_func = NULL;
+
+#ifdef H5_CHECKSUM_SSE2
+/* Weights turning bytes into big-endian 16-bit words (for _mm_madd_epi16) */
+static const int16_t H5_fletcher32_word_w[16] = {
+    256, 1, 256, 1, 256, 1, 256, 1, 256, 1, 256, 1, 256, 1, 256, 1
+};
+
+/* Weights turning bytes into big-endian words scaled by their distance
+ * from the end of a 16-byte block */
+static const int16_t H5_fletcher32_sse2_pos_w[16] = {
+    2048, 8, 1792, 7, 1536, 6, 1280, 5, 1024, 4, 768, 3, 512, 2, 256, 1
+};
+#endif /* H5_CHECKSUM_SSE2 */
+
+#ifdef H5_CHECKSUM_AVX2
+/* Weights turning bytes into big-endian words scaled by their distance
+ * from the end of a 32-byte block */
+static const int16_t H5_fletcher32_avx2_pos_w[32] = {
+    4096, 16, 3840, 15, 3584, 14, 3328, 13, 3072, 12, 2816, 11, 2560, 10, 2304, 9,
+    2048, 8, 1792, 7, 1536, 6, 1280, 5, 1024, 4, 768, 3, 512, 2, 256, 1
+};
+#endif /* H5_CHECKSUM_AVX2 */
+
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5_checksum_fletcher32
- *
- * Purpose:	This routine provides a generic, fast checksum algorithm for
- *              use in the library.
- *
- * Note:        See the Wikipedia page for Fletcher's checksum:
- *                  http://en.wikipedia.org/wiki/Fletcher%27s_checksum
- *              for more details, etc.
- *
- * Note #2:     Per the information in RFC 3309:
- *                      (http://tools.ietf.org/html/rfc3309)
- *              Fletcher's checksum is not reliable for small buffers.
+ * Function:	H5_checksum_fletcher32_scalar
  *
- * Note #3:     The algorithm below differs from that given in the Wikipedia
- *              page by copying the data into 'sum1' in a more portable way
- *              and also by initializing 'sum1' and 'sum2' to 0 instead of
- *              0xffff (for backward compatibility reasons with earlier
- *              HDF5 fletcher32 I/O filter routine, mostly).
+ * Purpose:	Portable implementation of H5_checksum_fletcher32, which
+ *              sums the data as big-endian 16-bit words.
  *
  * Return:	32-bit fletcher checksum of input buffer (can't fail)
  *
@@ -108,19 +149,14 @@ static hbool_t H5_crc_table_computed = FALSE;
  *
  *-------------------------------------------------------------------------
  */
-uint32_t
-H5_checksum_fletcher32(const void *_data, size_t _len)
+static uint32_t
+H5_checksum_fletcher32_scalar(const uint8_t *data, size_t _len)
 {
-    const uint8_t *data = (const uint8_t *)_data;  /* Pointer to the data to be summed */
     size_t len = _len / 2;      /* Length in 16-bit words */
     uint32_t sum1 = 0, sum2 = 0;
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
-    /* Sanity check */
-    HDassert(_data);
-    HDassert(_len > 0);
-
     /* Compute checksum for pairs of bytes */
     /* (the magic "360" value is is the largest number of sums that can be
      *  performed without numeric overflow)
@@ -150,6 +186,266 @@ H5_checksum_fletcher32(const void *_data, size_t _len)
     sum2 = (sum2 & 0xffff) + (sum2 >> 16);
 
     FUNC_LEAVE_NOAPI((sum2 << 16) | sum1)
+} /* end H5_checksum_fletcher32_scalar() */
+
+#ifdef H5_CHECKSUM_SSE2
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_checksum_fletcher32_finish
+ *
+ * Purpose:	Fold the bytes left over by a vectorized Fletcher32 kernel
+ *              into its sums and produce the final checksum.  SUM1 and
+ *              SUM2 are the running sums modulo 65535 for all of BUF
+ *              before DATA.
+ *
+ *              The scalar code reduces with end-around carries, which
+ *              leaves a sum that is a multiple of 65535 as 0xffff unless
+ *              every word summed was zero.  The same representation is
+ *              chosen here, so both give identical checksums.
+ *
+ * Return:	32-bit fletcher checksum of BUF (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5_checksum_fletcher32_finish(const uint8_t *data, size_t len, uint64_t sum1,
+    uint64_t sum2, const uint8_t *buf, size_t buf_len)
+{
+    uint32_t ret_value;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sum the remaining whole words */
+    while(len >= 2) {
+        sum1 += (uint64_t)((((unsigned)data[0]) << 8) | (unsigned)data[1]);
+        sum2 += sum1;
+        data += 2;
+        len -= 2;
+    } /* end while */
+
+    /* Check for odd # of bytes */
+    if(len) {
+        sum1 += (uint64_t)(((unsigned)data[0]) << 8);
+        sum2 += sum1;
+    } /* end if */
+
+    sum1 %= 65535;
+    sum2 %= 65535;
+
+    /* Choose the scalar code's representation of zero sums */
+    if(0 == sum1 || 0 == sum2) {
+        size_t u;           /* Local index variable */
+
+        for(u = 0; u < buf_len; u++)
+            if(buf[u])
+                break;
+        if(u < buf_len) {
+            if(0 == sum1)
+                sum1 = 0xffff;
+            if(0 == sum2)
+                sum2 = 0xffff;
+        } /* end if */
+    } /* end if */
+
+    ret_value = (uint32_t)((sum2 << 16) | sum1);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5_checksum_fletcher32_finish() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_checksum_fletcher32_sse2
+ *
+ * Purpose:	SSE2 implementation of H5_checksum_fletcher32.  Each 16-byte
+ *              block of 8 words adds the sum of its words to sum1 and
+ *              8 * sum1 plus the words weighted by their distance from
+ *              the end of the block to sum2.  The per-block terms are
+ *              accumulated in 32-bit lanes and folded into the scalar
+ *              sums every H5_FLETCHER32_VEC_NMAX blocks.
+ *
+ * Return:	32-bit fletcher checksum of input buffer (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5_checksum_fletcher32_sse2(const uint8_t *data, size_t len)
+{
+    const uint8_t *buf = data;          /* Start of the buffer */
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i word_lo = _mm_loadu_si128((const __m128i *)H5_fletcher32_word_w);
+    const __m128i pos_lo = _mm_loadu_si128((const __m128i *)H5_fletcher32_sse2_pos_w);
+    const __m128i pos_hi = _mm_loadu_si128((const __m128i *)(H5_fletcher32_sse2_pos_w + 8));
+    size_t nblocks = len / 16;          /* Number of 16-byte blocks */
+    uint64_t sum1 = 0, sum2 = 0;        /* Running sums (modulo 65535) */
+    uint32_t ret_value;                 /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    while(nblocks) {
+        __m128i vs1 = zero;             /* Sums of words */
+        __m128i vps = zero;             /* Sums of VS1 before each block */
+        __m128i vs2 = zero;             /* Sums of position-weighted words */
+        uint32_t lanes[3][4];           /* Lanes of the vector sums */
+        size_t n = MIN(nblocks, H5_FLETCHER32_VEC_NMAX);
+        size_t u;                       /* Local index variable */
+
+        nblocks -= n;
+        sum2 += (uint64_t)n * 8 * sum1;
+        for(u = 0; u < n; u++, data += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *)data);
+            __m128i lo = _mm_unpacklo_epi8(v, zero);
+            __m128i hi = _mm_unpackhi_epi8(v, zero);
+
+            vps = _mm_add_epi32(vps, vs1);
+            vs1 = _mm_add_epi32(vs1, _mm_add_epi32(_mm_madd_epi16(lo, word_lo), _mm_madd_epi16(hi, word_lo)));
+            vs2 = _mm_add_epi32(vs2, _mm_add_epi32(_mm_madd_epi16(lo, pos_lo), _mm_madd_epi16(hi, pos_hi)));
+        } /* end for */
+
+        _mm_storeu_si128((__m128i *)lanes[0], vs1);
+        _mm_storeu_si128((__m128i *)lanes[1], vps);
+        _mm_storeu_si128((__m128i *)lanes[2], vs2);
+        for(u = 0; u < 4; u++) {
+            sum1 += lanes[0][u];
+            sum2 += (uint64_t)8 * lanes[1][u] + lanes[2][u];
+        } /* end for */
+        sum1 %= 65535;
+        sum2 %= 65535;
+    } /* end while */
+
+    ret_value = H5_checksum_fletcher32_finish(data, len % 16, sum1, sum2, buf, len);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5_checksum_fletcher32_sse2() */
+#endif /* H5_CHECKSUM_SSE2 */
+
+#ifdef H5_CHECKSUM_AVX2
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_checksum_fletcher32_avx2
+ *
+ * Purpose:	AVX2 implementation of H5_checksum_fletcher32, working on
+ *              32-byte blocks of 16 words the same way as the SSE2 one.
+ *              Only called when the CPU supports AVX2.
+ *
+ * Return:	32-bit fletcher checksum of input buffer (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+__attribute__((target("avx2"))) static uint32_t
+H5_checksum_fletcher32_avx2(const uint8_t *data, size_t len)
+{
+    const uint8_t *buf = data;          /* Start of the buffer */
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i word_w = _mm256_loadu_si256((const __m256i *)H5_fletcher32_word_w);
+    const __m256i pos_lo = _mm256_loadu_si256((const __m256i *)H5_fletcher32_avx2_pos_w);
+    const __m256i pos_hi = _mm256_loadu_si256((const __m256i *)(H5_fletcher32_avx2_pos_w + 16));
+    size_t nblocks = len / 32;          /* Number of 32-byte blocks */
+    uint64_t sum1 = 0, sum2 = 0;        /* Running sums (modulo 65535) */
+    uint32_t ret_value;                 /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    while(nblocks) {
+        __m256i vs1 = zero;             /* Sums of words */
+        __m256i vps = zero;             /* Sums of VS1 before each block */
+        __m256i vs2 = zero;             /* Sums of position-weighted words */
+        uint32_t lanes[3][8];           /* Lanes of the vector sums */
+        size_t n = MIN(nblocks, H5_FLETCHER32_VEC_NMAX);
+        size_t u;                       /* Local index variable */
+
+        nblocks -= n;
+        sum2 += (uint64_t)n * 16 * sum1;
+        for(u = 0; u < n; u++, data += 32) {
+            __m256i lo = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)data));
+            __m256i hi = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(data + 16)));
+
+            vps = _mm256_add_epi32(vps, vs1);
+            vs1 = _mm256_add_epi32(vs1, _mm256_add_epi32(_mm256_madd_epi16(lo, word_w), _mm256_madd_epi16(hi, word_w)));
+            vs2 = _mm256_add_epi32(vs2, _mm256_add_epi32(_mm256_madd_epi16(lo, pos_lo), _mm256_madd_epi16(hi, pos_hi)));
+        } /* end for */
+
+        _mm256_storeu_si256((__m256i *)lanes[0], vs1);
+        _mm256_storeu_si256((__m256i *)lanes[1], vps);
+        _mm256_storeu_si256((__m256i *)lanes[2], vs2);
+        for(u = 0; u < 8; u++) {
+            sum1 += lanes[0][u];
+            sum2 += (uint64_t)16 * lanes[1][u] + lanes[2][u];
+        } /* end for */
+        sum1 %= 65535;
+        sum2 %= 65535;
+    } /* end while */
+
+    ret_value = H5_checksum_fletcher32_finish(data, len % 32, sum1, sum2, buf, len);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5_checksum_fletcher32_avx2() */
+#endif /* H5_CHECKSUM_AVX2 */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_checksum_fletcher32
+ *
+ * Purpose:	This routine provides a generic, fast checksum algorithm for
+ *              use in the library.
+ *
+ * Note:        See the Wikipedia page for Fletcher's checksum:
+ *                  http://en.wikipedia.org/wiki/Fletcher%27s_checksum
+ *              for more details, etc.
+ *
+ * Note #2:     Per the information in RFC 3309:
+ *                      (http://tools.ietf.org/html/rfc3309)
+ *              Fletcher's checksum is not reliable for small buffers.
+ *
+ * Note #3:     The algorithm below differs from that given in the Wikipedia
+ *              page by copying the data into 'sum1' in a more portable way
+ *              and also by initializing 'sum1' and 'sum2' to 0 instead of
+ *              0xffff (for backward compatibility reasons with earlier
+ *              HDF5 fletcher32 I/O filter routine, mostly).
+ *
+ * Note #4:     On x86 CPUs with SSE2 or AVX2 a vectorized implementation
+ *              is chosen the first time this is called.  All of the
+ *              implementations return identical checksums.
+ *
+ * Return:	32-bit fletcher checksum of input buffer (can't fail)
+ *
+ * Programmer:	Quincey Koziol
+ *              Monday, August 21, 2006
+ *
+ *-------------------------------------------------------------------------
+ */
+uint32_t
+H5_checksum_fletcher32(const void *_data, size_t _len)
+{
+    const uint8_t *data = (const uint8_t *)_data;  /* Pointer to the data to be summed */
+    uint32_t ret_value;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(_data);
+    HDassert(_len > 0);
+
+    /* Pick the implementation for this CPU */
+    if(NULL == H5_checksum_fletcher32_func) {
+        H5_checksum_fletcher32_func_t func = H5_checksum_fletcher32_scalar;
+
+#ifdef H5_CHECKSUM_SSE2
+        func = H5_checksum_fletcher32_sse2;
+#endif /* H5_CHECKSUM_SSE2 */
+#ifdef H5_CHECKSUM_AVX2
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2"))
+            func = H5_checksum_fletcher32_avx2;
+#endif /* H5_CHECKSUM_AVX2 */
+        H5_checksum_fletcher32_func = func;
+    } /* end if */
+
+    if(_len < H5_FLETCHER32_VEC_MIN)
+        ret_value = H5_checksum_fletcher32_scalar(data, _len);
+    else
+        ret_value = (H5_checksum_fletcher32_func)(data, _len);
+
+    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5_checksum_fletcher32() */
 
 
@@ -386,6 +682,21 @@ H5_checksum_lookup3(const void *key, size_t length, uint32_t initval)
     a = b = c = 0xdeadbeef + ((uint32_t)length) + initval;
 
     /*--------------- all but the last block: affect some 32 bits of (a,b,c) */
+#ifndef H5_WORDS_BIGENDIAN
+    /* The key is read as little-endian 32-bit words, so load them whole */
+    while (length > 12)
+    {
+      uint32_t w[3];
+
+      HDmemcpy(w, k, sizeof(w));
+      a += w[0];
+      b += w[1];
+      c += w[2];
+      H5_lookup3_mix(a, b, c);
+      length -= 12;
+      k += 12;
+    }
+#else /* H5_WORDS_BIGENDIAN */
     while (length > 12)
     {
       a += k[0];
@@ -404,6 +715,7 @@ H5_checksum_lookup3(const void *key, size_t length, uint32_t initval)
       length -= 12;
       k += 12;
     }
+#endif /* H5_WORDS_BIGENDIAN */
 
     /*-------------------------------- last block: affect all 32 bits of (c) */
     switch(length)                   /* all the case statements fall through */
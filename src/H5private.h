@@ -268,6 +268,71 @@
 
 #endif /* H5_HAVE_MPE */
 
+/*------------------------------------------------------------------------
+ * Purpose:   Collect per-API routine call counts and elapsed time (see
+ *            H5get_api_stats).  Each API routine owns a static record
+ *            which is linked onto the global list the first time the
+ *            routine finishes while collection is enabled.  The record is
+ *            updated while the API lock is still held.
+ *
+ *            The start time is left at zero when collection is off on
+ *            entry, or when the routine fails before the timer starts, so
+ *            such calls are not counted.
+ *------------------------------------------------------------------------
+ */
+typedef struct H5_api_stat_rec_t {
+    H5_api_stats_t stats;                       /* Public statistics */
+    hbool_t registered;                         /* On the global list yet? */
+    struct H5_api_stat_rec_t *next;             /* Next record on the list */
+} H5_api_stat_rec_t;
+
+extern hbool_t H5_api_stats_g;  /* Is per-API collection enabled? */
+extern hbool_t H5_stats_env_g;  /* HDF5_STATS set in the environment? */
+
+H5_DLL void H5_api_stats_record(H5_api_stat_rec_t *rec, const char *name, double start);
+
+#define API_STATS_VARS                                                  \
+    static H5_api_stat_rec_t H5_api_stat_rec;                           \
+    double H5_api_stat_start = 0.0F;
+
+#define BEGIN_API_STATS                                                 \
+    if(H5_api_stats_g)                                                  \
+        H5_api_stat_start = H5_get_time();
+
+#define FINISH_API_STATS                                                \
+    if(H5_api_stats_g && H5_api_stat_start > 0.0F)                      \
+        H5_api_stats_record(&H5_api_stat_rec, FUNC, H5_api_stat_start);
+
+/*------------------------------------------------------------------------
+ * Purpose:   Record timestamped begin/end events for API routines and
+ *            selected internal routines (see H5set_trace_events).  The
+ *            events are kept in a per-thread ring buffer in H5CS.c.
+ *
+ *            A routine records its end event exactly when it recorded its
+ *            begin event, so that events stay paired when recording is
+ *            switched on or off in between.  Internal routines use these macros
+ *            the same way, declaring TRACE_EVENT_VARS with their locals.
+ *------------------------------------------------------------------------
+ */
+extern hbool_t H5CS_trace_g;    /* Is recording of trace events enabled? */
+
+H5_DLL herr_t H5CS_trace_event(const char *name, hbool_t begin);
+H5_DLL herr_t H5CS_trace_dump(const char *filename);
+H5_DLL herr_t H5CS_trace_term(void);
+
+#define TRACE_EVENT_VARS                                                \
+    hbool_t H5_trace_event_begun = FALSE;
+
+#define BEGIN_TRACE_EVENT                                               \
+    if(H5CS_trace_g) {                                                  \
+        H5CS_trace_event(FUNC, TRUE);                                   \
+        H5_trace_event_begun = TRUE;                                    \
+    }
+
+#define FINISH_TRACE_EVENT                                              \
+    if(H5_trace_event_begun)                                            \
+        H5CS_trace_event(FUNC, FALSE);
+
 /*
  * dmalloc (debugging malloc) support
  */
@@ -540,6 +605,7 @@ H5_DLL void H5_timer_end (H5_timer_t *sum/*in,out*/,
          H5_timer_t *timer/*in,out*/);
 H5_DLL void H5_bandwidth(char *buf/*out*/, double nbytes, double nseconds);
 H5_DLL time_t H5_now(void);
+H5_DLL double H5_get_time(void);
 
 /* Depth of object copy */
 typedef enum {
@@ -652,6 +718,9 @@ typedef struct {
 #ifndef HDclock
     #define HDclock()    clock()
 #endif /* HDclock */
+#ifndef HDclock_gettime
+    #define HDclock_gettime(C,T)  clock_gettime(C,T)
+#endif /* HDclock_gettime */
 #ifndef HDclose
     #define HDclose(F)    close(F)
 #endif /* HDclose */
@@ -1901,6 +1970,8 @@ static herr_t    H5_INTERFACE_INIT_FUNC(void);
 /* Local variables for API routines */
 #define FUNC_ENTER_API_VARS                                                   \
     MPE_LOG_VARS                                                  \
+    API_STATS_VARS                                                            \
+    TRACE_EVENT_VARS                                                          \
     H5TRACE_DECL
 
 #define FUNC_ENTER_API_COMMON                         \
@@ -1923,7 +1994,9 @@ static herr_t    H5_INTERFACE_INIT_FUNC(void);
    /* Push the name of this function on the function stack */                 \
    H5_PUSH_FUNC                                                               \
                                                                               \
-   BEGIN_MPE_LOG
+   BEGIN_MPE_LOG                                                              \
+   BEGIN_API_STATS                                                            \
+   BEGIN_TRACE_EVENT
 
 /* Use this macro for all "normal" API functions */
 #define FUNC_ENTER_API(err) {{                                      \
@@ -1952,6 +2025,8 @@ static herr_t    H5_INTERFACE_INIT_FUNC(void);
     FUNC_ENTER_API_COMMON                                                     \
     H5_PUSH_FUNC                                                              \
     BEGIN_MPE_LOG                                                             \
+    BEGIN_API_STATS                                                           \
+    BEGIN_TRACE_EVENT                                                         \
     {
 
 /*
@@ -1966,6 +2041,8 @@ static herr_t    H5_INTERFACE_INIT_FUNC(void);
     FUNC_ENTER_COMMON_NOERR(H5_IS_API(FUNC));                      \
     FUNC_ENTER_API_THREADSAFE;                  \
     BEGIN_MPE_LOG                                                             \
+    BEGIN_API_STATS                                                           \
+    BEGIN_TRACE_EVENT                                                         \
     {
 
 /* Note: this macro only works when there's _no_ interface initialization routine for the module */
@@ -2113,6 +2190,8 @@ static herr_t    H5_INTERFACE_INIT_FUNC(void);
 
 #define FUNC_LEAVE_API(ret_value)                                             \
         FINISH_MPE_LOG                                                       \
+        FINISH_API_STATS                                                      \
+        FINISH_TRACE_EVENT                                                    \
         H5TRACE_RETURN(ret_value);                \
         H5_POP_FUNC                                                           \
         if(err_occurred)                  \
@@ -2125,6 +2204,8 @@ static herr_t    H5_INTERFACE_INIT_FUNC(void);
 /* Use this macro to match the FUNC_ENTER_API_NOFS macro */
 #define FUNC_LEAVE_API_NOFS(ret_value)                                        \
         FINISH_MPE_LOG                                                       \
+        FINISH_API_STATS                                                      \
+        FINISH_TRACE_EVENT                                                    \
         H5TRACE_RETURN(ret_value);                \
         FUNC_LEAVE_API_THREADSAFE                                             \
         return(ret_value);                  \
@@ -2266,6 +2347,12 @@ extern hbool_t H5_api_entered_g;    /* Has library already been entered through
     /* Start logging MPI's MPE information */              \
     BEGIN_MPE_LOG                    \
                                                                               \
+    /* Start collecting per-API statistics */                                 \
+    BEGIN_API_STATS                                                           \
+                                                                              \
+    /* Record the trace event for entering this routine */                    \
+    BEGIN_TRACE_EVENT                                                         \
+                                                                              \
     /* Push the name of this function on the function stack */          \
     H5_PUSH_FUNC                          \
                                                                               \
@@ -2362,6 +2449,12 @@ func_init_failed:                    \
     /* Finish the MPE tracing info */                \
     FINISH_MPE_LOG                    \
                                                                               \
+    /* Finish the per-API statistics */                                       \
+    FINISH_API_STATS                                                          \
+                                                                              \
+    /* Record the trace event for leaving this routine */                     \
+    FINISH_TRACE_EVENT                                                        \
+                                                                              \
     /* Check for leaving API routine */                \
     HDassert(H5_api_entered_g);                  \
     H5_api_entered_g = FALSE;                  \
@@ -319,6 +319,16 @@ typedef struct H5_ih_info_t {
     hsize_t     heap_size;
 } H5_ih_info_t;
 
+/*
+ * Per-API routine statistics, collected when enabled with H5set_api_stats()
+ * or the HDF5_STATS environment variable.
+ */
+typedef struct H5_api_stats_t {
+    const char  *name;          /* Name of the API routine              */
+    hsize_t     ncalls;         /* Number of calls                      */
+    double      time;           /* Cumulative elapsed time, in seconds  */
+} H5_api_stats_t;
+
 /* Functions in H5.c */
 H5_DLL herr_t H5open(void);
 H5_DLL herr_t H5close(void);
@@ -334,6 +344,11 @@ H5_DLL herr_t H5check_version(unsigned majnum, unsigned minnum,
 H5_DLL herr_t H5free_memory(void *mem);
 H5_DLL void *H5allocate_memory(size_t size, hbool_t clear);
 H5_DLL void *H5resize_memory(void *mem, size_t size);
+H5_DLL herr_t H5set_api_stats(hbool_t enable);
+H5_DLL ssize_t H5get_api_stats(H5_api_stats_t stats[/*out*/], size_t nstats);
+H5_DLL herr_t H5reset_api_stats(void);
+H5_DLL herr_t H5set_trace_events(hbool_t enable);
+H5_DLL herr_t H5dump_trace_events(const char *filename);
 
 #ifdef __cplusplus
 }
@@ -271,3 +271,43 @@ H5_now(void)
     return(now);
 } /* end H5_now() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_get_time
+ *
+ * Purpose:	Retrieves the current time, in seconds with sub-second
+ *		resolution when available.  Used for timing regions of
+ *		library code, so a monotonic clock is used when the system
+ *		has one; the time is only meaningful relative to other
+ *		values from this routine.
+ *
+ * Return:	Current time in seconds (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+double
+H5_get_time(void)
+{
+    double	ret_value;              /* Current time */
+
+#if defined(H5_HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+    {
+        struct timespec now_ts;
+
+        HDclock_gettime(CLOCK_MONOTONIC, &now_ts);
+        ret_value = (double)now_ts.tv_sec + ((double)now_ts.tv_nsec / 1e9F);
+    }
+#elif defined(H5_HAVE_GETTIMEOFDAY)
+    {
+        struct timeval now_tv;
+
+        HDgettimeofday(&now_tv, NULL);
+        ret_value = (double)now_tv.tv_sec + ((double)now_tv.tv_usec / 1e6F);
+    }
+#else /* H5_HAVE_GETTIMEOFDAY */
+    ret_value = (double)HDtime(NULL);
+#endif /* H5_HAVE_GETTIMEOFDAY */
+
+    return(ret_value);
+} /* end H5_get_time() */
@@ -32,6 +32,10 @@
 #include "h5test.h"
 #include "H5srcdir.h"
 #include "H5Zpkg.h"
+
+#ifdef H5_HAVE_FILTER_THREADS
+#include <pthread.h>
+#endif /* H5_HAVE_FILTER_THREADS */
 #ifdef H5_HAVE_SZLIB_H
 #   include "szlib.h"
 #endif
@@ -116,6 +120,16 @@ const char *FILENAME[] = {
 #define DSET_DEPREC_NAME_CHUNKED	"deprecated_chunked"
 #define DSET_DEPREC_NAME_COMPACT	"deprecated_compact"
 #define DSET_DEPREC_NAME_FILTER         "deprecated_filter"
+#define DSET_SPLIT_NAME                 "split"
+#define DSET_SPLIT_MERGE_NAME           "split_merge"
+#define DSET_FILTER_STATS_NAME          "filter_stats"
+#define DSET_SIZE_HINT_NAME             "size_hint"
+#define DSET_FILTER_SKIP_NAME           "filter_skip"
+#define DSET_FILTER_NOSKIP_NAME         "filter_noskip"
+#define DSET_CHUNK_INFO_NAME            "chunk_info"
+#define DSET_CHUNK_INFO_CONTIG_NAME     "chunk_info_contig"
+#define DSET_CHUNK_ALLOC_EARLY_NAME     "chunk_alloc_early"
+#define CHUNK_ALLOC_ALIGN       512
 
 #define USER_BLOCK              1024
 #define SIXTY_FOUR_KB           65536
@@ -128,6 +142,11 @@ const char *FILENAME[] = {
 #define H5Z_FILTER_DEPREC       309
 #define H5Z_FILTER_EXPAND	310
 #define H5Z_FILTER_CAN_APPLY_TEST2	311
+#define H5Z_FILTER_SPLIT_TEST	312
+#define H5Z_FILTER_SPLIT_MERGE_TEST	313
+#define H5Z_FILTER_CLASS2_TEST	314
+#define H5Z_FILTER_SIZE_HINT_TEST	315
+#define H5Z_FILTER_UNUSED	316
 
 /* Flags for testing filters */
 #define DISABLE_FLETCHER32      0
@@ -4154,6 +4173,95 @@ error:
     return -1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_nbit_bit_layout
+ *
+ * Purpose:     Checks that the bit stream written by H5Z_pack_bits(),
+ *              which the n-bit and scale-offset filters store on disk,
+ *              is laid out as the original bytewise code laid it out:
+ *              the significant bits of each element, most significant
+ *              bit first, concatenated and zero-padded to a whole byte.
+ *              Also checks that H5Z_unpack_bits() reverses it.  Every
+ *              element size from 1 to 8 bytes is tried, in both byte
+ *              orders, with every precision and offset.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define NBIT_LAYOUT_NELMTS      7
+static herr_t
+test_nbit_bit_layout(void)
+{
+    unsigned char data[NBIT_LAYOUT_NELMTS * 8];         /* Elements to pack */
+    unsigned char unpacked[NBIT_LAYOUT_NELMTS * 8];     /* Elements unpacked */
+    unsigned char packed[NBIT_LAYOUT_NELMTS * 8];       /* Stream from H5Z_pack_bits() */
+    unsigned char expect[NBIT_LAYOUT_NELMTS * 8];       /* Stream built bit by bit */
+    size_t      size, u, i;
+    unsigned    precision, offset, b;
+    int         le;
+
+    TESTING("    n-bit stream layout");
+
+    for(u = 0; u < sizeof(data); u++)
+        data[u] = (unsigned char)HDrandom();
+
+    for(size = 1; size <= 8; size++)
+        for(le = 0; le < 2; le++)
+            for(precision = 1; precision <= size * 8; precision++)
+                for(offset = 0; offset + precision <= size * 8; offset++) {
+                    size_t nbytes = (NBIT_LAYOUT_NELMTS * precision + 7) / 8;
+                    size_t pos = 0;     /* Bit position in expected stream */
+
+                    /* Build the expected stream one bit at a time */
+                    HDmemset(expect, 0, sizeof(expect));
+                    for(i = 0; i < NBIT_LAYOUT_NELMTS; i++)
+                        for(b = offset + precision; b > offset; b--, pos++) {
+                            /* Byte of the element holding bit (b - 1) */
+                            size_t byte = le ? (b - 1) / 8 : size - 1 - (b - 1) / 8;
+
+                            if(data[i * size + byte] & (1 << ((b - 1) % 8)))
+                                expect[pos / 8] |= (unsigned char)(0x80 >> (pos % 8));
+                        } /* end for */
+
+                    HDmemset(packed, 0xff, sizeof(packed));
+                    H5Z_pack_bits(data, (size_t)NBIT_LAYOUT_NELMTS, size, (hbool_t)le, precision, offset, packed);
+                    if(HDmemcmp(packed, expect, nbytes)) {
+                        H5_FAILED();
+                        printf("    Different stream for size %u, %s, precision %u, offset %u\n",
+                            (unsigned)size, le ? "LE" : "BE", precision, offset);
+                        goto error;
+                    } /* end if */
+
+                    /* Unpacking gives back the significant bits, with the
+                     * others zero */
+                    H5Z_unpack_bits(unpacked, (size_t)NBIT_LAYOUT_NELMTS, size, (hbool_t)le, precision, offset, packed, nbytes);
+                    for(i = 0; i < NBIT_LAYOUT_NELMTS * size; i++) {
+                        unsigned bit0 = (unsigned)(le ? (i % size) : (size - 1 - i % size)) * 8;
+                        unsigned char mask = 0;
+
+                        for(b = 0; b < 8; b++)
+                            if(bit0 + b >= offset && bit0 + b < offset + precision)
+                                mask |= (unsigned char)(1 << b);
+                        if(unpacked[i] != (data[i] & mask)) {
+                            H5_FAILED();
+                            printf("    Different value unpacked for size %u, %s, precision %u, offset %u\n",
+                                (unsigned)size, le ? "LE" : "BE", precision, offset);
+                            goto error;
+                        } /* end if */
+                    } /* end for */
+                } /* end for */
+
+    PASSED();
+
+    return 0;
+
+error:
+    return -1;
+} /* end test_nbit_bit_layout() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_scaleoffset_int
  *
@@ -7802,194 +7910,1458 @@ error:
     return -1;
 } /* end test_chunk_expand() */
 
-
+
+/* Sub-block size used by the "split" test filters, in bytes */
+#define SPLIT_BLOCK_SIZE        1000
+
+/* Calls made to the "split" and "merge" callbacks of the test filters */
+static unsigned split_calls_g = 0;
+static unsigned merge_calls_g = 0;
+
+#ifdef H5_HAVE_FILTER_THREADS
+/* Whether filter_split() ran in a thread other than the test's own */
+static pthread_t split_main_thread_g;
+static pthread_mutex_t split_mutex_g = PTHREAD_MUTEX_INITIALIZER;
+static hbool_t split_other_thread_g = FALSE;
+#endif /* H5_HAVE_FILTER_THREADS */
+
+
 /*-------------------------------------------------------------------------
- * Function: test_large_chunk_shrink
+ * Function:    filter_split
  *
- * Purpose: Tests support for shrinking a chunk larger than 1 MB by a
- *              size greater than 1 MB.
+ * Purpose:     A size-preserving filter that flips every byte, for testing
+ *              filters that process a chunk as independent sub-blocks.
+ *              It is its own inverse, so it ignores FLAGS.
  *
- * Return:      Success: 0
- *              Failure: -1
+ * Return:      Success:        Data chunk size
+ *              Failure:        0
  *
- * Programmer:  Neil Fortner
- *              Monday, November 31, 2011
+ *-------------------------------------------------------------------------
+ */
+static size_t
+filter_split(unsigned int H5_ATTR_UNUSED flags, size_t H5_ATTR_UNUSED cd_nelmts,
+      const unsigned int H5_ATTR_UNUSED *cd_values, size_t nbytes,
+      size_t H5_ATTR_UNUSED *buf_size, void **buf)
+{
+    unsigned char *p = (unsigned char *)*buf;
+    size_t u;
+
+#ifdef H5_HAVE_FILTER_THREADS
+    if(!pthread_equal(pthread_self(), split_main_thread_g)) {
+        pthread_mutex_lock(&split_mutex_g);
+        split_other_thread_g = TRUE;
+        pthread_mutex_unlock(&split_mutex_g);
+    } /* end if */
+#endif /* H5_HAVE_FILTER_THREADS */
+
+    for(u = 0; u < nbytes; u++)
+        p[u] ^= 0xa5;
+
+    return nbytes;
+} /* end filter_split() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    split_fixed
+ *
+ * Purpose:     "split" callback that divides a buffer into sub-blocks of
+ *              SPLIT_BLOCK_SIZE bytes.  Since filter_split() doesn't change
+ *              sizes, the same division applies to the filtered data.
+ *
+ * Return:      Number of sub-blocks
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-test_large_chunk_shrink(hid_t fapl)
+static size_t
+split_fixed(unsigned int H5_ATTR_UNUSED flags, size_t H5_ATTR_UNUSED cd_nelmts,
+      const unsigned int H5_ATTR_UNUSED *cd_values, size_t nbytes,
+      const void H5_ATTR_UNUSED *buf, size_t max_blocks, size_t block_offset[],
+      size_t block_nbytes[])
 {
-    char        filename[FILENAME_BUF_SIZE];
-    hid_t       fid = -1;       /* File ID */
-    hid_t       dcpl = -1;      /* Dataset creation property list ID */
-    hid_t       sid = -1;       /* Dataspace ID */
-    hid_t       scalar_sid = -1;/* Scalar dataspace ID */
-    hid_t       dsid = -1;      /* Dataset ID */
-    hsize_t     dim, max_dim, chunk_dim; /* Dataset and chunk dimensions */
-    hsize_t     hs_offset;      /* Hyperslab offset */
-    hsize_t     hs_size;        /* Hyperslab size */
-    unsigned    write_elem, read_elem;  /* Element written/read */
+    size_t nblocks = 0;
+    size_t off;
 
-    TESTING("shrinking large chunk");
+    split_calls_g++;
+    for(off = 0; off < nbytes && nblocks < max_blocks; off += SPLIT_BLOCK_SIZE, nblocks++) {
+        block_offset[nblocks] = off;
+        block_nbytes[nblocks] = MIN(SPLIT_BLOCK_SIZE, nbytes - off);
+    } /* end for */
 
-    h5_fixname(FILENAME[10], fapl, filename, sizeof filename);
+    return (off < nbytes) ? 0 : nblocks;
+} /* end split_fixed() */
 
-    /* Create file */
-    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
 
-    /* Create dataset creation property list */
-    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+/*-------------------------------------------------------------------------
+ * Function:    split_framed
+ *
+ * Purpose:     "split" callback for the framed format written by
+ *              merge_framed(): a count of sub-blocks and their sizes,
+ *              each as an unsigned int, followed by the sub-blocks.
+ *              Unfiltered data is divided as by split_fixed().
+ *
+ * Return:      Number of sub-blocks, 0 if the frame is bad
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+split_framed(unsigned int flags, size_t cd_nelmts, const unsigned int *cd_values,
+      size_t nbytes, const void *buf, size_t max_blocks, size_t block_offset[],
+      size_t block_nbytes[])
+{
+    const unsigned *frame = (const unsigned *)buf;
+    size_t off;
+    size_t u;
 
-    /* Set 2 MB chunk size */
-    chunk_dim = 2 * 1024 * 1024 / sizeof(unsigned);
-    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+    if(!(flags & H5Z_FLAG_REVERSE))
+        return split_fixed(flags, cd_nelmts, cd_values, nbytes, buf, max_blocks,
+                block_offset, block_nbytes);
 
-    /* Create scalar dataspace */
-    if((scalar_sid = H5Screate(H5S_SCALAR)) < 0) FAIL_STACK_ERROR
+    split_calls_g++;
+    if(nbytes < sizeof(unsigned) || frame[0] > max_blocks)
+        return 0;
+    off = (frame[0] + 1) * sizeof(unsigned);
+    for(u = 0; u < frame[0]; u++) {
+        block_offset[u] = off;
+        block_nbytes[u] = frame[u + 1];
+        off += frame[u + 1];
+    } /* end for */
 
-    /* Create 1-D dataspace */
-    dim = 2 * 1024 * 1024 / sizeof(unsigned);
-    max_dim = H5S_UNLIMITED;
-    if((sid = H5Screate_simple(1, &dim, &max_dim)) < 0) FAIL_STACK_ERROR
+    return (off == nbytes) ? frame[0] : 0;
+} /* end split_framed() */
 
-    /* Create 2 MB chunked dataset */
-    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_UINT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
-        FAIL_STACK_ERROR
 
-    /* Select last element in the dataset */
-    hs_offset = dim - 1;
-    hs_size = 1;
-    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &hs_offset, NULL, &hs_size, NULL) < 0) FAIL_STACK_ERROR
+/*-------------------------------------------------------------------------
+ * Function:    merge_framed
+ *
+ * Purpose:     "merge" callback that frames the filtered sub-blocks for
+ *              split_framed(), or concatenates the unfiltered ones.
+ *
+ * Return:      Success:        Number of bytes in the merged buffer
+ *              Failure:        0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+merge_framed(unsigned int flags, size_t H5_ATTR_UNUSED cd_nelmts,
+      const unsigned int H5_ATTR_UNUSED *cd_values, size_t nblocks,
+      const size_t block_nbytes[], const void *const blocks[], size_t *buf_size,
+      void **buf)
+{
+    size_t hdr_size = (flags & H5Z_FLAG_REVERSE) ? 0 : (nblocks + 1) * sizeof(unsigned);
+    size_t total = hdr_size;
+    unsigned char *p;
+    size_t u;
+
+    merge_calls_g++;
+    for(u = 0; u < nblocks; u++)
+        total += block_nbytes[u];
+    if(total > *buf_size) {
+        void *new_buf;
+
+        if(NULL == (new_buf = HDmalloc(total)))
+            return 0;
+        HDfree(*buf);
+        *buf = new_buf;
+        *buf_size = total;
+    } /* end if */
 
-    /* Read (unwritten) element from dataset */
-    read_elem = 1;
-    if(H5Dread(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &read_elem) < 0) FAIL_STACK_ERROR
+    p = (unsigned char *)*buf;
+    if(hdr_size) {
+        unsigned *frame = (unsigned *)*buf;
 
-    /* Verify unwritten element is fill value (0) */
-    if(read_elem != 0) FAIL_PUTS_ERROR("invalid unwritten element read");
+        frame[0] = (unsigned)nblocks;
+        for(u = 0; u < nblocks; u++)
+            frame[u + 1] = (unsigned)block_nbytes[u];
+        p += hdr_size;
+    } /* end if */
+    for(u = 0; u < nblocks; u++) {
+        HDmemcpy(p, blocks[u], block_nbytes[u]);
+        p += block_nbytes[u];
+    } /* end for */
 
-    /* Write element to dataset */
-    write_elem = 2;
-    if(H5Dwrite(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &write_elem) < 0) FAIL_STACK_ERROR
+    return total;
+} /* end merge_framed() */
 
-    /* Read element from dataset */
-    read_elem = write_elem + 1;
-    if(H5Dread(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &read_elem) < 0) FAIL_STACK_ERROR
+/* Test filters that split chunks into sub-blocks */
+const H5Z_class3_t H5Z_SPLIT_TEST[1] = {{
+    H5Z_CLASS3_T_VERS,          /* H5Z_class3_t version */
+    H5Z_FILTER_SPLIT_TEST,	/* Filter id number		*/
+    1, 1,                       /* Encoding and decoding enabled */
+    "split",			/* Filter name for debugging	*/
+    NULL,                       /* The "can apply" callback     */
+    NULL,                       /* The "set local" callback     */
+    filter_split,		/* The actual filter function	*/
+    H5Z_CLASS_THREADSAFE,       /* Capability flags             */
+    split_fixed,                /* The "split" callback         */
+    NULL,                       /* The "merge" callback         */
+}};
 
-    /* Verify written element is read in */
-    if(read_elem != write_elem) FAIL_PUTS_ERROR("invalid written element read");
+const H5Z_class3_t H5Z_SPLIT_MERGE_TEST[1] = {{
+    H5Z_CLASS3_T_VERS,          /* H5Z_class3_t version */
+    H5Z_FILTER_SPLIT_MERGE_TEST,	/* Filter id number		*/
+    1, 1,                       /* Encoding and decoding enabled */
+    "split_merge",		/* Filter name for debugging	*/
+    NULL,                       /* The "can apply" callback     */
+    NULL,                       /* The "set local" callback     */
+    filter_split,		/* The actual filter function	*/
+    0,                          /* Capability flags             */
+    split_framed,               /* The "split" callback         */
+    merge_framed,               /* The "merge" callback         */
+}};
 
-    /* Shrink dataset to 512 KB */
-    dim = 512 * 1024 / sizeof(unsigned);
-    if(H5Dset_extent(dsid, &dim) < 0) FAIL_STACK_ERROR
+/* Filter registered without capabilities */
+const H5Z_class2_t H5Z_CLASS2_TEST[1] = {{
+    H5Z_CLASS_T_VERS,           /* H5Z_class_t version */
+    H5Z_FILTER_CLASS2_TEST,	/* Filter id number		*/
+    1, 1,                       /* Encoding and decoding enabled */
+    "class2",			/* Filter name for debugging	*/
+    NULL,                       /* The "can apply" callback     */
+    NULL,                       /* The "set local" callback     */
+    filter_split,		/* The actual filter function	*/
+}};
 
-    /* Expand dataset back to 2MB */
-    dim = 2 * 1024 * 1024 / sizeof(unsigned);
-    if(H5Dset_extent(dsid, &dim) < 0) FAIL_STACK_ERROR
 
-    /* Read element from dataset */
-    read_elem = 1;
-    if(H5Dread(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &read_elem) < 0) FAIL_STACK_ERROR
+/*-------------------------------------------------------------------------
+ * Function:    test_filter_split_dset
+ *
+ * Purpose:     Writes and reads back a dataset using the filter FILTER,
+ *              checking that its "split" and "merge" callbacks are used
+ *              as expected.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_filter_split_dset(hid_t file, const char *name, H5Z_filter_t filter,
+    hbool_t has_merge)
+{
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    const hsize_t dims[2] = {DSET_DIM1, DSET_DIM2};     /* Dataset dimensions */
+    const hsize_t chunk_dims[2] = {50, 100};            /* Chunk dimensions */
+    int         *wbuf = NULL;   /* Data written */
+    int         *rbuf = NULL;   /* Data read */
+    size_t      u;              /* Local index variable */
 
-    /* Verify element is now 0 */
-    if(read_elem != 0) FAIL_PUTS_ERROR("invalid element read");
+    if(NULL == (wbuf = (int *)HDmalloc(DSET_DIM1 * DSET_DIM2 * sizeof(int)))) TEST_ERROR
+    if(NULL == (rbuf = (int *)HDcalloc(DSET_DIM1 * DSET_DIM2, sizeof(int)))) TEST_ERROR
+    for(u = 0; u < DSET_DIM1 * DSET_DIM2; u++)
+        wbuf[u] = (int)(u * 7);
 
-    /* Close everything */
-    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
-    if(H5Sclose(scalar_sid) < 0) FAIL_STACK_ERROR
-    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
-    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
-    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) TEST_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) TEST_ERROR
+    if(H5Pset_filter(dcpl, filter, 0, (size_t)0, NULL) < 0) TEST_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) TEST_ERROR
+    if((dsid = H5Dcreate2(file, name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) TEST_ERROR
+
+    split_calls_g = merge_calls_g = 0;
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) TEST_ERROR
+    if(H5Dclose(dsid) < 0) TEST_ERROR
+    if(0 == split_calls_g) TEST_ERROR
+    if((0 == merge_calls_g) != !has_merge) TEST_ERROR
+
+    /* Read the data back, from the file rather than the chunk cache */
+    split_calls_g = merge_calls_g = 0;
+    if((dsid = H5Dopen2(file, name, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) TEST_ERROR
+    if(0 == split_calls_g) TEST_ERROR
+    if((0 == merge_calls_g) != !has_merge) TEST_ERROR
+    for(u = 0; u < DSET_DIM1 * DSET_DIM2; u++)
+        if(rbuf[u] != wbuf[u]) {
+            H5_FAILED();
+            printf("    Read different values than written.\n");
+            printf("    At index %lu\n", (unsigned long)u);
+            goto error;
+        } /* end if */
 
-    PASSED();
+    if(H5Dclose(dsid) < 0) TEST_ERROR
+    if(H5Sclose(sid) < 0) TEST_ERROR
+    if(H5Pclose(dcpl) < 0) TEST_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
 
     return 0;
 
 error:
     H5E_BEGIN_TRY {
-        H5Pclose(dcpl);
         H5Dclose(dsid);
         H5Sclose(sid);
-        H5Sclose(scalar_sid);
-        H5Fclose(fid);
+        H5Pclose(dcpl);
     } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
     return -1;
-} /* end test_large_chunk_shrink() */
+} /* end test_filter_split_dset() */
+
 
-
 /*-------------------------------------------------------------------------
- * Function: test_zero_dim_dset
- *
- * Purpose:     Tests support for reading a 1D chunled dataset with 
- *              dimension size = 0.
+ * Function:    test_filter_split
  *
- * Return:      Success: 0
- *              Failure: -1
+ * Purpose:     Tests filter classes with capability flags and "split" and
+ *              "merge" callbacks, and that filters registered with an
+ *              H5Z_class2_t have no capabilities.
  *
- * Programmer:  Mohamad Chaarawi
- *              Wednesdat, July 9, 2014
+ * Return:      Success:        0
+ *              Failure:        -1
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-test_zero_dim_dset(hid_t fapl)
+test_filter_split(hid_t file)
 {
-    char        filename[FILENAME_BUF_SIZE];
-    hid_t       fid = -1;       /* File ID */
-    hid_t       dcpl = -1;      /* Dataset creation property list ID */
-    hid_t       sid = -1;       /* Dataspace ID */
-    hid_t       dsid = -1;      /* Dataset ID */
-    hsize_t     dim, chunk_dim; /* Dataset and chunk dimensions */
-    int         data[1];
-
-    TESTING("shrinking large chunk");
-
-    h5_fixname(FILENAME[13], fapl, filename, sizeof filename);
-
-    /* Create file */
-    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
-
-    /* Create dataset creation property list */
-    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
-
-    /* Set 1 chunk size */
-    chunk_dim = 1;
-    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
-
-    /* Create 1D dataspace with 0 dim size */
-    dim = 0;
-    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+    H5Z_class3_t bad_class;     /* Invalid filter class */
+    unsigned    flags;          /* Filter configuration flags */
+    herr_t      status;         /* Generic return value */
 
-    /* Create chunked dataset */
-    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
-        FAIL_STACK_ERROR
+    TESTING("filters that split chunks into sub-blocks");
 
-    /* write 0 elements from dataset */
-    if(H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, data) < 0) FAIL_STACK_ERROR
+    if(H5Zregister(H5Z_SPLIT_TEST) < 0) TEST_ERROR
+    if(H5Zregister(H5Z_SPLIT_MERGE_TEST) < 0) TEST_ERROR
 
-    /* Read 0 elements from dataset */
-    if(H5Dread(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, data) < 0) FAIL_STACK_ERROR
+    /* Check the capabilities reported */
+    if(H5Zget_filter_info(H5Z_FILTER_SPLIT_TEST, &flags) < 0) TEST_ERROR
+    if(!(flags & H5Z_FILTER_CONFIG_THREADSAFE) || !(flags & H5Z_FILTER_CONFIG_SPLIT)) TEST_ERROR
+    if(H5Zget_filter_info(H5Z_FILTER_SPLIT_MERGE_TEST, &flags) < 0) TEST_ERROR
+    if((flags & H5Z_FILTER_CONFIG_THREADSAFE) || !(flags & H5Z_FILTER_CONFIG_SPLIT)) TEST_ERROR
+    if(H5Zget_filter_info(H5Z_FILTER_FLETCHER32, &flags) < 0) TEST_ERROR
+    if(flags & (H5Z_FILTER_CONFIG_THREADSAFE | H5Z_FILTER_CONFIG_SPLIT)) TEST_ERROR
 
-    /* Close everything */
-    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
-    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
-    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
-    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    /* Filter data through both.  Only the thread-safe filter may be run
+     * in other threads.
+     */
+#ifdef H5_HAVE_FILTER_THREADS
+    split_main_thread_g = pthread_self();
+    split_other_thread_g = FALSE;
+#endif /* H5_HAVE_FILTER_THREADS */
+    if(test_filter_split_dset(file, DSET_SPLIT_NAME, H5Z_FILTER_SPLIT_TEST, FALSE) < 0) goto error;
+#ifdef H5_HAVE_FILTER_THREADS
+    if(!split_other_thread_g) TEST_ERROR
+    split_other_thread_g = FALSE;
+#endif /* H5_HAVE_FILTER_THREADS */
+    if(test_filter_split_dset(file, DSET_SPLIT_MERGE_NAME, H5Z_FILTER_SPLIT_MERGE_TEST, TRUE) < 0) goto error;
+#ifdef H5_HAVE_FILTER_THREADS
+    if(split_other_thread_g) TEST_ERROR
+#endif /* H5_HAVE_FILTER_THREADS */
+
+    if(H5Zunregister(H5Z_FILTER_SPLIT_TEST) < 0) TEST_ERROR
+    if(H5Zunregister(H5Z_FILTER_SPLIT_MERGE_TEST) < 0) TEST_ERROR
+
+    /* A filter registered with an H5Z_class2_t has no capabilities */
+    if(H5Zregister(H5Z_CLASS2_TEST) < 0) TEST_ERROR
+    if(H5Zget_filter_info(H5Z_FILTER_CLASS2_TEST, &flags) < 0) TEST_ERROR
+    if(!(flags & H5Z_FILTER_CONFIG_ENCODE_ENABLED) || !(flags & H5Z_FILTER_CONFIG_DECODE_ENABLED)) TEST_ERROR
+    if(flags & (H5Z_FILTER_CONFIG_THREADSAFE | H5Z_FILTER_CONFIG_SPLIT)) TEST_ERROR
+    if(H5Zunregister(H5Z_FILTER_CLASS2_TEST) < 0) TEST_ERROR
+
+    /* Unknown capability flags and a "merge" callback without a "split"
+     * callback are rejected.
+     */
+    HDmemcpy(&bad_class, H5Z_SPLIT_TEST, sizeof(H5Z_class3_t));
+    bad_class.flags = 0x8000;
+    H5E_BEGIN_TRY {
+        status = H5Zregister(&bad_class);
+    } H5E_END_TRY;
+    if(status >= 0) TEST_ERROR
+    HDmemcpy(&bad_class, H5Z_SPLIT_MERGE_TEST, sizeof(H5Z_class3_t));
+    bad_class.split = NULL;
+    H5E_BEGIN_TRY {
+        status = H5Zregister(&bad_class);
+    } H5E_END_TRY;
+    if(status >= 0) TEST_ERROR
 
     PASSED();
-
     return 0;
 
 error:
     H5E_BEGIN_TRY {
-        H5Pclose(dcpl);
-        H5Dclose(dsid);
-        H5Sclose(sid);
-        H5Fclose(fid);
+        H5Zunregister(H5Z_FILTER_SPLIT_TEST);
+        H5Zunregister(H5Z_FILTER_SPLIT_MERGE_TEST);
+        H5Zunregister(H5Z_FILTER_CLASS2_TEST);
     } H5E_END_TRY;
     return -1;
-} /* end test_zero_dim_dset() */
+} /* end test_filter_split() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_filter_stats
+ *
+ * Purpose:     Tests the per-filter statistics retrieved with
+ *              H5Zget_filter_stats and cleared with H5Zreset_filter_stats.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_filter_stats(hid_t file)
+{
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    const hsize_t dims[2] = {DSET_DIM1, DSET_DIM2};     /* Dataset dimensions */
+    const hsize_t chunk_dims[2] = {50, 100};            /* Chunk dimensions */
+    const hsize_t nchunks = (DSET_DIM1 / 50) * (DSET_DIM2 / 100);  /* Number of chunks */
+    const hsize_t chunk_nbytes = 50 * 100 * sizeof(int);            /* Bytes in a chunk */
+    H5Z_filter_stats_t stats;   /* Filter statistics */
+    int         *buf = NULL;    /* Data buffer */
+    size_t      u;              /* Local index variable */
+    herr_t      status;         /* Generic return value */
+
+    TESTING("filter statistics");
+
+    if(NULL == (buf = (int *)HDmalloc(DSET_DIM1 * DSET_DIM2 * sizeof(int)))) TEST_ERROR
+    for(u = 0; u < DSET_DIM1 * DSET_DIM2; u++)
+        buf[u] = (int)u;
+
+    if(H5Zreset_filter_stats(H5Z_FILTER_ALL) < 0) TEST_ERROR
+    if(H5Zget_filter_stats(H5Z_FILTER_FLETCHER32, &stats) < 0) TEST_ERROR
+    if(stats.encode.calls != 0 || stats.decode.calls != 0) TEST_ERROR
+
+    /* Write through the Fletcher32 filter, which adds 4 bytes to a chunk */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) TEST_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) TEST_ERROR
+    if(H5Pset_fletcher32(dcpl) < 0) TEST_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) TEST_ERROR
+    if((dsid = H5Dcreate2(file, DSET_FILTER_STATS_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) TEST_ERROR
+    if(H5Dclose(dsid) < 0) TEST_ERROR
+
+    if(H5Zget_filter_stats(H5Z_FILTER_FLETCHER32, &stats) < 0) TEST_ERROR
+    if(stats.encode.calls != nchunks || stats.encode.failed != 0) TEST_ERROR
+    if(stats.encode.bytes_in != nchunks * chunk_nbytes) TEST_ERROR
+    if(stats.encode.bytes_out != nchunks * (chunk_nbytes + 4)) TEST_ERROR
+    if(stats.encode.time < 0.0F) TEST_ERROR
+    if(stats.decode.calls != 0) TEST_ERROR
+
+    /* Read the data back, from the file rather than the chunk cache */
+    if((dsid = H5Dopen2(file, DSET_FILTER_STATS_NAME, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) TEST_ERROR
+    if(H5Dclose(dsid) < 0) TEST_ERROR
+
+    if(H5Zget_filter_stats(H5Z_FILTER_FLETCHER32, &stats) < 0) TEST_ERROR
+    if(stats.encode.calls != nchunks) TEST_ERROR
+    if(stats.decode.calls != nchunks || stats.decode.failed != 0) TEST_ERROR
+    if(stats.decode.bytes_in != nchunks * (chunk_nbytes + 4)) TEST_ERROR
+    if(stats.decode.bytes_out != nchunks * chunk_nbytes) TEST_ERROR
+
+    /* Resetting one filter leaves the others alone */
+    if(H5Zreset_filter_stats(H5Z_FILTER_SHUFFLE) < 0) TEST_ERROR
+    if(H5Zget_filter_stats(H5Z_FILTER_FLETCHER32, &stats) < 0) TEST_ERROR
+    if(stats.decode.calls != nchunks) TEST_ERROR
+    if(H5Zreset_filter_stats(H5Z_FILTER_FLETCHER32) < 0) TEST_ERROR
+    if(H5Zget_filter_stats(H5Z_FILTER_FLETCHER32, &stats) < 0) TEST_ERROR
+    if(stats.encode.calls != 0 || stats.encode.bytes_in != 0 || stats.decode.calls != 0) TEST_ERROR
+
+    /* Filters that aren't registered have no statistics */
+    H5E_BEGIN_TRY {
+        status = H5Zget_filter_stats(H5Z_FILTER_UNUSED, &stats);
+    } H5E_END_TRY;
+    if(status >= 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        status = H5Zreset_filter_stats(H5Z_FILTER_UNUSED);
+    } H5E_END_TRY;
+    if(status >= 0) TEST_ERROR
+
+    if(H5Sclose(sid) < 0) TEST_ERROR
+    if(H5Pclose(dcpl) < 0) TEST_ERROR
+    HDfree(buf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+    return -1;
+} /* end test_filter_stats() */
+
+
+/* Size hint seen by the last call of filter_size_hint() on the read path */
+static size_t size_hint_seen_g = 0;
+
+
+/*-------------------------------------------------------------------------
+ * Function:	filter_size_hint
+ *
+ * Purpose:	A filter that doesn't change the data, but records the size
+ *              hint the pipeline gives it when reading.
+ *
+ * Return:	Success:	Data chunk size
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+filter_size_hint(unsigned int flags, size_t H5_ATTR_UNUSED cd_nelmts,
+      const unsigned int H5_ATTR_UNUSED *cd_values, size_t nbytes,
+      size_t H5_ATTR_UNUSED *buf_size, void H5_ATTR_UNUSED **buf)
+{
+    if(flags & H5Z_FLAG_REVERSE)
+        size_hint_seen_g = H5Z_size_hint_g;
+
+    return nbytes;
+} /* end filter_size_hint() */
+
+const H5Z_class2_t H5Z_SIZE_HINT_TEST[1] = {{
+    H5Z_CLASS_T_VERS,           /* H5Z_class_t version */
+    H5Z_FILTER_SIZE_HINT_TEST,	/* Filter id number		*/
+    1, 1,                       /* Encoding and decoding enabled */
+    "size_hint",		/* Filter name for debugging	*/
+    NULL,                       /* The "can apply" callback     */
+    NULL,                       /* The "set local" callback     */
+    filter_size_hint,		/* The actual filter function	*/
+}};
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_filter_buf_pool
+ *
+ * Purpose:     Tests the filter buffer pool: that a freed buffer is
+ *              reused for a request of about its size, that the pool
+ *              is emptied by H5garbage_collect, and that filters are
+ *              given the size of the chunk as a hint when reading.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_filter_buf_pool(hid_t file)
+{
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    const hsize_t dims[2] = {DSET_DIM1, DSET_DIM2};     /* Dataset dimensions */
+    const hsize_t chunk_dims[2] = {50, 100};            /* Chunk dimensions */
+    const size_t chunk_nbytes = 50 * 100 * sizeof(int); /* Bytes in a chunk */
+    void        *pool_buf, *buf2, *buf3;                /* Filter buffers */
+    int         *buf = NULL;    /* Data buffer */
+    size_t      u;              /* Local index variable */
+
+    TESTING("filter buffer pool");
+
+    /* Start with an empty pool */
+    if(H5garbage_collect() < 0) TEST_ERROR
+    if(H5Z_buf_pool_nbytes_g != 0) TEST_ERROR
+
+    /* A freed buffer is kept, and handed out again for a smaller request */
+    if(NULL == (pool_buf = H5Z_buf_alloc((size_t)8192))) TEST_ERROR
+    H5Z_buf_free(pool_buf, (size_t)8192);
+    if(H5Z_buf_pool_nbytes_g != 8192) TEST_ERROR
+    if(NULL == (buf2 = H5Z_buf_alloc((size_t)6000))) TEST_ERROR
+    if(buf2 != pool_buf) TEST_ERROR
+    if(H5Z_buf_pool_nbytes_g != 0) TEST_ERROR
+
+    /* ...but not for one less than half its size, while it's in use */
+    H5Z_buf_free(buf2, (size_t)8192);
+    if(NULL == (buf3 = H5Z_buf_alloc((size_t)1000))) TEST_ERROR
+    if(H5Z_buf_pool_nbytes_g != 8192) TEST_ERROR
+
+    /* Small buffers aren't kept */
+    H5Z_buf_free(buf3, (size_t)1000);
+    if(H5Z_buf_pool_nbytes_g != 8192) TEST_ERROR
+
+    /* H5garbage_collect empties the pool */
+    if(H5garbage_collect() < 0) TEST_ERROR
+    if(H5Z_buf_pool_nbytes_g != 0) TEST_ERROR
+
+    /* Read a chunked dataset through a filter that records its size hint */
+    if(H5Zregister(H5Z_SIZE_HINT_TEST) < 0) TEST_ERROR
+    if(NULL == (buf = (int *)HDmalloc(DSET_DIM1 * DSET_DIM2 * sizeof(int)))) TEST_ERROR
+    for(u = 0; u < DSET_DIM1 * DSET_DIM2; u++)
+        buf[u] = (int)u;
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) TEST_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) TEST_ERROR
+    if(H5Pset_filter(dcpl, H5Z_FILTER_SIZE_HINT_TEST, 0, (size_t)0, NULL) < 0) TEST_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) TEST_ERROR
+    if((dsid = H5Dcreate2(file, DSET_SIZE_HINT_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) TEST_ERROR
+    if(H5Dclose(dsid) < 0) TEST_ERROR
+
+    size_hint_seen_g = 0;
+    if((dsid = H5Dopen2(file, DSET_SIZE_HINT_NAME, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) TEST_ERROR
+    if(H5Dclose(dsid) < 0) TEST_ERROR
+    if(size_hint_seen_g != chunk_nbytes) TEST_ERROR
+
+    /* The hint is only in effect while the pipeline runs */
+    if(H5Z_size_hint_g != 0) TEST_ERROR
+
+    if(H5Zunregister(H5Z_FILTER_SIZE_HINT_TEST) < 0) TEST_ERROR
+    if(H5Sclose(sid) < 0) TEST_ERROR
+    if(H5Pclose(dcpl) < 0) TEST_ERROR
+    HDfree(buf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Zunregister(H5Z_FILTER_SIZE_HINT_TEST);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+    return -1;
+} /* end test_filter_buf_pool() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_filter_skip
+ *
+ * Purpose:     Tests that optional filters are skipped on the chunks
+ *              following an incompressible one, when set up with
+ *              H5Pset_filter_skip.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_filter_skip(hid_t file)
+{
+#ifdef H5_HAVE_FILTER_DEFLATE
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       dapl2 = -1;     /* Dataset's dataset access property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    const hsize_t dims[2] = {DSET_DIM1, DSET_DIM2};     /* Dataset dimensions */
+    const hsize_t chunk_dims[2] = {50, 100};            /* Chunk dimensions */
+    const hsize_t nchunks = (DSET_DIM1 / 50) * (DSET_DIM2 / 100);  /* Number of chunks */
+    H5Z_filter_stats_t stats;   /* Filter statistics */
+    int         *buf = NULL;    /* Data buffer */
+    int         *rbuf = NULL;   /* Data buffer read back */
+    double      max_ratio;      /* Filter skip ratio */
+    unsigned    skip_nchunks;   /* Chunks to skip the optional filters on */
+    size_t      u;              /* Local index variable */
+    herr_t      status;         /* Generic return value */
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
+    TESTING("skipping optional filters on incompressible data");
+
+#ifdef H5_HAVE_FILTER_DEFLATE
+    if(NULL == (buf = (int *)HDmalloc(DSET_DIM1 * DSET_DIM2 * sizeof(int)))) TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(DSET_DIM1 * DSET_DIM2 * sizeof(int)))) TEST_ERROR
+    for(u = 0; u < DSET_DIM1 * DSET_DIM2; u++)
+        buf[u] = (int)HDrandom();
+
+    /* Check the default settings and the argument checks */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) TEST_ERROR
+    if(H5Pget_filter_skip(dapl, &max_ratio, &skip_nchunks) < 0) TEST_ERROR
+    if(!H5_DBL_ABS_EQUAL(max_ratio, 1.0F) || skip_nchunks != 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        status = H5Pset_filter_skip(dapl, 0.0F, 2);
+    } H5E_END_TRY;
+    if(status >= 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        status = H5Pset_filter_skip(dapl, 1.5F, 2);
+    } H5E_END_TRY;
+    if(status >= 0) TEST_ERROR
+    if(H5Pset_filter_skip(dapl, 0.9F, 2) < 0) TEST_ERROR
+    if(H5Pget_filter_skip(dapl, &max_ratio, &skip_nchunks) < 0) TEST_ERROR
+    if(!H5_DBL_ABS_EQUAL(max_ratio, 0.9F) || skip_nchunks != 2) TEST_ERROR
+
+    /* Random data doesn't compress, so each chunk put through the (optional)
+     * deflate filter is followed by two that aren't.
+     */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) TEST_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) TEST_ERROR
+    if(H5Pset_deflate(dcpl, 6) < 0) TEST_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) TEST_ERROR
+
+    if(H5Zreset_filter_stats(H5Z_FILTER_DEFLATE) < 0) TEST_ERROR
+    if((dsid = H5Dcreate2(file, DSET_FILTER_SKIP_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0) TEST_ERROR
+    if((dapl2 = H5Dget_access_plist(dsid)) < 0) TEST_ERROR
+    if(H5Pget_filter_skip(dapl2, &max_ratio, &skip_nchunks) < 0) TEST_ERROR
+    if(!H5_DBL_ABS_EQUAL(max_ratio, 0.9F) || skip_nchunks != 2) TEST_ERROR
+    if(H5Pclose(dapl2) < 0) TEST_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) TEST_ERROR
+    if(H5Dclose(dsid) < 0) TEST_ERROR
+    if(H5Zget_filter_stats(H5Z_FILTER_DEFLATE, &stats) < 0) TEST_ERROR
+    if(stats.encode.calls != (nchunks + 2) / 3) TEST_ERROR
+
+    /* Without the setting, every chunk is deflated */
+    if(H5Zreset_filter_stats(H5Z_FILTER_DEFLATE) < 0) TEST_ERROR
+    if((dsid = H5Dcreate2(file, DSET_FILTER_NOSKIP_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) TEST_ERROR
+    if(H5Dclose(dsid) < 0) TEST_ERROR
+    if(H5Zget_filter_stats(H5Z_FILTER_DEFLATE, &stats) < 0) TEST_ERROR
+    if(stats.encode.calls != nchunks) TEST_ERROR
+
+    /* The chunks written unfiltered are inflated only where deflated */
+    if(H5Zreset_filter_stats(H5Z_FILTER_DEFLATE) < 0) TEST_ERROR
+    if((dsid = H5Dopen2(file, DSET_FILTER_SKIP_NAME, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) TEST_ERROR
+    if(H5Dclose(dsid) < 0) TEST_ERROR
+    if(HDmemcmp(buf, rbuf, DSET_DIM1 * DSET_DIM2 * sizeof(int))) TEST_ERROR
+    if(H5Zget_filter_stats(H5Z_FILTER_DEFLATE, &stats) < 0) TEST_ERROR
+    if(stats.decode.calls != (nchunks + 2) / 3) TEST_ERROR
+
+    if(H5Sclose(sid) < 0) TEST_ERROR
+    if(H5Pclose(dcpl) < 0) TEST_ERROR
+    if(H5Pclose(dapl) < 0) TEST_ERROR
+    HDfree(buf);
+    HDfree(rbuf);
+
+    PASSED();
+#else /* H5_HAVE_FILTER_DEFLATE */
+    SKIPPED();
+    puts("    Deflate filter not enabled");
+#endif /* H5_HAVE_FILTER_DEFLATE */
+    return 0;
+
+#ifdef H5_HAVE_FILTER_DEFLATE
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Pclose(dapl2);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+    if(rbuf)
+        HDfree(rbuf);
+    return -1;
+#endif /* H5_HAVE_FILTER_DEFLATE */
+} /* end test_filter_skip() */
+
+
+/* Chunks recorded by chunk_info_iter_cb() */
+typedef struct chunk_info_ud_t {
+    size_t      nchunks;        /* Number of chunks seen */
+    size_t      stop_after;     /* Stop after this many chunks (0 for never) */
+    int         stop_value;     /* Value to stop with */
+    hsize_t     offset[2][2];   /* Chunk offsets */
+    unsigned    filter_mask[2]; /* Chunk filter masks */
+    haddr_t     addr[2];        /* Chunk addresses */
+    hsize_t     size[2];        /* Chunk sizes */
+} chunk_info_ud_t;
+
+
+/*-------------------------------------------------------------------------
+ * Function:    chunk_info_iter_cb
+ *
+ * Purpose:     H5Dchunk_iter() callback for test_chunk_info().
+ *
+ * Return:      Zero to continue, otherwise the value to stop with
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+chunk_info_iter_cb(const hsize_t *offset, unsigned filter_mask, haddr_t addr,
+    hsize_t size, void *op_data)
+{
+    chunk_info_ud_t *udata = (chunk_info_ud_t *)op_data;
+
+    if(udata->nchunks < 2) {
+        udata->offset[udata->nchunks][0] = offset[0];
+        udata->offset[udata->nchunks][1] = offset[1];
+        udata->filter_mask[udata->nchunks] = filter_mask;
+        udata->addr[udata->nchunks] = addr;
+        udata->size[udata->nchunks] = size;
+    } /* end if */
+    udata->nchunks++;
+
+    if(udata->stop_after && udata->nchunks == udata->stop_after)
+        return udata->stop_value;
+    return 0;
+} /* end chunk_info_iter_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_info
+ *
+ * Purpose:     Tests querying the allocated chunks of a dataset with
+ *              H5Dget_num_chunks, H5Dget_chunk_info and H5Dchunk_iter.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_info(hid_t file)
+{
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    const hsize_t dims[2] = {20, 20};           /* Dataset dimensions */
+    const hsize_t chunk_dims[2] = {5, 5};       /* Chunk dimensions */
+    const hsize_t chunk_offset[2][2] = {{0, 0}, {10, 5}};   /* Chunks written */
+    const hsize_t count[2] = {5, 5};            /* Hyperslab size */
+    int         buf[5][5];      /* Data for one chunk */
+    chunk_info_ud_t udata;      /* Iteration user data */
+    hsize_t     nchunks;        /* Number of chunks */
+    hsize_t     offset[2];      /* Chunk offset */
+    unsigned    filter_mask;    /* Chunk filter mask */
+    haddr_t     addr;           /* Chunk address */
+    hsize_t     size;           /* Chunk size */
+    size_t      u, v;           /* Local index variables */
+    herr_t      status;         /* Generic return value */
+
+    TESTING("chunk index queries");
+
+    for(u = 0; u < 5; u++)
+        for(v = 0; v < 5; v++)
+            buf[u][v] = (int)(u * 5 + v);
+
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) TEST_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) TEST_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) TEST_ERROR
+    if((dsid = H5Dcreate2(file, DSET_CHUNK_INFO_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) TEST_ERROR
+
+    /* No chunks are allocated yet */
+    if(H5Dget_num_chunks(dsid, &nchunks) < 0) TEST_ERROR
+    if(nchunks != 0) TEST_ERROR
+    HDmemset(&udata, 0, sizeof(udata));
+    if(H5Dchunk_iter(dsid, chunk_info_iter_cb, &udata) != 0) TEST_ERROR
+    if(udata.nchunks != 0) TEST_ERROR
+
+    /* Write two of the sixteen chunks, which stay in the chunk cache */
+    for(u = 0; u < 2; u++) {
+        hid_t mspace_id;        /* Memory dataspace ID */
+
+        if((mspace_id = H5Screate_simple(2, count, NULL)) < 0) TEST_ERROR
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, chunk_offset[u], NULL, count, NULL) < 0) TEST_ERROR
+        if(H5Dwrite(dsid, H5T_NATIVE_INT, mspace_id, sid, H5P_DEFAULT, buf) < 0) TEST_ERROR
+        if(H5Sclose(mspace_id) < 0) TEST_ERROR
+    } /* end for */
+
+    if(H5Dget_num_chunks(dsid, &nchunks) < 0) TEST_ERROR
+    if(nchunks != 2) TEST_ERROR
+
+    /* Walk the index */
+    HDmemset(&udata, 0, sizeof(udata));
+    if(H5Dchunk_iter(dsid, chunk_info_iter_cb, &udata) != 0) TEST_ERROR
+    if(udata.nchunks != 2) TEST_ERROR
+    for(u = 0; u < 2; u++) {
+        if(udata.filter_mask[u] != 0) TEST_ERROR
+        if(udata.size[u] != sizeof(buf)) TEST_ERROR
+        if(HADDR_UNDEF == udata.addr[u]) TEST_ERROR
+
+        /* Each chunk written is seen once */
+        for(v = 0; v < 2; v++)
+            if(udata.offset[v][0] == chunk_offset[u][0] && udata.offset[v][1] == chunk_offset[u][1])
+                break;
+        if(v == 2) TEST_ERROR
+
+        /* The chunk's information by position agrees */
+        if(H5Dget_chunk_info(dsid, (hsize_t)u, offset, &filter_mask, &addr, &size) < 0) TEST_ERROR
+        if(offset[0] != udata.offset[u][0] || offset[1] != udata.offset[u][1]) TEST_ERROR
+        if(filter_mask != udata.filter_mask[u] || addr != udata.addr[u] || size != udata.size[u]) TEST_ERROR
+
+        /* ... and by offset */
+        if(H5Dget_chunk_info_by_coord(dsid, offset, &filter_mask, &addr, &size) < 0) TEST_ERROR
+        if(filter_mask != udata.filter_mask[u] || addr != udata.addr[u] || size != udata.size[u]) TEST_ERROR
+    } /* end for */
+    if(udata.addr[0] == udata.addr[1]) TEST_ERROR
+
+    /* There are only two chunks */
+    H5E_BEGIN_TRY {
+        status = H5Dget_chunk_info(dsid, (hsize_t)2, offset, &filter_mask, &addr, &size);
+    } H5E_END_TRY;
+    if(status >= 0) TEST_ERROR
+
+    /* The operator can stop the iteration, with success or failure */
+    HDmemset(&udata, 0, sizeof(udata));
+    udata.stop_after = 1;
+    udata.stop_value = 7;
+    if(H5Dchunk_iter(dsid, chunk_info_iter_cb, &udata) != 7) TEST_ERROR
+    if(udata.nchunks != 1) TEST_ERROR
+    HDmemset(&udata, 0, sizeof(udata));
+    udata.stop_after = 1;
+    udata.stop_value = -1;
+    H5E_BEGIN_TRY {
+        status = H5Dchunk_iter(dsid, chunk_info_iter_cb, &udata);
+    } H5E_END_TRY;
+    if(status >= 0) TEST_ERROR
+    if(udata.nchunks != 1) TEST_ERROR
+
+    if(H5Dclose(dsid) < 0) TEST_ERROR
+
+    /* The queries need a chunked dataset */
+    if((dsid = H5Dcreate2(file, DSET_CHUNK_INFO_CONTIG_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        status = H5Dget_num_chunks(dsid, &nchunks);
+    } H5E_END_TRY;
+    if(status >= 0) TEST_ERROR
+    if(H5Dclose(dsid) < 0) TEST_ERROR
+
+    if(H5Sclose(sid) < 0) TEST_ERROR
+    if(H5Pclose(dcpl) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_chunk_info() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_alloc_early
+ *
+ * Purpose:     Tests allocating the chunks of a filtered dataset when it's
+ *              created and extended.  The new chunks are filled with the
+ *              filtered fill value and stored back to back, in index order.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_alloc_early(hid_t file)
+{
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dims[2] = {20, 20};             /* Dataset dimensions */
+    const hsize_t max_dims[2] = {H5S_UNLIMITED, 20};    /* Maximum dataset dimensions */
+    const hsize_t chunk_dims[2] = {5, 5};       /* Chunk dimensions */
+    const int   fill = 7;       /* Fill value */
+    int         buf[30][20];    /* Data read */
+    hsize_t     nchunks;        /* Number of chunks */
+    hsize_t     offset[2];      /* Chunk offset */
+    unsigned    filter_mask;    /* Chunk filter mask */
+    haddr_t     addr;           /* Chunk address */
+    haddr_t     prev_addr = HADDR_UNDEF;        /* Previous chunk's address */
+    hsize_t     size;           /* Chunk size */
+    hsize_t     chunk_size = 0; /* Size of every chunk */
+    hsize_t     u;              /* Local index variable */
+    size_t      v, w;           /* Local index variables */
+
+    TESTING("early allocation of filtered chunks");
+
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) TEST_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) TEST_ERROR
+    if(H5Pset_fletcher32(dcpl) < 0) TEST_ERROR
+    if(H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0) TEST_ERROR
+    if(H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0) TEST_ERROR
+    if((sid = H5Screate_simple(2, dims, max_dims)) < 0) TEST_ERROR
+    if((dsid = H5Dcreate2(file, DSET_CHUNK_ALLOC_EARLY_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Sclose(sid) < 0) TEST_ERROR
+
+    /* Extend the dataset, which allocates the new chunks too */
+    if(H5Dget_num_chunks(dsid, &nchunks) < 0) TEST_ERROR
+    if(nchunks != 16) TEST_ERROR
+    dims[0] = 30;
+    if(H5Dset_extent(dsid, dims) < 0) TEST_ERROR
+    if(H5Dget_num_chunks(dsid, &nchunks) < 0) TEST_ERROR
+    if(nchunks != 24) TEST_ERROR
+
+    /* Each allocation's chunks are stored back to back, in index order */
+    for(u = 0; u < nchunks; u++) {
+        if(H5Dget_chunk_info(dsid, u, offset, &filter_mask, &addr, &size) < 0) TEST_ERROR
+        if(filter_mask != 0) TEST_ERROR
+        if(HADDR_UNDEF == addr) TEST_ERROR
+
+        /* The filter adds a checksum to every chunk */
+        if(0 == u)
+            chunk_size = size;
+        if(size != chunk_size || size != sizeof(int) * 25 + 4) TEST_ERROR
+        if(0 != u && 16 != u && addr != prev_addr + chunk_size) TEST_ERROR
+        prev_addr = addr;
+    } /* end for */
+
+    /* The chunks hold the fill value */
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) TEST_ERROR
+    for(v = 0; v < 30; v++)
+        for(w = 0; w < 20; w++)
+            if(buf[v][w] != fill) TEST_ERROR
+
+    if(H5Dclose(dsid) < 0) TEST_ERROR
+    if(H5Pclose(dcpl) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_chunk_alloc_early() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_alloc_early_align
+ *
+ * Purpose:     Tests allocating the chunks of a filtered dataset when it's
+ *              created and extended, in a file whose allocations are
+ *              aligned.  Every new chunk must start on an aligned address.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_alloc_early_align(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       my_fapl = -1;   /* File access property list ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dims[2] = {20, 20};             /* Dataset dimensions */
+    const hsize_t max_dims[2] = {H5S_UNLIMITED, 20};    /* Maximum dataset dimensions */
+    const hsize_t chunk_dims[2] = {5, 5};       /* Chunk dimensions */
+    const int   fill = 7;       /* Fill value */
+    int         buf[30][20];    /* Data read */
+    hsize_t     nchunks;        /* Number of chunks */
+    hsize_t     offset[2];      /* Chunk offset */
+    unsigned    filter_mask;    /* Chunk filter mask */
+    haddr_t     addr;           /* Chunk address */
+    hsize_t     size;           /* Chunk size */
+    hsize_t     u;              /* Local index variable */
+    size_t      v, w;           /* Local index variables */
+
+    TESTING("early allocation of filtered chunks with alignment");
+
+    h5_fixname(FILENAME[10], fapl, filename, sizeof filename);
+
+    /* Align every allocation */
+    if((my_fapl = H5Pcopy(fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_alignment(my_fapl, (hsize_t)1, (hsize_t)CHUNK_ALLOC_ALIGN) < 0) FAIL_STACK_ERROR
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0) FAIL_STACK_ERROR
+
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fletcher32(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0) FAIL_STACK_ERROR
+    if(H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, max_dims)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, DSET_CHUNK_ALLOC_EARLY_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+
+    /* Extend the dataset, which allocates the new chunks too */
+    dims[0] = 30;
+    if(H5Dset_extent(dsid, dims) < 0) FAIL_STACK_ERROR
+    if(H5Dget_num_chunks(dsid, &nchunks) < 0) FAIL_STACK_ERROR
+    if(nchunks != 24) TEST_ERROR
+
+    /* Every chunk is aligned */
+    for(u = 0; u < nchunks; u++) {
+        if(H5Dget_chunk_info(dsid, u, offset, &filter_mask, &addr, &size) < 0) FAIL_STACK_ERROR
+        if(HADDR_UNDEF == addr) TEST_ERROR
+        if(size != sizeof(int) * 25 + 4) TEST_ERROR
+        if(0 != addr % CHUNK_ALLOC_ALIGN) TEST_ERROR
+    } /* end for */
+
+    /* The chunks hold the fill value */
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) FAIL_STACK_ERROR
+    for(v = 0; v < 30; v++)
+        for(w = 0; w < 20; w++)
+            if(buf[v][w] != fill) TEST_ERROR
+
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(my_fapl) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Fclose(fid);
+        H5Pclose(my_fapl);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_chunk_alloc_early_align() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_large_chunk_shrink
+ *
+ * Purpose: Tests support for shrinking a chunk larger than 1 MB by a
+ *              size greater than 1 MB.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ * Programmer:  Neil Fortner
+ *              Monday, November 31, 2011
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_large_chunk_shrink(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       scalar_sid = -1;/* Scalar dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dim, max_dim, chunk_dim; /* Dataset and chunk dimensions */
+    hsize_t     hs_offset;      /* Hyperslab offset */
+    hsize_t     hs_size;        /* Hyperslab size */
+    unsigned    write_elem, read_elem;  /* Element written/read */
+
+    TESTING("shrinking large chunk");
+
+    h5_fixname(FILENAME[10], fapl, filename, sizeof filename);
+
+    /* Create file */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+
+    /* Create dataset creation property list */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+
+    /* Set 2 MB chunk size */
+    chunk_dim = 2 * 1024 * 1024 / sizeof(unsigned);
+    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+
+    /* Create scalar dataspace */
+    if((scalar_sid = H5Screate(H5S_SCALAR)) < 0) FAIL_STACK_ERROR
+
+    /* Create 1-D dataspace */
+    dim = 2 * 1024 * 1024 / sizeof(unsigned);
+    max_dim = H5S_UNLIMITED;
+    if((sid = H5Screate_simple(1, &dim, &max_dim)) < 0) FAIL_STACK_ERROR
+
+    /* Create 2 MB chunked dataset */
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_UINT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Select last element in the dataset */
+    hs_offset = dim - 1;
+    hs_size = 1;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &hs_offset, NULL, &hs_size, NULL) < 0) FAIL_STACK_ERROR
+
+    /* Read (unwritten) element from dataset */
+    read_elem = 1;
+    if(H5Dread(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &read_elem) < 0) FAIL_STACK_ERROR
+
+    /* Verify unwritten element is fill value (0) */
+    if(read_elem != 0) FAIL_PUTS_ERROR("invalid unwritten element read");
+
+    /* Write element to dataset */
+    write_elem = 2;
+    if(H5Dwrite(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &write_elem) < 0) FAIL_STACK_ERROR
+
+    /* Read element from dataset */
+    read_elem = write_elem + 1;
+    if(H5Dread(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &read_elem) < 0) FAIL_STACK_ERROR
+
+    /* Verify written element is read in */
+    if(read_elem != write_elem) FAIL_PUTS_ERROR("invalid written element read");
+
+    /* Shrink dataset to 512 KB */
+    dim = 512 * 1024 / sizeof(unsigned);
+    if(H5Dset_extent(dsid, &dim) < 0) FAIL_STACK_ERROR
+
+    /* Expand dataset back to 2MB */
+    dim = 2 * 1024 * 1024 / sizeof(unsigned);
+    if(H5Dset_extent(dsid, &dim) < 0) FAIL_STACK_ERROR
+
+    /* Read element from dataset */
+    read_elem = 1;
+    if(H5Dread(dsid, H5T_NATIVE_UINT, scalar_sid, sid, H5P_DEFAULT, &read_elem) < 0) FAIL_STACK_ERROR
+
+    /* Verify element is now 0 */
+    if(read_elem != 0) FAIL_PUTS_ERROR("invalid element read");
+
+    /* Close everything */
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(scalar_sid) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Sclose(scalar_sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_large_chunk_shrink() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_zero_dim_dset
+ *
+ * Purpose:     Tests support for reading a 1D chunled dataset with 
+ *              dimension size = 0.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ * Programmer:  Mohamad Chaarawi
+ *              Wednesdat, July 9, 2014
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_zero_dim_dset(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dim, chunk_dim; /* Dataset and chunk dimensions */
+    int         data[1];
+
+    TESTING("shrinking large chunk");
+
+    h5_fixname(FILENAME[13], fapl, filename, sizeof filename);
+
+    /* Create file */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+
+    /* Create dataset creation property list */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+
+    /* Set 1 chunk size */
+    chunk_dim = 1;
+    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+
+    /* Create 1D dataspace with 0 dim size */
+    dim = 0;
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+
+    /* Create chunked dataset */
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* write 0 elements from dataset */
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, data) < 0) FAIL_STACK_ERROR
+
+    /* Read 0 elements from dataset */
+    if(H5Dread(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, data) < 0) FAIL_STACK_ERROR
+
+    /* Close everything */
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_zero_dim_dset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_multi_dset_io
+ *
+ * Purpose:     Tests H5Dwrite_multi and H5Dread_multi on datasets with
+ *              different layouts, datatypes and selections, including
+ *              several operations on one dataset.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define MULTI_DSET_IO_DIM       10
+#define MULTI_DSET_IO_NOPS      4
+static herr_t
+test_multi_dset_io(hid_t file)
+{
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       half_sid[2] = {-1, -1};   /* File dataspaces selecting each half */
+    hid_t       mem_sid = -1;   /* Memory dataspace for half a dataset */
+    hid_t       dsid[3] = {-1, -1, -1};   /* Dataset IDs */
+    hid_t       op_dsid[MULTI_DSET_IO_NOPS];      /* Dataset of each operation */
+    hid_t       op_tid[MULTI_DSET_IO_NOPS];       /* Memory datatype of each operation */
+    hid_t       op_msid[MULTI_DSET_IO_NOPS];      /* Memory dataspace of each operation */
+    hid_t       op_fsid[MULTI_DSET_IO_NOPS];      /* File dataspace of each operation */
+    const void *wbufs[MULTI_DSET_IO_NOPS];        /* Buffers to write */
+    void       *rbufs[MULTI_DSET_IO_NOPS];        /* Buffers to read into */
+    hsize_t     dim = MULTI_DSET_IO_DIM, half_dim = MULTI_DSET_IO_DIM / 2;
+    hsize_t     chunk_dim = 3;  /* Chunk dimension */
+    hsize_t     start;          /* Hyperslab start */
+    int         wints[MULTI_DSET_IO_DIM], rints[MULTI_DSET_IO_DIM];
+    int         wchunk[MULTI_DSET_IO_DIM];
+    double      rchunk[MULTI_DSET_IO_DIM];
+    short       wshorts[MULTI_DSET_IO_DIM], rshorts[MULTI_DSET_IO_DIM];
+    unsigned    u;
+    herr_t      ret;
+
+    TESTING("multi-dataset I/O");
+
+    for(u = 0; u < MULTI_DSET_IO_DIM; u++) {
+        wints[u] = (int)u;
+        wchunk[u] = (int)(u * 10);
+        wshorts[u] = (short)(100 + u);
+    } /* end for */
+
+    /* Create dataspaces */
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+    if((mem_sid = H5Screate_simple(1, &half_dim, NULL)) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < 2; u++) {
+        start = u * half_dim;
+        if((half_sid[u] = H5Scopy(sid)) < 0) FAIL_STACK_ERROR
+        if(H5Sselect_hyperslab(half_sid[u], H5S_SELECT_SET, &start, NULL, &half_dim, NULL) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Create a contiguous, a chunked and a compact dataset */
+    if((dsid[0] = H5Dcreate2(file, "multi_contig", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+    if((dsid[1] = H5Dcreate2(file, "multi_chunked", H5T_NATIVE_DOUBLE, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_layout(dcpl, H5D_COMPACT) < 0) FAIL_STACK_ERROR
+    if((dsid[2] = H5Dcreate2(file, "multi_compact", H5T_NATIVE_SHORT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+
+    /* Write the compact dataset, the chunked dataset (converting int to
+     * double) and the contiguous dataset in two halves, in one call */
+    op_dsid[0] = dsid[2]; op_tid[0] = H5T_NATIVE_SHORT; op_msid[0] = H5S_ALL; op_fsid[0] = H5S_ALL; wbufs[0] = wshorts;
+    op_dsid[1] = dsid[0]; op_tid[1] = H5T_NATIVE_INT; op_msid[1] = mem_sid; op_fsid[1] = half_sid[1]; wbufs[1] = wints + half_dim;
+    op_dsid[2] = dsid[1]; op_tid[2] = H5T_NATIVE_INT; op_msid[2] = H5S_ALL; op_fsid[2] = H5S_ALL; wbufs[2] = wchunk;
+    op_dsid[3] = dsid[0]; op_tid[3] = H5T_NATIVE_INT; op_msid[3] = mem_sid; op_fsid[3] = half_sid[0]; wbufs[3] = wints;
+    if(H5Dwrite_multi((size_t)MULTI_DSET_IO_NOPS, op_dsid, op_tid, op_msid, op_fsid, H5P_DEFAULT, wbufs) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read them all back in one call, converting the chunked dataset back */
+    op_msid[1] = op_msid[3] = H5S_ALL; op_fsid[1] = op_fsid[3] = H5S_ALL;
+    op_tid[2] = H5T_NATIVE_DOUBLE;
+    rbufs[0] = rshorts; rbufs[1] = rints; rbufs[2] = rchunk; rbufs[3] = rints;
+    HDmemset(rshorts, 0, sizeof(rshorts));
+    HDmemset(rints, 0, sizeof(rints));
+    HDmemset(rchunk, 0, sizeof(rchunk));
+    if(H5Dread_multi((size_t)MULTI_DSET_IO_NOPS, op_dsid, op_tid, op_msid, op_fsid, H5P_DEFAULT, rbufs) < 0)
+        FAIL_STACK_ERROR
+
+    for(u = 0; u < MULTI_DSET_IO_DIM; u++)
+        if(rints[u] != wints[u] || rshorts[u] != wshorts[u] || rchunk[u] != (double)wchunk[u]) {
+            H5_FAILED(); AT();
+            printf("    Read different values than written at index %u\n", u);
+            goto error;
+        } /* end if */
+
+    /* A bad dataset anywhere in the arrays should fail before any I/O */
+    for(u = 0; u < MULTI_DSET_IO_DIM; u++)
+        wints[u] = -1;
+    op_dsid[1] = dsid[0]; op_tid[1] = H5T_NATIVE_INT; op_msid[1] = H5S_ALL; op_fsid[1] = H5S_ALL; wbufs[1] = wints;
+    op_dsid[2] = sid;
+    H5E_BEGIN_TRY {
+        ret = H5Dwrite_multi((size_t)MULTI_DSET_IO_NOPS, op_dsid, op_tid, op_msid, op_fsid, H5P_DEFAULT, wbufs);
+    } H5E_END_TRY;
+    if(ret >= 0) {
+        H5_FAILED(); AT();
+        printf("    H5Dwrite_multi succeeded with an invalid dataset\n");
+        goto error;
+    } /* end if */
+    if(H5Dread(dsid[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rints) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < MULTI_DSET_IO_DIM; u++)
+        if(rints[u] != (int)u) {
+            H5_FAILED(); AT();
+            printf("    Failed H5Dwrite_multi modified the dataset\n");
+            goto error;
+        } /* end if */
+
+    /* So should a memory datatype that can't be converted */
+    op_dsid[2] = dsid[1]; op_tid[2] = H5T_NATIVE_INT;
+    op_tid[3] = H5T_C_S1; op_msid[3] = H5S_ALL; op_fsid[3] = H5S_ALL;
+    H5E_BEGIN_TRY {
+        ret = H5Dwrite_multi((size_t)MULTI_DSET_IO_NOPS, op_dsid, op_tid, op_msid, op_fsid, H5P_DEFAULT, wbufs);
+    } H5E_END_TRY;
+    if(ret >= 0) {
+        H5_FAILED(); AT();
+        printf("    H5Dwrite_multi succeeded with an unconvertible datatype\n");
+        goto error;
+    } /* end if */
+    if(H5Dread(dsid[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rints) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < MULTI_DSET_IO_DIM; u++)
+        if(rints[u] != (int)u) {
+            H5_FAILED(); AT();
+            printf("    Failed H5Dwrite_multi modified the dataset\n");
+            goto error;
+        } /* end if */
+    op_tid[3] = H5T_NATIVE_INT;
+    H5E_BEGIN_TRY {
+        ret = H5Dread_multi((size_t)MULTI_DSET_IO_NOPS, op_dsid, op_tid, op_msid, op_fsid, H5P_DEFAULT, rbufs);
+    } H5E_END_TRY;
+    if(ret < 0) FAIL_STACK_ERROR
+    op_tid[0] = sid;
+    H5E_BEGIN_TRY {
+        ret = H5Dread_multi((size_t)MULTI_DSET_IO_NOPS, op_dsid, op_tid, op_msid, op_fsid, H5P_DEFAULT, rbufs);
+    } H5E_END_TRY;
+    if(ret >= 0) {
+        H5_FAILED(); AT();
+        printf("    H5Dread_multi succeeded with an invalid datatype\n");
+        goto error;
+    } /* end if */
+
+    /* Close everything */
+    for(u = 0; u < 3; u++)
+        if(H5Dclose(dsid[u]) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < 2; u++)
+        if(H5Sclose(half_sid[u]) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(mem_sid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        for(u = 0; u < 3; u++)
+            H5Dclose(dsid[u]);
+        for(u = 0; u < 2; u++)
+            H5Sclose(half_sid[u]);
+        H5Sclose(mem_sid);
+        H5Sclose(sid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_multi_dset_io() */
 
 
 /*-------------------------------------------------------------------------
@@ -9100,6 +10472,7 @@ main(void)
         nerrors += (test_max_compact(my_fapl) < 0  		? 1 : 0);
         nerrors += (test_conv_buffer(file) < 0		? 1 : 0);
         nerrors += (test_tconv(file) < 0			? 1 : 0);
+        nerrors += (test_multi_dset_io(file) < 0		? 1 : 0);
         nerrors += (test_filters(file, my_fapl) < 0		? 1 : 0);
         nerrors += (test_onebyte_shuffle(file) < 0 		? 1 : 0);
         nerrors += (test_nbit_int(file) < 0 		? 1 : 0);
@@ -9111,6 +10484,7 @@ main(void)
         nerrors += (test_nbit_compound_3(file) < 0 		? 1 : 0);
         nerrors += (test_nbit_int_size(file) < 0 		? 1 : 0);
         nerrors += (test_nbit_flt_size(file) < 0 		? 1 : 0);
+        nerrors += (test_nbit_bit_layout() < 0 		? 1 : 0);
         nerrors += (test_scaleoffset_int(file) < 0 		? 1 : 0);
         nerrors += (test_scaleoffset_int_2(file) < 0 	? 1 : 0);
         nerrors += (test_scaleoffset_float(file) < 0 	? 1 : 0);
@@ -9123,6 +10497,13 @@ main(void)
         nerrors += (test_missing_filter(file) < 0		? 1 : 0);
         nerrors += (test_can_apply(file) < 0		? 1 : 0);
         nerrors += (test_can_apply2(file) < 0		? 1 : 0);
+        nerrors += (test_filter_split(file) < 0		? 1 : 0);
+        nerrors += (test_filter_stats(file) < 0		? 1 : 0);
+        nerrors += (test_filter_buf_pool(file) < 0		? 1 : 0);
+        nerrors += (test_filter_skip(file) < 0		? 1 : 0);
+        nerrors += (test_chunk_info(file) < 0		? 1 : 0);
+        nerrors += (test_chunk_alloc_early(file) < 0		? 1 : 0);
+        nerrors += (test_chunk_alloc_early_align(my_fapl) < 0	? 1 : 0);
         nerrors += (test_set_local(my_fapl) < 0		? 1 : 0);
         nerrors += (test_can_apply_szip(file) < 0		? 1 : 0);
         nerrors += (test_compare_dcpl(file) < 0		? 1 : 0);
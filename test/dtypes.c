@@ -3281,6 +3281,146 @@ error:
 } /* end test_compound_18() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_compound_19
+ *
+ * Purpose:     Tests compound conversions where the destination reorders
+ *              and subsets the source members without converting any of
+ *              them, for destinations both smaller and larger than the
+ *              source.  Destination members missing from the source must
+ *              keep their background values.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_compound_19(void)
+{
+    typedef struct {
+        int     a;
+        double  b;
+        short   c;
+        char    d[5];
+        long    e;
+    } src_type_t;
+
+    typedef struct {
+        char    d[5];
+        double  b;
+        int     x;
+        int     a;
+    } small_type_t;
+
+    typedef struct {
+        short   c;
+        int     a;
+        double  b;
+        char    d[5];
+        double  y[4];
+    } large_type_t;
+
+    hid_t       src_type = -1, small_type = -1, large_type = -1, str_type = -1;
+    src_type_t  src[10];
+    small_type_t *small = NULL;
+    large_type_t *large = NULL;
+    void        *buf = NULL, *bkg = NULL;
+    size_t      buf_size = 10 * MAX(sizeof(src_type_t), sizeof(large_type_t));
+    int         i;
+
+    TESTING("compound subset and reorder without member conversion");
+
+    for(i = 0; i < 10; i++) {
+        src[i].a = i;
+        src[i].b = i * 10.0;
+        src[i].c = (short)(i * 100);
+        HDsnprintf(src[i].d, sizeof(src[i].d), "d%d", i);
+        src[i].e = -i;
+    } /* end for */
+
+    if(NULL == (buf = HDcalloc((size_t)1, buf_size))) TEST_ERROR
+    if(NULL == (bkg = HDcalloc((size_t)1, buf_size))) TEST_ERROR
+
+    if((str_type = H5Tcopy(H5T_C_S1)) < 0) FAIL_STACK_ERROR
+    if(H5Tset_size(str_type, sizeof(src[0].d)) < 0) FAIL_STACK_ERROR
+
+    if((src_type = H5Tcreate(H5T_COMPOUND, sizeof(src_type_t))) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(src_type, "a", HOFFSET(src_type_t, a), H5T_NATIVE_INT) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(src_type, "b", HOFFSET(src_type_t, b), H5T_NATIVE_DOUBLE) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(src_type, "c", HOFFSET(src_type_t, c), H5T_NATIVE_SHORT) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(src_type, "d", HOFFSET(src_type_t, d), str_type) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(src_type, "e", HOFFSET(src_type_t, e), H5T_NATIVE_LONG) < 0) FAIL_STACK_ERROR
+
+    if((small_type = H5Tcreate(H5T_COMPOUND, sizeof(small_type_t))) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(small_type, "d", HOFFSET(small_type_t, d), str_type) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(small_type, "b", HOFFSET(small_type_t, b), H5T_NATIVE_DOUBLE) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(small_type, "x", HOFFSET(small_type_t, x), H5T_NATIVE_INT) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(small_type, "a", HOFFSET(small_type_t, a), H5T_NATIVE_INT) < 0) FAIL_STACK_ERROR
+
+    if((large_type = H5Tcreate(H5T_COMPOUND, sizeof(large_type_t))) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(large_type, "c", HOFFSET(large_type_t, c), H5T_NATIVE_SHORT) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(large_type, "a", HOFFSET(large_type_t, a), H5T_NATIVE_INT) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(large_type, "b", HOFFSET(large_type_t, b), H5T_NATIVE_DOUBLE) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(large_type, "d", HOFFSET(large_type_t, d), str_type) < 0) FAIL_STACK_ERROR
+
+    /* Convert to the smaller, reordered type */
+    HDmemcpy(buf, src, sizeof(src));
+    small = (small_type_t *)bkg;
+    for(i = 0; i < 10; i++)
+        small[i].x = 1000 + i;
+    if(H5Tconvert(src_type, small_type, (size_t)10, buf, bkg, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    small = (small_type_t *)buf;
+    for(i = 0; i < 10; i++)
+        if(small[i].a != src[i].a || !H5_DBL_ABS_EQUAL(small[i].b, src[i].b) ||
+                HDstrcmp(small[i].d, src[i].d) || small[i].x != 1000 + i) {
+            H5_FAILED(); AT();
+            printf("    element %d of the smaller type is wrong\n", i);
+            goto error;
+        } /* end if */
+
+    /* Convert to the larger type */
+    HDmemset(bkg, 0, buf_size);
+    HDmemcpy(buf, src, sizeof(src));
+    large = (large_type_t *)bkg;
+    for(i = 0; i < 10; i++)
+        large[i].y[3] = -1.0 * i;
+    if(H5Tconvert(src_type, large_type, (size_t)10, buf, bkg, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    large = (large_type_t *)buf;
+    for(i = 0; i < 10; i++)
+        if(large[i].a != src[i].a || !H5_DBL_ABS_EQUAL(large[i].b, src[i].b) ||
+                large[i].c != src[i].c || HDstrcmp(large[i].d, src[i].d) ||
+                !H5_DBL_ABS_EQUAL(large[i].y[3], -1.0 * i)) {
+            H5_FAILED(); AT();
+            printf("    element %d of the larger type is wrong\n", i);
+            goto error;
+        } /* end if */
+
+    if(H5Tclose(src_type) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(small_type) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(large_type) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(str_type) < 0) FAIL_STACK_ERROR
+    HDfree(buf);
+    HDfree(bkg);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(src_type);
+        H5Tclose(small_type);
+        H5Tclose(large_type);
+        H5Tclose(str_type);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+    if(bkg)
+        HDfree(bkg);
+    return 1;
+} /* end test_compound_19() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_query
  *
@@ -4824,6 +4964,99 @@ convert_opaque(hid_t H5_ATTR_UNUSED st, hid_t H5_ATTR_UNUSED dt, H5T_cdata_t *cd
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:	test_path_cache
+ *
+ * Purpose:	Tests that conversion paths between datatypes that can't
+ *		change, which are found through the path cache, follow
+ *		conversion functions being registered and unregistered.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_path_cache(void)
+{
+    hid_t	file = -1, st = -1, dt = -1;
+    char	filename[1024];
+    char	buf[4 * 16];
+    herr_t	status;
+    int		i;
+
+    TESTING("conversion path cache");
+
+    num_opaque_conversions_g = 0;
+
+    /* Committed datatypes are read-only, so their paths are cached */
+    h5_fixname(FILENAME[3], H5P_DEFAULT, filename, sizeof filename);
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((st = H5Tcreate(H5T_OPAQUE, (size_t)4)) < 0) FAIL_STACK_ERROR
+    if(H5Tset_tag(st, "path cache source type") < 0) FAIL_STACK_ERROR
+    if(H5Tcommit2(file, "st", st, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if((dt = H5Tcreate(H5T_OPAQUE, (size_t)4)) < 0) FAIL_STACK_ERROR
+    if(H5Tset_tag(dt, "path cache destination type") < 0) FAIL_STACK_ERROR
+    if(H5Tcommit2(file, "dt", dt, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+
+    /* Repeated conversions use the registered function */
+    if(H5Tregister(H5T_PERS_HARD, "cache_test", st, dt, convert_opaque) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < 3; i++)
+        if(H5Tconvert(st, dt, (size_t)16, buf, NULL, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(3 != num_opaque_conversions_g) {
+        H5_FAILED(); AT();
+        printf("    unexpected number of conversions: %d\n", num_opaque_conversions_g);
+        goto error;
+    } /* end if */
+
+    /* Once the function is gone, the conversion must fail again */
+    if(H5Tunregister(H5T_PERS_HARD, "cache_test", st, dt, convert_opaque) < 0) FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        status = H5Tconvert(st, dt, (size_t)16, buf, NULL, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(status >= 0 || 3 != num_opaque_conversions_g) {
+        H5_FAILED(); AT();
+        printf("    conversion used an unregistered function\n");
+        goto error;
+    } /* end if */
+
+    /* Registering it again makes the conversion work again */
+    if(H5Tregister(H5T_PERS_HARD, "cache_test", st, dt, convert_opaque) < 0) FAIL_STACK_ERROR
+    if(H5Tconvert(st, dt, (size_t)16, buf, NULL, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(4 != num_opaque_conversions_g) {
+        H5_FAILED(); AT();
+        printf("    unexpected number of conversions: %d\n", num_opaque_conversions_g);
+        goto error;
+    } /* end if */
+    if(H5Tunregister(H5T_PERS_HARD, "cache_test", st, dt, convert_opaque) < 0) FAIL_STACK_ERROR
+
+    /* Conversions of a type to itself still take the no-op path */
+    if(H5Tconvert(st, st, (size_t)16, buf, NULL, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(4 != num_opaque_conversions_g) {
+        H5_FAILED(); AT();
+        printf("    no-op conversion called the conversion function\n");
+        goto error;
+    } /* end if */
+
+    if(H5Tclose(st) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(dt) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(file) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tunregister(H5T_PERS_HARD, "cache_test", st, dt, convert_opaque);
+        H5Tclose(st);
+        H5Tclose(dt);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_path_cache() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	test_opaque
  *
@@ -7320,11 +7553,13 @@ main(void)
     nerrors += test_compound_16();
     nerrors += test_compound_17();
     nerrors += test_compound_18();
+    nerrors += test_compound_19();
     nerrors += test_conv_enum_1();
     nerrors += test_conv_enum_2();
     nerrors += test_conv_bitfield();
     nerrors += test_bitfield_funcs();
     nerrors += test_opaque();
+    nerrors += test_path_cache();
     nerrors += test_set_order();
     nerrors += test_utf_ascii_conv();
 
@@ -68,6 +68,9 @@
 #define DSET3_NAME "Dataset3"
 #define NUM_DSETS       3
 
+/* Maximum # of attributes read at once in test_attr_read_multi() */
+#define ATTR_READ_MULTI_MAX     64
+
 /* Group Information */
 #define GROUP1_NAME "/Group1"
 #define GROUP2_NAME "/Group2"
@@ -8005,6 +8008,350 @@ test_attr_create_by_name(hbool_t new_format, hid_t fcpl, hid_t fapl)
     CHECK(ret, FAIL, "H5Sclose");
 }   /* test_attr_create_by_name() */
 
+
+/****************************************************************
+**
+**  attr_read_multi_check(): Check reading many attributes of an
+**      object at once, in both name order and by name.
+**
+****************************************************************/
+static int
+attr_read_multi_check(hid_t fid, const char *dsetname, unsigned max_attrs)
+{
+    char        attrnames[ATTR_READ_MULTI_MAX][NAME_BUF_SIZE];  /* Names of attributes */
+    const char *names[ATTR_READ_MULTI_MAX];     /* Pointers to attribute names */
+    hid_t       types[ATTR_READ_MULTI_MAX];     /* Memory datatypes */
+    void       *bufs[ATTR_READ_MULTI_MAX];      /* Attribute buffers */
+    double      dvals[ATTR_READ_MULTI_MAX];     /* Values read as double */
+    int         ivals[ATTR_READ_MULTI_MAX];     /* Values read as int */
+    const char *bad_names[2];   /* Names including a non-existant attribute */
+    unsigned    u;              /* Local index variable */
+    int         old_nerrs;      /* Number of errors when entering this check */
+    herr_t	ret;		/* Generic return value		*/
+
+    /* Retrieve the current # of reported errors */
+    old_nerrs = GetTestNumErrs();
+
+    HDassert(max_attrs <= ATTR_READ_MULTI_MAX);
+
+    /* Read all the attributes in name order, converting to double */
+    for(u = 0; u < max_attrs; u++) {
+        types[u] = H5T_NATIVE_DOUBLE;
+        dvals[u] = -1.0;
+        bufs[u] = &dvals[u];
+    } /* end for */
+    ret = H5Aread_multi(fid, dsetname, (size_t)max_attrs, NULL, types, bufs, H5P_DEFAULT);
+    CHECK(ret, FAIL, "H5Aread_multi");
+    for(u = 0; u < max_attrs; u++)
+        VERIFY(dvals[u], (double)u, "H5Aread_multi");
+
+    /* Read every other attribute by name, in reverse order, alternating
+     * between converted and unconverted reads */
+    for(u = 0; u < max_attrs / 2; u++) {
+        unsigned idx = max_attrs - 1 - (2 * u);
+
+        sprintf(attrnames[u], "attr %02u", idx);
+        names[u] = attrnames[u];
+        if(u % 2) {
+            types[u] = H5T_NATIVE_DOUBLE;
+            dvals[u] = -1.0;
+            bufs[u] = &dvals[u];
+        } /* end if */
+        else {
+            types[u] = H5T_NATIVE_UINT;
+            ivals[u] = -1;
+            bufs[u] = &ivals[u];
+        } /* end else */
+    } /* end for */
+    ret = H5Aread_multi(fid, dsetname, (size_t)(max_attrs / 2), names, types, bufs, H5P_DEFAULT);
+    CHECK(ret, FAIL, "H5Aread_multi");
+    for(u = 0; u < max_attrs / 2; u++) {
+        unsigned idx = max_attrs - 1 - (2 * u);
+
+        if(u % 2)
+            VERIFY(dvals[u], (double)idx, "H5Aread_multi");
+        else
+            VERIFY(ivals[u], (int)idx, "H5Aread_multi");
+    } /* end for */
+
+    /* Check for reading a non-existant attribute */
+    bad_names[0] = "attr 00";
+    bad_names[1] = "foo";
+    types[0] = types[1] = H5T_NATIVE_INT;
+    bufs[0] = &ivals[0];
+    bufs[1] = &ivals[1];
+    H5E_BEGIN_TRY {
+        ret = H5Aread_multi(fid, dsetname, (size_t)2, bad_names, types, bufs, H5P_DEFAULT);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Aread_multi");
+
+    /* Check for reading more attributes than the object has */
+    for(u = 0; u <= max_attrs; u++) {
+        types[u] = H5T_NATIVE_DOUBLE;
+        bufs[u] = &dvals[u];
+    } /* end for */
+    H5E_BEGIN_TRY {
+        ret = H5Aread_multi(fid, dsetname, (size_t)(max_attrs + 1), NULL, types, bufs, H5P_DEFAULT);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Aread_multi");
+
+    /* Retrieve current # of errors */
+    if(old_nerrs == GetTestNumErrs())
+        return(0);
+    else
+        return(-1);
+} /* end attr_read_multi_check() */
+
+
+/****************************************************************
+**
+**  test_attr_read_multi(): Test basic H5A (attribute) code.
+**      Tests reading many attributes of an object at once
+**
+****************************************************************/
+static void
+test_attr_read_multi(hbool_t new_format, hid_t fcpl, hid_t fapl)
+{
+    hid_t	fid;		/* HDF5 File ID			*/
+    hid_t	dset;		/* Dataset ID			*/
+    hid_t	sid;	        /* Dataspace ID			*/
+    hid_t	attr;	        /* Attribute ID			*/
+    hid_t	dcpl;	        /* Dataset creation property list ID */
+    unsigned    max_compact;    /* Maximum # of attributes to store compactly */
+    unsigned    min_dense;      /* Minimum # of attributes to store "densely" */
+    htri_t	is_dense;	/* Are attributes stored densely? */
+    char	attrname[NAME_BUF_SIZE];    /* Name of attribute */
+    unsigned    u, v;           /* Local index variables */
+    herr_t	ret;		/* Generic return value		*/
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Reading Many Attributes At Once\n"));
+
+    /* Create dataspace for dataset & attributes */
+    sid = H5Screate(H5S_SCALAR);
+    CHECK(sid, FAIL, "H5Screate");
+
+    /* Create dataset creation property list */
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, FAIL, "H5Pcreate");
+
+    /* Query the attribute creation properties */
+    ret = H5Pget_attr_phase_change(dcpl, &max_compact, &min_dense);
+    CHECK(ret, FAIL, "H5Pget_attr_phase_change");
+    HDassert((max_compact * 2) < ATTR_READ_MULTI_MAX);
+
+    /* Create file */
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    /* Create dataset */
+    dset = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_UCHAR, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(dset, FAIL, "H5Dcreate2");
+
+    /* Create attributes, in reverse name order, up to limit of compact form
+     * and then on into dense form */
+    for(u = 0; u < (max_compact * 2); u++) {
+        unsigned val = (max_compact * 2) - 1 - u;
+
+        sprintf(attrname, "attr %02u", val);
+        attr = H5Acreate2(dset, attrname, H5T_NATIVE_UINT, sid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(attr, FAIL, "H5Acreate2");
+
+        /* Write data into the attribute */
+        ret = H5Awrite(attr, H5T_NATIVE_UINT, &val);
+        CHECK(ret, FAIL, "H5Awrite");
+
+        /* Close attribute */
+        ret = H5Aclose(attr);
+        CHECK(ret, FAIL, "H5Aclose");
+
+        /* Check reading with compact storage, as well as dense storage */
+        if(u == (max_compact - 1)) {
+            is_dense = H5O_is_attr_dense_test(dset);
+            VERIFY(is_dense, FALSE, "H5O_is_attr_dense_test");
+
+            /* Attributes were created in reverse order, so the lowest
+             * 'max_compact' names are the ones present */
+            for(v = 0; v < max_compact; v++) {
+                double dval = -1.0;     /* Value read */
+                const char *name = attrname;
+                hid_t type = H5T_NATIVE_DOUBLE;
+                void *buf = &dval;
+
+                sprintf(attrname, "attr %02u", max_compact + v);
+                ret = H5Aread_multi(fid, DSET1_NAME, (size_t)1, &name, &type, &buf, H5P_DEFAULT);
+                CHECK(ret, FAIL, "H5Aread_multi");
+                VERIFY(dval, (double)(max_compact + v), "H5Aread_multi");
+            } /* end for */
+        } /* end if */
+    } /* end for */
+
+    /* Verify state of object */
+    is_dense = H5O_is_attr_dense_test(dset);
+    VERIFY(is_dense, (new_format ? TRUE : FALSE), "H5O_is_attr_dense_test");
+
+    /* Check reading all the attributes */
+    ret = attr_read_multi_check(fid, DSET1_NAME, max_compact * 2);
+    CHECK(ret, FAIL, "attr_read_multi_check");
+
+    /* Close dataset */
+    ret = H5Dclose(dset);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    /* Close file */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Close property list */
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    /* Close dataspace */
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+}   /* test_attr_read_multi() */
+
+/****************************************************************
+**
+**  test_attr_read_multi_vlen(): Test basic H5A (attribute) code.
+**      Tests reading many attributes with variable-length data
+**      at once
+**
+****************************************************************/
+static void
+test_attr_read_multi_vlen(hid_t fcpl, hid_t fapl)
+{
+    typedef struct {
+        int     i;
+        hvl_t   v;
+    } cmpd_vlen_t;
+    hid_t	fid;		/* HDF5 File ID			*/
+    hid_t	dset;		/* Dataset ID			*/
+    hid_t	sid;	        /* Dataspace ID			*/
+    hid_t	attr;	        /* Attribute ID			*/
+    hid_t	str_tid;	/* Variable-length string datatype */
+    hid_t	vlen_tid;	/* Variable-length sequence datatype */
+    hid_t	cmpd_tid;	/* Compound datatype with a variable-length field */
+    const char  *wstr = "hello";        /* String written */
+    int         wints[3] = {1, 2, 3};   /* Sequence written */
+    cmpd_vlen_t wcmpd;          /* Compound written */
+    unsigned    wval = 42;      /* Number written */
+    char        *rstr = NULL;   /* String read */
+    cmpd_vlen_t rcmpd;          /* Compound read */
+    unsigned    rval = 0;       /* Number read */
+    const char  *names[3];      /* Names of attributes to read */
+    hid_t       types[3];       /* Memory datatypes */
+    void        *bufs[3];       /* Attribute buffers */
+    herr_t	ret;		/* Generic return value		*/
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Reading Many Variable-Length Attributes At Once\n"));
+
+    /* Create dataspace for dataset & attributes */
+    sid = H5Screate(H5S_SCALAR);
+    CHECK(sid, FAIL, "H5Screate");
+
+    /* Create the datatypes */
+    str_tid = H5Tcopy(H5T_C_S1);
+    CHECK(str_tid, FAIL, "H5Tcopy");
+    ret = H5Tset_size(str_tid, H5T_VARIABLE);
+    CHECK(ret, FAIL, "H5Tset_size");
+    vlen_tid = H5Tvlen_create(H5T_NATIVE_INT);
+    CHECK(vlen_tid, FAIL, "H5Tvlen_create");
+    cmpd_tid = H5Tcreate(H5T_COMPOUND, sizeof(cmpd_vlen_t));
+    CHECK(cmpd_tid, FAIL, "H5Tcreate");
+    ret = H5Tinsert(cmpd_tid, "i", HOFFSET(cmpd_vlen_t, i), H5T_NATIVE_INT);
+    CHECK(ret, FAIL, "H5Tinsert");
+    ret = H5Tinsert(cmpd_tid, "v", HOFFSET(cmpd_vlen_t, v), vlen_tid);
+    CHECK(ret, FAIL, "H5Tinsert");
+
+    /* Create file */
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    /* Create dataset */
+    dset = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_UCHAR, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dset, FAIL, "H5Dcreate2");
+
+    /* Create the attributes */
+    attr = H5Acreate2(dset, "string", str_tid, sid, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(attr, FAIL, "H5Acreate2");
+    ret = H5Awrite(attr, str_tid, &wstr);
+    CHECK(ret, FAIL, "H5Awrite");
+    ret = H5Aclose(attr);
+    CHECK(ret, FAIL, "H5Aclose");
+
+    wcmpd.i = 7;
+    wcmpd.v.len = 3;
+    wcmpd.v.p = wints;
+    attr = H5Acreate2(dset, "compound", cmpd_tid, sid, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(attr, FAIL, "H5Acreate2");
+    ret = H5Awrite(attr, cmpd_tid, &wcmpd);
+    CHECK(ret, FAIL, "H5Awrite");
+    ret = H5Aclose(attr);
+    CHECK(ret, FAIL, "H5Aclose");
+
+    attr = H5Acreate2(dset, "number", H5T_NATIVE_UINT, sid, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(attr, FAIL, "H5Acreate2");
+    ret = H5Awrite(attr, H5T_NATIVE_UINT, &wval);
+    CHECK(ret, FAIL, "H5Awrite");
+    ret = H5Aclose(attr);
+    CHECK(ret, FAIL, "H5Aclose");
+
+    /* Close and reopen the file, so the attributes are read from disk */
+    ret = H5Dclose(dset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    fid = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl);
+    CHECK(fid, FAIL, "H5Fopen");
+
+    /* Read all the attributes at once */
+    names[0] = "string";
+    types[0] = str_tid;
+    bufs[0] = &rstr;
+    names[1] = "compound";
+    types[1] = cmpd_tid;
+    HDmemset(&rcmpd, 0, sizeof(rcmpd));
+    bufs[1] = &rcmpd;
+    names[2] = "number";
+    types[2] = H5T_NATIVE_UINT;
+    bufs[2] = &rval;
+    ret = H5Aread_multi(fid, DSET1_NAME, (size_t)3, names, types, bufs, H5P_DEFAULT);
+    CHECK(ret, FAIL, "H5Aread_multi");
+
+    /* Check the data read */
+    if(NULL == rstr || HDstrcmp(rstr, wstr))
+        TestErrPrintf("%d: string attribute read incorrectly\n", __LINE__);
+    VERIFY(rcmpd.i, wcmpd.i, "H5Aread_multi");
+    VERIFY(rcmpd.v.len, wcmpd.v.len, "H5Aread_multi");
+    if(NULL == rcmpd.v.p || HDmemcmp(rcmpd.v.p, wints, sizeof(wints)))
+        TestErrPrintf("%d: compound attribute read incorrectly\n", __LINE__);
+    VERIFY(rval, wval, "H5Aread_multi");
+
+    /* Release the variable-length data */
+    ret = H5Dvlen_reclaim(str_tid, sid, H5P_DEFAULT, &rstr);
+    CHECK(ret, FAIL, "H5Dvlen_reclaim");
+    ret = H5Dvlen_reclaim(cmpd_tid, sid, H5P_DEFAULT, &rcmpd);
+    CHECK(ret, FAIL, "H5Dvlen_reclaim");
+
+    /* Close file */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Close datatypes */
+    ret = H5Tclose(cmpd_tid);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Tclose(vlen_tid);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Tclose(str_tid);
+    CHECK(ret, FAIL, "H5Tclose");
+
+    /* Close dataspace */
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+}   /* test_attr_read_multi_vlen() */
+
 /****************************************************************
 **
 **  test_attr_shared_write(): Test basic H5A (attribute) code.
@@ -10688,6 +11035,8 @@ test_attr(void)
                 test_attr_open_by_idx(new_format, my_fcpl, my_fapl);    /* Test opening attributes by index */
                 test_attr_open_by_name(new_format, my_fcpl, my_fapl);   /* Test opening attributes by name */
                 test_attr_create_by_name(new_format, my_fcpl, my_fapl); /* Test creating attributes by name */
+                test_attr_read_multi(new_format, my_fcpl, my_fapl);     /* Test reading many attributes at once */
+                test_attr_read_multi_vlen(my_fcpl, my_fapl);    /* Test reading many variable-length attributes at once */
 
                 /* More complex tests with both "new format" and "shared" attributes */
                 if(use_shared == TRUE) {
@@ -10722,6 +11071,8 @@ test_attr(void)
             test_attr_open_by_idx(new_format, fcpl, my_fapl);   /* Test opening attributes by index */
             test_attr_open_by_name(new_format, fcpl, my_fapl);  /* Test opening attributes by name */
             test_attr_create_by_name(new_format, fcpl, my_fapl); /* Test creating attributes by name */
+            test_attr_read_multi(new_format, fcpl, my_fapl);    /* Test reading many attributes at once */
+            test_attr_read_multi_vlen(fcpl, my_fapl);   /* Test reading many variable-length attributes at once */
 
             /* Tests that address specific bugs */
             test_attr_bug1(fcpl, my_fapl);                      /* Test odd allocation operations */
@@ -213,6 +213,86 @@ test_chksum_large(void)
     VERIFY(chksum, 0x930c7afc, "H5_checksum_lookup3");
 } /* test_chksum_large() */
 
+
+/****************************************************************
+**
+**  chksum_fletcher32_ref(): Reference (bytewise) fletcher32
+**      checksum, to compare the library's vectorized versions with.
+**
+****************************************************************/
+static uint32_t
+chksum_fletcher32_ref(const uint8_t *data, size_t _len)
+{
+    size_t len = _len / 2;
+    uint32_t sum1 = 0, sum2 = 0;
+
+    while(len) {
+        size_t tlen = len > 360 ? 360 : len;
+
+        len -= tlen;
+        do {
+            sum1 += (uint32_t)(((uint16_t)data[0]) << 8) | ((uint16_t)data[1]);
+            data += 2;
+            sum2 += sum1;
+        } while(--tlen);
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    } /* end while */
+    if(_len % 2) {
+        sum1 += (uint32_t)(((uint16_t)*data) << 8);
+        sum2 += sum1;
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    } /* end if */
+    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+
+    return((sum2 << 16) | sum1);
+} /* chksum_fletcher32_ref() */
+
+
+/****************************************************************
+**
+**  test_chksum_lengths(): Checksum buffers of every length up to
+**      BUF_LEN, at several alignments
+**
+****************************************************************/
+static void
+test_chksum_lengths(void)
+{
+    uint8_t *copy_buf;          /* Aligned copy of the data */
+    uint32_t chksum;            /* Checksum value */
+    size_t len, off;            /* Buffer length & offset */
+    size_t u;                   /* Local index variable */
+    int fill;                   /* Data pattern */
+    int nerrors = 0;            /* Number of mismatches */
+
+    copy_buf = (uint8_t *)HDmalloc(BUF_LEN);
+    CHECK(copy_buf, NULL, "HDmalloc");
+
+    for(fill = 0; fill < 3; fill++) {
+        /* Initialize buffer w/known data: a ramp, all ones, and a single
+         * 0xffff word (whose sums are multiples of 65535) */
+        for(u = 0; u < BUF_LEN; u++)
+            large_buf[u] = (uint8_t)(fill == 0 ? u * 7 : (fill == 1 ? 0xff : 0));
+        if(fill == 2)
+            large_buf[10] = large_buf[11] = 0xff;
+
+        for(len = 1; len < BUF_LEN - 4; len++)
+            for(off = 0; off < 4; off++)
+                if(H5_checksum_fletcher32(large_buf + off, len) != chksum_fletcher32_ref(large_buf + off, len))
+                    nerrors++;
+
+        /* Lookup3 gives the same value at any alignment */
+        HDmemcpy(copy_buf, large_buf + 1, BUF_LEN - 1);
+        chksum = H5_checksum_lookup3(copy_buf, BUF_LEN - 1, 0);
+        VERIFY(H5_checksum_lookup3(large_buf + 1, BUF_LEN - 1, 0), chksum, "H5_checksum_lookup3");
+    } /* end for */
+    VERIFY(nerrors, 0, "H5_checksum_fletcher32");
+
+    HDfree(copy_buf);
+} /* test_chksum_lengths() */
+
 
 /****************************************************************
 **
@@ -231,6 +311,7 @@ test_checksum(void)
     test_chksum_size_three();		/* Test buffer w/only 3 bytes */
     test_chksum_size_four();		/* Test buffer w/only 4 bytes */
     test_chksum_large();		/* Test buffer w/larger # of bytes */
+    test_chksum_lengths();		/* Test buffers of many lengths */
 
 } /* test_checksum() */
 
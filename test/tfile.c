@@ -114,6 +114,9 @@
 
 /* Declaration for test_get_obj_ids() */
 #define FILE7			"tfile7.h5"	/* Test file */
+
+/* Trace events output, for test_trace_events() */
+#define TRACE_FILE              "tfile_trace.json"
 #define NGROUPS			2
 #define NDSETS			4
 
@@ -3498,6 +3501,194 @@ test_libver_macros2(void)
 
 } /* test_libver_macros2() */
 
+/****************************************************************
+**
+**  test_file_stats():
+**	Test per-file and per-API routine statistics.
+**
+****************************************************************/
+static void
+test_file_stats(void)
+{
+    hid_t       file;           /* File ID */
+    hid_t       fapl;           /* File access property list ID */
+    hid_t       dcpl;           /* Dataset creation property list ID */
+    hid_t       sid;            /* Dataspace ID */
+    hid_t       dset;           /* Dataset ID */
+    hsize_t     dims[1] = {1024};       /* Dataset dimensions */
+    hsize_t     chunk_dims[1] = {128};  /* Chunk dimensions */
+    int         buf[1024];      /* Data buffer */
+    hbool_t     collect;        /* Whether to collect statistics */
+    H5F_stats_t stats;          /* File statistics */
+    H5_api_stats_t *api_stats;  /* API routine statistics */
+    ssize_t     napi;           /* Number of API routines */
+    hsize_t     ncreate = 0;    /* Number of H5Dcreate2 calls */
+    ssize_t     u;              /* Local index variable */
+    herr_t      ret;            /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing file and API routine statistics\n"));
+
+    for(u = 0; u < 1024; u++)
+        buf[u] = (int)u;
+
+    /* Check default setting */
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl, FAIL, "H5Pcreate");
+    ret = H5Pget_collect_stats(fapl, &collect);
+    CHECK(ret, FAIL, "H5Pget_collect_stats");
+    VERIFY(collect, FALSE, "H5Pget_collect_stats");
+
+    /* Statistics aren't available unless requested */
+    file = H5Fcreate(FILE1, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    CHECK(file, FAIL, "H5Fcreate");
+    if(NULL == HDgetenv("HDF5_STATS")) {
+        H5E_BEGIN_TRY {
+            ret = H5Fget_stats(file, &stats);
+        } H5E_END_TRY;
+        VERIFY(ret, FAIL, "H5Fget_stats");
+    } /* end if */
+    ret = H5Fclose(file);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    ret = H5Pset_collect_stats(fapl, TRUE);
+    CHECK(ret, FAIL, "H5Pset_collect_stats");
+    ret = H5Pget_collect_stats(fapl, &collect);
+    CHECK(ret, FAIL, "H5Pget_collect_stats");
+    VERIFY(collect, TRUE, "H5Pget_collect_stats");
+
+    /* Collect per-API statistics also */
+    ret = H5reset_api_stats();
+    CHECK(ret, FAIL, "H5reset_api_stats");
+    ret = H5set_api_stats(TRUE);
+    CHECK(ret, FAIL, "H5set_api_stats");
+
+    /* Write a chunked dataset */
+    file = H5Fcreate(FILE1, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    CHECK(file, FAIL, "H5Fcreate");
+    sid = H5Screate_simple(1, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, FAIL, "H5Pcreate");
+    ret = H5Pset_chunk(dcpl, 1, chunk_dims);
+    CHECK(ret, FAIL, "H5Pset_chunk");
+    dset = H5Dcreate2(file, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(dset, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Dclose(dset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(file);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Re-open the file and read the dataset twice */
+    file = H5Fopen(FILE1, H5F_ACC_RDONLY, fapl);
+    CHECK(file, FAIL, "H5Fopen");
+    dset = H5Dopen2(file, "dset", H5P_DEFAULT);
+    CHECK(dset, FAIL, "H5Dopen2");
+    ret = H5Freset_stats(file);
+    CHECK(ret, FAIL, "H5Freset_stats");
+    ret = H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+    CHECK(ret, FAIL, "H5Dread");
+    ret = H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+    CHECK(ret, FAIL, "H5Dread");
+
+    ret = H5Fget_stats(file, &stats);
+    CHECK(ret, FAIL, "H5Fget_stats");
+    /* Each chunk is read from the file once, then found in the chunk cache */
+    VERIFY(stats.vfd[H5FD_MEM_DRAW].read_bytes, sizeof(buf), "H5Fget_stats");
+    VERIFY(stats.vfd[H5FD_MEM_DRAW].write_ops, 0, "H5Fget_stats");
+    VERIFY(stats.chunk_cache.misses, (dims[0] / chunk_dims[0]), "H5Fget_stats");
+    VERIFY(stats.chunk_cache.hits, (dims[0] / chunk_dims[0]), "H5Fget_stats");
+    VERIFY(stats.filter.calls, 0, "H5Fget_stats");
+
+    ret = H5Dclose(dset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(file);
+    CHECK(ret, FAIL, "H5Fclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Pclose(fapl);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    /* Check the per-API statistics */
+    ret = H5set_api_stats(FALSE);
+    CHECK(ret, FAIL, "H5set_api_stats");
+    napi = H5get_api_stats(NULL, (size_t)0);
+    CHECK(napi, FAIL, "H5get_api_stats");
+    api_stats = (H5_api_stats_t *)HDmalloc((size_t)napi * sizeof(H5_api_stats_t));
+    CHECK(api_stats, NULL, "HDmalloc");
+    VERIFY(H5get_api_stats(api_stats, (size_t)napi), napi, "H5get_api_stats");
+    for(u = 0; u < napi; u++)
+        if(!HDstrcmp(api_stats[u].name, "H5Dcreate2"))
+            ncreate = api_stats[u].ncalls;
+    VERIFY(ncreate, 1, "H5get_api_stats");
+    HDfree(api_stats);
+} /* test_file_stats() */
+
+/****************************************************************
+**
+**  test_trace_events():
+**	Test recording trace events and writing them out.
+**
+****************************************************************/
+static void
+test_trace_events(void)
+{
+    hid_t       file;           /* File ID */
+    FILE        *fp;            /* Trace events output */
+    char        line[1024];     /* Line of output */
+    hbool_t     found_create = FALSE;   /* Found H5Fcreate events? */
+    hbool_t     found_write = FALSE;    /* Found file driver write? */
+    unsigned    nbegin = 0, nend = 0;   /* Number of begin/end events */
+    herr_t      ret;            /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing trace events\n"));
+
+    ret = H5set_trace_events(TRUE);
+    CHECK(ret, FAIL, "H5set_trace_events");
+
+    file = H5Fcreate(FILE1, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(file, FAIL, "H5Fcreate");
+    ret = H5Fclose(file);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    ret = H5set_trace_events(FALSE);
+    CHECK(ret, FAIL, "H5set_trace_events");
+    ret = H5dump_trace_events(TRACE_FILE);
+    CHECK(ret, FAIL, "H5dump_trace_events");
+
+    /* Check the output, which has one event per line */
+    fp = HDfopen(TRACE_FILE, "r");
+    CHECK(fp, NULL, "HDfopen");
+    if(NULL == HDfgets(line, (int)sizeof(line), fp))
+        TestErrPrintf("Empty trace events output\n");
+    else if(HDstrncmp(line, "{\"traceEvents\":[", (size_t)15))
+        TestErrPrintf("Bad trace events header: %s", line);
+    while(HDfgets(line, (int)sizeof(line), fp)) {
+        if(HDstrstr(line, "\"name\":\"H5Fcreate\""))
+            found_create = TRUE;
+        if(HDstrstr(line, "\"name\":\"H5FD_write\""))
+            found_write = TRUE;
+        if(HDstrstr(line, "\"ph\":\"B\""))
+            nbegin++;
+        if(HDstrstr(line, "\"ph\":\"E\""))
+            nend++;
+    } /* end while */
+    HDfclose(fp);
+    HDremove(TRACE_FILE);
+
+    VERIFY(found_create, TRUE, "H5dump_trace_events");
+    VERIFY(found_write, TRUE, "H5dump_trace_events");
+
+    /* Every begin event has its end event, including the one for the
+     *  H5set_trace_events() call that turned recording off */
+    VERIFY(nbegin, nend, "H5dump_trace_events");
+} /* test_trace_events() */
+
 /****************************************************************
 **
 **  test_deprec():
@@ -3680,6 +3871,8 @@ test_file(void)
     test_libver_bounds();       /* Test compatibility for file space management */
     test_libver_macros();       /* Test the macros for library version comparison */
     test_libver_macros2();      /* Test the macros for library version comparison */
+    test_file_stats();          /* Test file and API routine statistics */
+    test_trace_events();        /* Test recording trace events */
 #ifndef H5_NO_DEPRECATED_SYMBOLS
     test_deprec();              /* Test deprecated routines */
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
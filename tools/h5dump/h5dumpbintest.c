@@ -0,0 +1,191 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Tests render_bin_output(), which writes the data blocks of h5dump's
+ * binary (-b) output.
+ */
+
+#include "H5private.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+#define NELMTS_BLK  6
+
+/* Name of tool */
+#define PROGRAMNAME "h5dumpbintest"
+
+/* A packed compound, which is written as its memory image */
+typedef struct {
+    int     i;
+    char    c;
+} cmpd_t;
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_block_write
+ *
+ * Purpose: Write blocks of integers and of a packed compound, and check
+ *          the bytes that were written.
+ *
+ * Return: 0 on success, 1 on failure
+ *-------------------------------------------------------------------------
+ */
+static int
+test_block_write(void)
+{
+    FILE    *stream = NULL;
+    hid_t   cmpd_id = -1;
+    int     buf[NELMTS_BLK], check[NELMTS_BLK];
+    unsigned char cbuf[NELMTS_BLK * (sizeof(int) + 1)];
+    unsigned char ccheck[NELMTS_BLK * (sizeof(int) + 1)];
+    size_t  cmpd_size = sizeof(int) + 1;
+    size_t  u;
+
+    HDfprintf(stdout, "Testing binary output of data blocks");
+
+    for (u = 0; u < NELMTS_BLK; u++) {
+        cmpd_t  elmt;
+
+        buf[u] = (int)(u * 10);
+        elmt.i = (int)u;
+        elmt.c = (char)('a' + u);
+        HDmemcpy(cbuf + u * cmpd_size, &elmt.i, sizeof(int));
+        cbuf[u * cmpd_size + sizeof(int)] = (unsigned char)elmt.c;
+    }
+
+    if (NULL == (stream = HDtmpfile()))
+        goto error;
+
+    /* Integers */
+    if (render_bin_output(stream, -1, H5T_NATIVE_INT, buf, (hsize_t)NELMTS_BLK) < 0)
+        goto error;
+    if (HDftell(stream) != (long)sizeof(buf))
+        goto error;
+    HDrewind(stream);
+    if (NELMTS_BLK != HDfread(check, sizeof(int), (size_t)NELMTS_BLK, stream))
+        goto error;
+    if (HDmemcmp(buf, check, sizeof(buf)))
+        goto error;
+
+    /* A packed compound */
+    if ((cmpd_id = H5Tcreate(H5T_COMPOUND, cmpd_size)) < 0)
+        goto error;
+    if (H5Tinsert(cmpd_id, "i", 0, H5T_NATIVE_INT) < 0)
+        goto error;
+    if (H5Tinsert(cmpd_id, "c", sizeof(int), H5T_NATIVE_CHAR) < 0)
+        goto error;
+    HDrewind(stream);
+    if (render_bin_output(stream, -1, cmpd_id, cbuf, (hsize_t)NELMTS_BLK) < 0)
+        goto error;
+    if (HDftell(stream) != (long)sizeof(cbuf))
+        goto error;
+    HDrewind(stream);
+    if (sizeof(ccheck) != HDfread(ccheck, 1, sizeof(ccheck), stream))
+        goto error;
+    if (HDmemcmp(cbuf, ccheck, sizeof(cbuf)))
+        goto error;
+
+    H5Tclose(cmpd_id);
+    HDfclose(stream);
+
+    HDfprintf(stdout, " PASSED\n");
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(cmpd_id);
+    } H5E_END_TRY;
+    if (stream)
+        HDfclose(stream);
+    HDfprintf(stdout, " *FAILED*\n");
+    return 1;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_block_overflow
+ *
+ * Purpose: Check that a block whose size in bytes doesn't fit in a
+ *          size_t is rejected without writing anything, in all builds.
+ *
+ * Return: 0 on success, 1 on failure
+ *-------------------------------------------------------------------------
+ */
+static int
+test_block_overflow(void)
+{
+    FILE    *stream = NULL;
+    int     buf[NELMTS_BLK];
+    hsize_t nelmts = ((hsize_t)SIZET_MAX / sizeof(int)) + 1;
+
+    HDfprintf(stdout, "Testing binary output of a block too large to write");
+
+    HDmemset(buf, 0, sizeof(buf));
+
+    if (NULL == (stream = HDtmpfile()))
+        goto error;
+
+    if (render_bin_output(stream, -1, H5T_NATIVE_INT, buf, nelmts) >= 0)
+        goto error;
+    if (HDftell(stream) != 0)
+        goto error;
+
+    /* Discard the expected error */
+    H5Eclear2(H5tools_ERR_STACK_g);
+
+    HDfclose(stream);
+
+    HDfprintf(stdout, " PASSED\n");
+    return 0;
+
+error:
+    if (stream)
+        HDfclose(stream);
+    HDfprintf(stdout, " *FAILED*\n");
+    return 1;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function: main
+ *
+ * Purpose: Run the tests
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ *-------------------------------------------------------------------------
+ */
+int
+main(void)
+{
+    int nerrors = 0;
+
+    h5tools_setprogname(PROGRAMNAME);
+    h5tools_setstatus(EXIT_SUCCESS);
+
+    /* Initialize h5tools lib */
+    h5tools_init();
+
+    nerrors += test_block_write();
+    nerrors += test_block_overflow();
+
+    h5tools_close();
+
+    if (nerrors) {
+        HDfprintf(stderr, "%d binary output test(s) failed\n", nerrors);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -21,6 +21,8 @@
       h5stat_filters-dT.ddl
       h5stat_filters-UD.ddl
       h5stat_filters-UT.ddl
+      h5stat_filters-w.ddl
+      h5stat_threshold-w.ddl
       h5stat_tsohm.ddl
       h5stat_newgrat.ddl
       h5stat_newgrat-UG.ddl
@@ -143,6 +145,10 @@
           h5stat_filters-UD.out.err
           h5stat_filters-UT.out
           h5stat_filters-UT.out.err
+          h5stat_filters-w.out
+          h5stat_filters-w.out.err
+          h5stat_threshold-w.out
+          h5stat_threshold-w.out.err
           h5stat_tsohm.out
           h5stat_tsohm.out.err
           h5stat_newgrat.out
@@ -206,6 +212,10 @@
   ADD_H5_TEST (h5stat_filters-dT 0 -dT h5stat_filters.h5)
   ADD_H5_TEST (h5stat_filters-UD 0 -D h5stat_filters.h5)
   ADD_H5_TEST (h5stat_filters-UT 0 -T h5stat_filters.h5)
+# Statistics gathered by worker processes, which must match a serial run
+# of the same options.  A worker that fails is reported on stderr.
+  ADD_H5_TEST (h5stat_filters-w 0 -w 4 -dT -m 3 h5stat_filters.h5)
+  ADD_H5_TEST (h5stat_threshold-w 0 -w 5 -dT -m 3 h5stat_threshold.h5)
 # h5stat_tsohm.h5 is a copy of ../../../test/tsohm.h5 generated by tsohm.c 
 # as of release 1.8.0-alpha4
   ADD_H5_TEST (h5stat_tsohm 0 h5stat_tsohm.h5)
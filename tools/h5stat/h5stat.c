@@ -53,8 +53,16 @@ typedef struct dtype_info_t {
     hid_t tid;                          /* ID of datatype */
     unsigned long count;                /* Number of types found */
     unsigned long named;                /* Number of types that are named */
+    unsigned long first;                /* Traversal order of first dataset with this type */
 } dtype_info_t;
 
+/* Dataset whose statistics are gathered by a worker process */
+typedef struct dset_work_t {
+    char *path;                         /* Path of dataset */
+    H5O_info_t oi;                      /* Object info for dataset */
+    unsigned long order;                /* Traversal order of dataset */
+} dset_work_t;
+
 typedef struct ohdr_info_t {
     hsize_t total_size;                 /* Total size of object headers */
     hsize_t free_size;                  /* Total free space in object headers */
@@ -117,6 +125,9 @@ typedef struct iter_t {
     hsize_t datasets_heap_storage_size; /* heap size for dataset with external storage */
     unsigned long nexternal;            /* Number of external files for a dataset */
     int           local;                /* Flag to indicate iteration over the object*/
+    size_t ndset_work;                  /* Number of datasets deferred to worker processes */
+    size_t dset_work_alloc;             /* Number of entries allocated for deferred datasets */
+    dset_work_t *dset_work;             /* Pointer to array of deferred datasets */
 } iter_t;
 
 
@@ -142,13 +153,18 @@ static int	  sgroups_threshold = DEF_SIZE_SMALL_GROUPS;
 static int	  sdsets_threshold = DEF_SIZE_SMALL_DSETS;
 static int	  sattrs_threshold = DEF_SIZE_SMALL_ATTRS;
 
+/* Number of worker processes for gathering dataset statistics */
+static int        nworkers = 1;
+
+static void iter_free(iter_t *iter);
+
 /* a structure for handling the order command-line parameters come in */
 struct handler_t {
     size_t obj_count;
     char **obj;
 };
 
-static const char *s_opts ="Aa:Ddm:FfhGgl:sSTO:V";
+static const char *s_opts ="Aa:Ddm:FfhGgl:sSTO:Vw:";
 /* e.g. "filemetadata" has to precede "file"; "groupmetadata" has to precede "group" etc. */
 static struct long_options l_opts[] = {
     {"help", no_arg, 'h'},
@@ -212,6 +228,12 @@ static struct long_options l_opts[] = {
     { "obje", require_arg, 'O' },
     { "obj", require_arg, 'O' },
     { "ob", require_arg, 'O' },
+    { "workers", require_arg, 'w' },
+    { "worker", require_arg, 'w' },
+    { "worke", require_arg, 'w' },
+    { "work", require_arg, 'w' },
+    { "wor", require_arg, 'w' },
+    { "wo", require_arg, 'w' },
     { "version", no_arg, 'V' },
     { "versio", no_arg, 'V' },
     { "versi", no_arg, 'V' },
@@ -295,6 +317,9 @@ static void usage(const char *prog)
      HDfprintf(stdout, "                           than 0.  The default threshold is 10.\n");
      HDfprintf(stdout, "     -s, --freespace       Print free space information\n");
      HDfprintf(stdout, "     -S, --summary         Print summary of file space information\n");
+     HDfprintf(stdout, "     -w N, --workers=N     Gather dataset information with N worker processes.\n");
+     HDfprintf(stdout, "                           Each worker opens the file itself and reads its share\n");
+     HDfprintf(stdout, "                           of the datasets in file address order.  The default is 1.\n");
 }
 
 
@@ -472,7 +497,7 @@ group_stats(iter_t *iter, const char *name, const H5O_info_t *oi)
  *-------------------------------------------------------------------------
  */
 static herr_t
-dataset_stats(iter_t *iter, const char *name, const H5O_info_t *oi)
+dataset_stats(iter_t *iter, const char *name, const H5O_info_t *oi, unsigned long order)
 {
     unsigned     bin;               /* "bin" the number of objects falls in */
     hid_t     did;               /* Dataset ID */
@@ -610,6 +635,7 @@ dataset_stats(iter_t *iter, const char *name, const H5O_info_t *oi)
         HDassert(iter->dset_type_info[curr_ntype].tid > 0);
         iter->dset_type_info[curr_ntype].count = 1;
         iter->dset_type_info[curr_ntype].named = 0;
+        iter->dset_type_info[curr_ntype].first = order;
 
         /* Set index for later */
         u = curr_ntype;
@@ -679,6 +705,608 @@ datatype_stats(iter_t *iter, const H5O_info_t *oi)
 }  /* end datatype_stats() */
 
 
+/*-------------------------------------------------------------------------
+ * Function: defer_dataset_stats
+ *
+ * Purpose: Queue a dataset whose statistics are gathered later by the
+ *          worker processes
+ *
+ * Return:  Success: 0
+ *
+ *          Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+defer_dataset_stats(iter_t *iter, const char *name, const H5O_info_t *oi)
+{
+    dset_work_t *work;          /* Deferred dataset */
+
+    if(iter->ndset_work == iter->dset_work_alloc) {
+        size_t new_alloc = MAX(64, 2 * iter->dset_work_alloc);
+
+        if(NULL == (work = (dset_work_t *)HDrealloc(iter->dset_work, new_alloc * sizeof(dset_work_t)))) {
+            error_msg("unable to allocate memory for deferred datasets\n");
+            h5tools_setstatus(EXIT_FAILURE);
+            return FAIL;
+        } /* end if */
+        iter->dset_work = work;
+        iter->dset_work_alloc = new_alloc;
+    } /* end if */
+
+    work = &iter->dset_work[iter->ndset_work];
+    if(NULL == (work->path = HDstrdup(name))) {
+        error_msg("unable to allocate memory for dataset name\n");
+        h5tools_setstatus(EXIT_FAILURE);
+        return FAIL;
+    } /* end if */
+    work->oi = *oi;
+
+    /* The traversal order keeps the datatype listing identical to a serial run */
+    work->order = iter->uniq_dsets + (unsigned long)iter->ndset_work;
+    iter->ndset_work++;
+
+    return 0;
+} /* end defer_dataset_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: dset_work_cmp
+ *
+ * Purpose: Sort deferred datasets by the address of their object header
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+dset_work_cmp(const void *_a, const void *_b)
+{
+    const dset_work_t *a = (const dset_work_t *)_a;
+    const dset_work_t *b = (const dset_work_t *)_b;
+
+    if(a->oi.addr < b->oi.addr)
+        return -1;
+    else if(a->oi.addr > b->oi.addr)
+        return 1;
+    return 0;
+} /* end dset_work_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: dtype_info_cmp
+ *
+ * Purpose: Sort dataset datatypes by the traversal order of the first
+ *          dataset using them
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+dtype_info_cmp(const void *_a, const void *_b)
+{
+    const dtype_info_t *a = (const dtype_info_t *)_a;
+    const dtype_info_t *b = (const dtype_info_t *)_b;
+
+    if(a->first < b->first)
+        return -1;
+    else if(a->first > b->first)
+        return 1;
+    return 0;
+} /* end dtype_info_cmp() */
+
+#ifdef H5_HAVE_FORK
+
+/*-------------------------------------------------------------------------
+ * Function: pipe_write
+ *
+ * Purpose: Write a buffer to a pipe, retrying short writes
+ *
+ * Return:  Success: 0
+ *
+ *          Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+pipe_write(int fd, const void *buf, size_t size)
+{
+    const char *p = (const char *)buf;
+
+    while(size > 0) {
+        ssize_t nbytes = HDwrite(fd, p, size);
+
+        if(nbytes < 0) {
+            if(EINTR == errno)
+                continue;
+            return -1;
+        } /* end if */
+        p += nbytes;
+        size -= (size_t)nbytes;
+    } /* end while */
+
+    return 0;
+} /* end pipe_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: pipe_read
+ *
+ * Purpose: Read a buffer from a pipe, retrying short reads
+ *
+ * Return:  Success: 0
+ *
+ *          Failure: -1 (including end of file before SIZE bytes)
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+pipe_read(int fd, void *buf, size_t size)
+{
+    char *p = (char *)buf;
+
+    while(size > 0) {
+        ssize_t nbytes = HDread(fd, p, size);
+
+        if(nbytes < 0) {
+            if(EINTR == errno)
+                continue;
+            return -1;
+        } /* end if */
+        if(nbytes == 0)
+            return -1;
+        p += nbytes;
+        size -= (size_t)nbytes;
+    } /* end while */
+
+    return 0;
+} /* end pipe_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: worker_send
+ *
+ * Purpose: Send the dataset statistics gathered by a worker to the parent
+ *
+ * Return:  Success: 0
+ *
+ *          Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+worker_send(int fd, const iter_t *wi)
+{
+    unsigned long u;
+
+    if(pipe_write(fd, wi, sizeof(iter_t)) < 0)
+        return -1;
+    if(pipe_write(fd, wi->num_small_attrs, (size_t)(sattrs_threshold + 1) * sizeof(unsigned long)) < 0)
+        return -1;
+    if(pipe_write(fd, wi->small_dset_dims, (size_t)sdsets_threshold * sizeof(unsigned long)) < 0)
+        return -1;
+    if(wi->attr_nbins && pipe_write(fd, wi->attr_bins, wi->attr_nbins * sizeof(unsigned long)) < 0)
+        return -1;
+    if(wi->dset_dim_nbins && pipe_write(fd, wi->dset_dim_bins, wi->dset_dim_nbins * sizeof(unsigned long)) < 0)
+        return -1;
+
+    /* Datatypes are sent in their encoded form */
+    for(u = 0; u < wi->dset_ntypes; u++) {
+        size_t enc_size = 0;
+        void *enc;
+        int ret;
+
+        if(H5Tencode(wi->dset_type_info[u].tid, NULL, &enc_size) < 0)
+            return -1;
+        if(NULL == (enc = HDmalloc(enc_size)))
+            return -1;
+        if(H5Tencode(wi->dset_type_info[u].tid, enc, &enc_size) < 0) {
+            HDfree(enc);
+            return -1;
+        } /* end if */
+        ret = pipe_write(fd, &wi->dset_type_info[u], sizeof(dtype_info_t));
+        if(ret >= 0)
+            ret = pipe_write(fd, &enc_size, sizeof(size_t));
+        if(ret >= 0)
+            ret = pipe_write(fd, enc, enc_size);
+        HDfree(enc);
+        if(ret < 0)
+            return -1;
+    } /* end for */
+
+    return 0;
+} /* end worker_send() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: worker_iter_free
+ *
+ * Purpose: Release the statistics received from a worker
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+worker_iter_free(iter_t *wi)
+{
+    unsigned long u;
+
+    for(u = 0; u < wi->dset_ntypes; u++)
+        H5Tclose(wi->dset_type_info[u].tid);
+    wi->dset_ntypes = 0;
+    iter_free(wi);
+} /* end worker_iter_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: worker_recv
+ *
+ * Purpose: Receive the dataset statistics gathered by a worker
+ *
+ * Return:  Success: 0
+ *
+ *          Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+worker_recv(int fd, iter_t *wi)
+{
+    unsigned long ntypes;
+    unsigned long u;
+
+    if(pipe_read(fd, wi, sizeof(iter_t)) < 0) {
+        HDmemset(wi, 0, sizeof(iter_t));
+        return -1;
+    } /* end if */
+
+    /* Pointers are only meaningful in the worker's address space */
+    ntypes = wi->dset_ntypes;
+    wi->num_small_groups = NULL;
+    wi->group_bins = NULL;
+    wi->sect_bins = NULL;
+    wi->dset_work = NULL;
+    wi->dset_ntypes = 0;
+    wi->num_small_attrs = (unsigned long *)HDcalloc((size_t)(sattrs_threshold + 1), sizeof(unsigned long));
+    wi->small_dset_dims = (unsigned long *)HDcalloc((size_t)sdsets_threshold, sizeof(unsigned long));
+    wi->attr_bins = wi->attr_nbins ? (unsigned long *)HDcalloc((size_t)wi->attr_nbins, sizeof(unsigned long)) : NULL;
+    wi->dset_dim_bins = wi->dset_dim_nbins ? (unsigned long *)HDcalloc((size_t)wi->dset_dim_nbins, sizeof(unsigned long)) : NULL;
+    wi->dset_type_info = ntypes ? (dtype_info_t *)HDcalloc((size_t)ntypes, sizeof(dtype_info_t)) : NULL;
+    if(NULL == wi->num_small_attrs || NULL == wi->small_dset_dims
+            || (wi->attr_nbins && NULL == wi->attr_bins)
+            || (wi->dset_dim_nbins && NULL == wi->dset_dim_bins)
+            || (ntypes && NULL == wi->dset_type_info))
+        goto error;
+
+    if(pipe_read(fd, wi->num_small_attrs, (size_t)(sattrs_threshold + 1) * sizeof(unsigned long)) < 0)
+        goto error;
+    if(pipe_read(fd, wi->small_dset_dims, (size_t)sdsets_threshold * sizeof(unsigned long)) < 0)
+        goto error;
+    if(wi->attr_nbins && pipe_read(fd, wi->attr_bins, wi->attr_nbins * sizeof(unsigned long)) < 0)
+        goto error;
+    if(wi->dset_dim_nbins && pipe_read(fd, wi->dset_dim_bins, wi->dset_dim_nbins * sizeof(unsigned long)) < 0)
+        goto error;
+
+    for(u = 0; u < ntypes; u++) {
+        dtype_info_t info;
+        size_t enc_size;
+        void *enc;
+
+        if(pipe_read(fd, &info, sizeof(dtype_info_t)) < 0)
+            goto error;
+        if(pipe_read(fd, &enc_size, sizeof(size_t)) < 0)
+            goto error;
+        if(NULL == (enc = HDmalloc(enc_size)))
+            goto error;
+        if(pipe_read(fd, enc, enc_size) < 0) {
+            HDfree(enc);
+            goto error;
+        } /* end if */
+        info.tid = H5Tdecode(enc);
+        HDfree(enc);
+        if(info.tid < 0)
+            goto error;
+        wi->dset_type_info[wi->dset_ntypes++] = info;
+    } /* end for */
+
+    return 0;
+
+error:
+    worker_iter_free(wi);
+    return -1;
+} /* end worker_recv() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: merge_bins
+ *
+ * Purpose: Add the counts in one array of bins to another
+ *
+ * Return:  Success: 0
+ *
+ *          Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+merge_bins(unsigned long **bins, unsigned *nbins, const unsigned long *src, unsigned src_nbins)
+{
+    unsigned u;
+
+    if(src_nbins > *nbins) {
+        unsigned long *new_bins;
+
+        if(NULL == (new_bins = (unsigned long *)HDrealloc(*bins, src_nbins * sizeof(unsigned long)))) {
+            error_msg("unable to allocate memory for bins\n");
+            return -1;
+        } /* end if */
+        *bins = new_bins;
+        while(*nbins < src_nbins)
+            (*bins)[(*nbins)++] = 0;
+    } /* end if */
+    for(u = 0; u < src_nbins; u++)
+        (*bins)[u] += src[u];
+
+    return 0;
+} /* end merge_bins() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: merge_dataset_stats
+ *
+ * Purpose: Merge the dataset statistics gathered by a worker into the
+ *          statistics for the file.  The worker's datatypes are moved into
+ *          ITER or closed, even on failure.
+ *
+ * Return:  Success: 0
+ *
+ *          Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+merge_dataset_stats(iter_t *iter, iter_t *wi)
+{
+    unsigned long u, v;
+    int i;
+
+    iter->uniq_dsets += wi->uniq_dsets;
+    iter->dset_ohdr_info.total_size += wi->dset_ohdr_info.total_size;
+    iter->dset_ohdr_info.free_size += wi->dset_ohdr_info.free_size;
+    iter->datasets_index_storage_size += wi->datasets_index_storage_size;
+    iter->datasets_heap_storage_size += wi->datasets_heap_storage_size;
+    iter->dset_storage_size += wi->dset_storage_size;
+    iter->dset_external_storage_size += wi->dset_external_storage_size;
+    iter->nexternal += wi->nexternal;
+
+    /* Attribute statistics */
+    iter->attrs_btree_storage_size += wi->attrs_btree_storage_size;
+    iter->attrs_heap_storage_size += wi->attrs_heap_storage_size;
+    for(i = 0; i <= sattrs_threshold; i++)
+        iter->num_small_attrs[i] += wi->num_small_attrs[i];
+    if(wi->max_attrs > iter->max_attrs)
+        iter->max_attrs = wi->max_attrs;
+    if(merge_bins(&iter->attr_bins, &iter->attr_nbins, wi->attr_bins, wi->attr_nbins) < 0)
+        return -1;
+
+    /* Layout, dataspace and filter statistics */
+    for(u = 0; u < H5D_NLAYOUTS; u++)
+        iter->dset_layouts[u] += wi->dset_layouts[u];
+    if(wi->max_dset_rank > iter->max_dset_rank)
+        iter->max_dset_rank = wi->max_dset_rank;
+    for(u = 0; u < H5S_MAX_RANK; u++)
+        iter->dset_rank_count[u] += wi->dset_rank_count[u];
+    if(wi->max_dset_dims > iter->max_dset_dims)
+        iter->max_dset_dims = wi->max_dset_dims;
+    for(i = 0; i < sdsets_threshold; i++)
+        iter->small_dset_dims[i] += wi->small_dset_dims[i];
+    if(merge_bins(&iter->dset_dim_bins, &iter->dset_dim_nbins, wi->dset_dim_bins, wi->dset_dim_nbins) < 0)
+        return -1;
+    for(u = 0; u < H5_NFILTERS_IMPL; u++)
+        iter->dset_comptype[u] += wi->dset_comptype[u];
+
+    /* Datatype statistics */
+    for(u = 0; u < wi->dset_ntypes; u++) {
+        dtype_info_t *info = &wi->dset_type_info[u];
+
+        for(v = 0; v < iter->dset_ntypes; v++)
+            if(H5Tequal(iter->dset_type_info[v].tid, info->tid) > 0)
+                break;
+        if(v < iter->dset_ntypes) {
+            iter->dset_type_info[v].count += info->count;
+            iter->dset_type_info[v].named += info->named;
+            if(info->first < iter->dset_type_info[v].first)
+                iter->dset_type_info[v].first = info->first;
+            H5Tclose(info->tid);
+        } /* end if */
+        else {
+            dtype_info_t *new_info;
+
+            if(NULL == (new_info = (dtype_info_t *)HDrealloc(iter->dset_type_info, (iter->dset_ntypes + 1) * sizeof(dtype_info_t)))) {
+                error_msg("unable to allocate memory for datatype information\n");
+
+                /* Close the datatypes that weren't moved */
+                for(; u < wi->dset_ntypes; u++)
+                    H5Tclose(wi->dset_type_info[u].tid);
+                wi->dset_ntypes = 0;
+                return -1;
+            } /* end if */
+            iter->dset_type_info = new_info;
+            iter->dset_type_info[iter->dset_ntypes++] = *info;
+        } /* end else */
+    } /* end for */
+    wi->dset_ntypes = 0;
+
+    return 0;
+} /* end merge_dataset_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: dataset_worker
+ *
+ * Purpose: Gather statistics about a range of datasets in a worker
+ *          process and send them to the parent through FD.  Never returns.
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+dataset_worker(int fd, const char *fname, const dset_work_t *work, size_t nwork)
+{
+    iter_t wi;
+    int status = EXIT_FAILURE;
+    size_t u;
+
+    HDmemset(&wi, 0, sizeof(wi));
+    wi.num_small_attrs = (unsigned long *)HDcalloc((size_t)(sattrs_threshold + 1), sizeof(unsigned long));
+    wi.small_dset_dims = (unsigned long *)HDcalloc((size_t)sdsets_threshold, sizeof(unsigned long));
+
+    /* Use a file handle of our own, so reads don't share the parent's file offset */
+    if(wi.num_small_attrs && wi.small_dset_dims
+            && (wi.fid = H5Fopen(fname, H5F_ACC_RDONLY, H5P_DEFAULT)) >= 0) {
+        for(u = 0; u < nwork; u++)
+            dataset_stats(&wi, work[u].path, &work[u].oi, work[u].order);
+        if(worker_send(fd, &wi) >= 0)
+            status = EXIT_SUCCESS;
+    } /* end if */
+
+    /* Skip exit handlers, which would flush the parent's buffered output again */
+    HD_exit(status);
+} /* end dataset_worker() */
+#endif /* H5_HAVE_FORK */
+
+
+/*-------------------------------------------------------------------------
+ * Function: gather_dataset_stats
+ *
+ * Purpose: Gather statistics about the datasets deferred during the
+ *          traversal.  The datasets are sorted by object header address
+ *          and split into contiguous ranges, one per worker process, so
+ *          each worker reads its own region of the file.  Ranges whose
+ *          worker could not be started or failed are gathered serially,
+ *          with a warning.
+ *
+ * Return:  Success: 0
+ *
+ *          Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+gather_dataset_stats(const char *fname, iter_t *iter)
+{
+    size_t nwork = iter->ndset_work;
+    int ret_value = 0;
+    size_t u;
+
+    if(0 == nwork)
+        return 0;
+
+    HDqsort(iter->dset_work, nwork, sizeof(dset_work_t), dset_work_cmp);
+
+#ifdef H5_HAVE_FORK
+    {
+        size_t nproc = MIN((size_t)nworkers, nwork);
+        pid_t *pids;
+        int *fds;
+        size_t w;
+
+        pids = (pid_t *)HDmalloc(nproc * sizeof(pid_t));
+        fds = (int *)HDmalloc(nproc * sizeof(int));
+        if(pids && fds) {
+            /* Don't let the workers inherit unflushed output */
+            HDfflush(stdout);
+            HDfflush(stderr);
+
+            for(w = 0; w < nproc; w++) {
+                size_t start = w * nwork / nproc;
+                size_t end = (w + 1) * nwork / nproc;
+                int pfd[2];
+
+                pids[w] = -1;
+                fds[w] = -1;
+                if(HDpipe(pfd) < 0)
+                    continue;
+                if((pids[w] = HDfork()) < 0) {
+                    HDclose(pfd[0]);
+                    HDclose(pfd[1]);
+                    continue;
+                } /* end if */
+                if(0 == pids[w]) {
+                    size_t v;
+
+                    HDclose(pfd[0]);
+                    for(v = 0; v < w; v++)
+                        if(fds[v] >= 0)
+                            HDclose(fds[v]);
+                    H5Fclose(iter->fid);
+                    dataset_worker(pfd[1], fname, &iter->dset_work[start], end - start);
+                } /* end if */
+                HDclose(pfd[1]);
+                fds[w] = pfd[0];
+            } /* end for */
+
+            for(w = 0; w < nproc; w++) {
+                size_t start = w * nwork / nproc;
+                size_t end = (w + 1) * nwork / nproc;
+                hbool_t merged = FALSE;
+
+                if(fds[w] >= 0) {
+                    iter_t wi;
+
+                    if(worker_recv(fds[w], &wi) >= 0) {
+                        if(merge_dataset_stats(iter, &wi) < 0)
+                            ret_value = -1;
+                        worker_iter_free(&wi);
+                        merged = TRUE;
+                    } /* end if */
+                    HDclose(fds[w]);
+                } /* end if */
+                if(pids[w] > 0) {
+                    int status;
+
+                    while(HDwaitpid(pids[w], &status, 0) < 0 && EINTR == errno)
+                        ;
+                } /* end if */
+
+                /* Gather this range here if its worker failed */
+                if(!merged && ret_value >= 0) {
+                    warn_msg("worker process %lu failed, gathering its datasets serially\n", (unsigned long)w);
+                    for(u = start; u < end; u++)
+                        dataset_stats(iter, iter->dset_work[u].path, &iter->dset_work[u].oi, iter->dset_work[u].order);
+                } /* end if */
+                for(u = start; u < end; u++) {
+                    HDfree(iter->dset_work[u].path);
+                    iter->dset_work[u].path = NULL;
+                } /* end for */
+            } /* end for */
+        } /* end if */
+
+        if(pids)
+            HDfree(pids);
+        if(fds)
+            HDfree(fds);
+    }
+#endif /* H5_HAVE_FORK */
+
+    /* Gather any datasets not handled by a worker */
+    for(u = 0; u < nwork; u++)
+        if(iter->dset_work[u].path) {
+            if(ret_value >= 0)
+                dataset_stats(iter, iter->dset_work[u].path, &iter->dset_work[u].oi, iter->dset_work[u].order);
+            HDfree(iter->dset_work[u].path);
+            iter->dset_work[u].path = NULL;
+        } /* end if */
+    iter->ndset_work = 0;
+
+    if(ret_value < 0) {
+        h5tools_setstatus(EXIT_FAILURE);
+        return -1;
+    } /* end if */
+
+    /* List datatypes in the order a serial traversal finds them */
+    if(iter->dset_ntypes > 1)
+        HDqsort(iter->dset_type_info, (size_t)iter->dset_ntypes, sizeof(dtype_info_t), dtype_info_cmp);
+
+    return 0;
+} /* end gather_dataset_stats() */
+
+
 /*-------------------------------------------------------------------------
  * Function: obj_stats
  *
@@ -710,7 +1338,12 @@ obj_stats(const char *path, const H5O_info_t *oi, const char *already_visited,
                 break;
 
             case H5O_TYPE_DATASET:
-                dataset_stats(iter, path, oi);
+                if(nworkers > 1) {
+                    if(defer_dataset_stats(iter, path, oi) < 0)
+                        return -1;
+                } /* end if */
+                else
+                    dataset_stats(iter, path, oi, iter->uniq_dsets);
                 break;
 
             case H5O_TYPE_NAMED_DATATYPE:
@@ -980,6 +1613,17 @@ parse_command_line(int argc, const char *argv[], struct handler_t **hand_ret)
                 display_summary = TRUE;
                 break;
 
+            case 'w':
+                if(opt_arg) {
+                    nworkers = HDatoi(opt_arg);
+                    if(nworkers < 1) {
+                        error_msg("Invalid number of worker processes\n");
+                        goto error;
+                    }
+                } else
+                    error_msg("Missing number of worker processes\n");
+                break;
+
             case 'O':
                 display_all = FALSE;
                 display_object = TRUE;
@@ -1094,6 +1738,17 @@ iter_free(iter_t *iter)
         HDfree(iter->sect_bins);
         iter->sect_bins = NULL;
     } /* end if */
+
+    /* Clear array of datasets deferred to worker processes */
+    if(iter->dset_work) {
+        size_t u;
+
+        for(u = 0; u < iter->ndset_work; u++)
+            HDfree(iter->dset_work[u].path);
+        HDfree(iter->dset_work);
+        iter->dset_work = NULL;
+        iter->ndset_work = 0;
+    } /* end if */
 } /* end iter_free() */
 
 
@@ -1787,6 +2442,8 @@ main(int argc, const char *argv[])
             for(u = 0; u < hand->obj_count; u++) {
                 if(h5trav_visit(fid, hand->obj[u], TRUE, TRUE, obj_stats, lnk_stats, &iter) < 0)
                     warn_msg("Unable to traverse object \"%s\"\n", hand->obj[u]);
+                else if(gather_dataset_stats(fname, &iter) < 0)
+                    goto done;
                 else
                     print_statistics(hand->obj[u], &iter);
             } /* end for */
@@ -1794,6 +2451,8 @@ main(int argc, const char *argv[])
         else {
             if(h5trav_visit(fid, "/", TRUE, TRUE, obj_stats, lnk_stats, &iter) < 0)
                 warn_msg("Unable to traverse objects/links in file \"%s\"\n", fname);
+            else if(gather_dataset_stats(fname, &iter) < 0)
+                goto done;
             else
                 print_statistics("/", &iter);
         } /* end else */
@@ -1306,6 +1306,81 @@ init_acc_pos(h5tools_context_t *ctx, hsize_t *dims)
         ctx->pos[j] = 0;
 }
 
+/*-------------------------------------------------------------------------
+ * Function: render_bin_output_is_raw
+ *
+ * Purpose: Check whether the binary rendering of a datatype is the same as
+ *          its bytes in memory, so a block of elements can be written with
+ *          a single fwrite.  This holds for atomic types other than strings
+ *          and references, arrays of such types, and compounds whose members
+ *          are such types and are packed without gaps.
+ *
+ * Return: TRUE, FALSE
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+render_bin_output_is_raw(hid_t tid)
+{
+    hbool_t ret_value = FALSE;
+
+    switch(H5Tget_class(tid)) {
+        case H5T_INTEGER:
+        case H5T_FLOAT:
+        case H5T_ENUM:
+        case H5T_BITFIELD:
+        case H5T_OPAQUE:
+        case H5T_TIME:
+            ret_value = TRUE;
+            break;
+
+        case H5T_ARRAY:
+            {
+                hid_t memb;
+
+                if((memb = H5Tget_super(tid)) >= 0) {
+                    ret_value = render_bin_output_is_raw(memb);
+                    H5Tclose(memb);
+                }
+            }
+            break;
+
+        case H5T_COMPOUND:
+            {
+                int      snmembs;
+                unsigned j;
+                size_t   next = 0;  /* offset just past the previous member */
+
+                if((snmembs = H5Tget_nmembers(tid)) < 0)
+                    break;
+                ret_value = TRUE;
+                for(j = 0; j < (unsigned)snmembs && ret_value; j++) {
+                    hid_t memb;
+
+                    if(H5Tget_member_offset(tid, j) != next || (memb = H5Tget_member_type(tid, j)) < 0) {
+                        ret_value = FALSE;
+                        break;
+                    }
+                    ret_value = render_bin_output_is_raw(memb);
+                    next += H5Tget_size(memb);
+                    H5Tclose(memb);
+                }
+                if(next != H5Tget_size(tid))
+                    ret_value = FALSE;
+            }
+            break;
+
+        case H5T_STRING:
+        case H5T_REFERENCE:
+        case H5T_VLEN:
+        case H5T_NO_CLASS:
+        case H5T_NCLASSES:
+        default:
+            break;
+    }
+
+    return ret_value;
+}
+
 /*-------------------------------------------------------------------------
  * Function: render_bin_output
  *
@@ -1330,28 +1405,21 @@ render_bin_output(FILE *stream, hid_t container, hid_t tid, void *_mem,  hsize_t
     if((type_class = H5Tget_class(tid)) < 0)
         H5E_THROW(FAIL, H5E_tools_min_id_g, "H5Tget_class failed");
 
+    /* Write the whole block at once when its bytes are the binary form */
+    if (type_class == H5T_COMPOUND || type_class == H5T_ARRAY) {
+        if (render_bin_output_is_raw(tid))
+            type_class = H5T_INTEGER;
+    }
+
     switch (type_class) {
         case H5T_INTEGER:
         case H5T_FLOAT:
         case H5T_ENUM:
+            if (block_nelmts > (hsize_t)(SIZET_MAX / size))
+                H5E_THROW(FAIL, H5E_tools_min_id_g, "block too large to write");
             block_index = block_nelmts * size;
-            while(block_index > 0) {
-                size_t bytes_in        = 0;    /* # of bytes to write  */
-                size_t bytes_wrote     = 0;    /* # of bytes written   */
-
-                if(block_index > sizeof(size_t))
-                    bytes_in = sizeof(size_t);
-                else
-                    bytes_in = (size_t)block_index;
-
-                bytes_wrote = HDfwrite(mem, 1, bytes_in, stream);
-
-                if(bytes_wrote != bytes_in || (0 == bytes_wrote && HDferror(stream)))
-                    H5E_THROW(FAIL, H5E_tools_min_id_g, "fwrite failed");
-
-                block_index -= (hsize_t)bytes_wrote;
-                mem = mem + bytes_wrote;
-            }
+            if (block_index > 0 && (size_t)block_index != HDfwrite(mem, 1, (size_t)block_index, stream))
+                H5E_THROW(FAIL, H5E_tools_min_id_g, "fwrite failed");
             break;
         case H5T_STRING:
             {
@@ -1499,11 +1567,11 @@ render_bin_output(FILE *stream, hid_t container, hid_t tid, void *_mem,  hsize_t
             }
             break;
         default:
-            for (block_index = 0; block_index < block_nelmts; block_index++) {
-                mem = ((unsigned char*)_mem) + block_index * size;
-                if (size != HDfwrite(mem, sizeof(char), size, stream))
-                    H5E_THROW(FAIL, H5E_tools_min_id_g, "fwrite failed");
-            }
+            if (block_nelmts > (hsize_t)(SIZET_MAX / size))
+                H5E_THROW(FAIL, H5E_tools_min_id_g, "block too large to write");
+            block_index = block_nelmts * size;
+            if (block_index > 0 && (size_t)block_index != HDfwrite(mem, 1, (size_t)block_index, stream))
+                H5E_THROW(FAIL, H5E_tools_min_id_g, "fwrite failed");
             break;
     }
 
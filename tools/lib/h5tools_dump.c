@@ -1579,6 +1579,39 @@ h5tools_dump_simple_dset(FILE *stream, const h5tool_format_t *info, h5tools_cont
             sm_nbytes *= sm_size[i - 1];
             HDassert(sm_nbytes > 0);
         }
+
+        /* Binary output has no per-line formatting, so when whole rows fit in
+         * the buffer read them in blocks of complete chunk rows: each chunk is
+         * then read and decompressed once and written with a single fwrite.
+         */
+        if (bin_output && rawdatastream != NULL && ctx->ndims > 1 && sm_size[0] > 1) {
+            hid_t   dcpl;
+            hsize_t chunk_dims[H5S_MAX_RANK];
+
+            if ((dcpl = H5Dget_create_plist(dset)) >= 0) {
+                if (H5Pget_layout(dcpl) == H5D_CHUNKED &&
+                        H5Pget_chunk(dcpl, (int)ctx->ndims, chunk_dims) == (int)ctx->ndims) {
+                    hsize_t row_nbytes = sm_nbytes / sm_size[0];
+                    hsize_t nrows = sm_size[0];
+                    hbool_t whole_rows = TRUE;
+
+                    for (i = 1; i < (size_t)ctx->ndims; i++)
+                        if (sm_size[i] != total_size[i])
+                            whole_rows = FALSE;
+
+                    if (whole_rows && nrows < total_size[0]) {
+                        if (nrows >= chunk_dims[0])
+                            nrows -= nrows % chunk_dims[0];
+                        else if (chunk_dims[0] * row_nbytes <= H5TOOLS_MALLOCSIZE)
+                            nrows = chunk_dims[0];
+                        nrows = MIN(nrows, total_size[0]);
+                        sm_nbytes = nrows * row_nbytes;
+                        sm_size[0] = nrows;
+                    }
+                }
+                H5Pclose(dcpl);
+            }
+        }
     }
 
     if(!sm_nbytes)
@@ -22,6 +22,7 @@ add_test (
     COMMAND    ${CMAKE_COMMAND}
         -E remove 
         chunk.h5
+        chunk_perf.h5
         iopipe.h5
         iopipe.raw
         x-diag-rd.dat
@@ -40,6 +41,12 @@ endif (HDF5_BUILD_PERFORM_STANDALONE)
 
 add_test (NAME PERFORM_chunk COMMAND $<TARGET_FILE:chunk>)
 
+add_test (NAME PERFORM_chunk_perf_help COMMAND $<TARGET_FILE:chunk_perf> "-h")
+add_test (NAME PERFORM_chunk_perf COMMAND $<TARGET_FILE:chunk_perf>)
+
+add_test (NAME PERFORM_checksum_perf_help COMMAND $<TARGET_FILE:checksum_perf> "-h")
+add_test (NAME PERFORM_checksum_perf COMMAND $<TARGET_FILE:checksum_perf>)
+
 add_test (NAME PERFORM_iopipe COMMAND $<TARGET_FILE:iopipe>)
 
 add_test (NAME PERFORM_overhead COMMAND $<TARGET_FILE:overhead>)
@@ -0,0 +1,246 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* ===========================================================================
+ * Usage:  checksum_perf [OPTIONS]
+ *
+ * Purpose:	Checksum benchmark.  Times the library's internal checksum
+ *		routines (H5_checksum_fletcher32, used by the Fletcher32
+ *		filter, H5_checksum_metadata, used for every metadata
+ *		checksum, and H5_checksum_crc) on buffers ranging from the
+ *		size of a small metadata object to the size of a raw data
+ *		chunk, and reports the throughput of each.
+ */
+
+/* our header files */
+#include "h5test.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+#define ONE_KB              1024
+#define ONE_MB              (ONE_KB * ONE_KB)
+
+#define MICROSECOND         1000000.0F
+
+/* report 0.0 in case t is zero too */
+#define MB_PER_SEC(bytes,t) ((fabs(t)<0.0000000001F) ? 0.0F : ((((double)(bytes)) / ONE_MB) / (t)))
+
+/* Default number of bytes checksummed for each buffer size */
+#define DEF_TOTAL_SIZE      (64 * ONE_MB)
+
+/* Checksum algorithms */
+typedef enum {
+    ALGO_FLETCHER32 = 0,
+    ALGO_METADATA,
+    ALGO_CRC,
+    ALGO_NTYPES
+} algo_t;
+
+static const char *algo_names[ALGO_NTYPES] = {
+    "fletcher32",
+    "metadata",
+    "crc"
+};
+
+/* Buffer sizes timed, from metadata objects to raw data chunks */
+static const size_t buf_sizes[] = {
+    64, 512, 4 * ONE_KB, 64 * ONE_KB, ONE_MB, 16 * ONE_MB
+};
+
+#define NBUF_SIZES          (sizeof(buf_sizes) / sizeof(buf_sizes[0]))
+
+/* internal variables */
+static const char *prog = NULL;
+static size_t total_size = DEF_TOTAL_SIZE;
+static size_t max_size = 0;
+static size_t offset = 0;
+static volatile uint32_t sum_sink;
+
+/* commandline options : long and short form */
+static const char *s_opts = "hm:o:t:";
+static struct long_options l_opts[] = {
+    { "help", no_arg, 'h' },
+    { "max-size", require_arg, 'm' },
+    { "max-siz", require_arg, 'm' },
+    { "max-si", require_arg, 'm' },
+    { "max-s", require_arg, 'm' },
+    { "max", require_arg, 'm' },
+    { "ma", require_arg, 'm' },
+    { "offset", require_arg, 'o' },
+    { "offse", require_arg, 'o' },
+    { "offs", require_arg, 'o' },
+    { "off", require_arg, 'o' },
+    { "of", require_arg, 'o' },
+    { "total-size", require_arg, 't' },
+    { "total-siz", require_arg, 't' },
+    { "total-si", require_arg, 't' },
+    { "total-s", require_arg, 't' },
+    { "total", require_arg, 't' },
+    { "tota", require_arg, 't' },
+    { "tot", require_arg, 't' },
+    { "to", require_arg, 't' },
+    { NULL, 0, '\0' }
+};
+
+/* internal functions */
+static void error(const char *fmt, ...);
+
+/*
+ * Function:    error
+ * Purpose:     Display error message and exit.
+ */
+static void
+error(const char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    HDfprintf(stderr, "%s: error: ", prog);
+    HDvfprintf(stderr, fmt, ap);
+    HDfprintf(stderr, "\n");
+    va_end(ap);
+    HDexit(EXIT_FAILURE);
+}
+
+/*
+ * Function:    usage
+ * Purpose:     Print a usage message.
+ */
+static void
+usage(void)
+{
+    HDfprintf(stdout, "usage: %s [OPTIONS]\n", prog);
+    HDfprintf(stdout, "  OPTIONS\n");
+    HDfprintf(stdout, "     -h, --help                 Print this usage message and exit\n");
+    HDfprintf(stdout, "     -m N, --max-size=N         Largest buffer size timed, in bytes\n");
+    HDfprintf(stdout, "                                [default: %lu]\n",
+        (unsigned long)buf_sizes[NBUF_SIZES - 1]);
+    HDfprintf(stdout, "     -o N, --offset=N           Misalign the buffers by N bytes [default: 0]\n");
+    HDfprintf(stdout, "     -t N, --total-size=N       Bytes checksummed per buffer size, in MB\n");
+    HDfprintf(stdout, "                                [default: %lu]\n",
+        (unsigned long)(DEF_TOTAL_SIZE / ONE_MB));
+    HDfprintf(stdout, "\n");
+}
+
+/*
+ * Function:    do_checksum_test
+ * Purpose:     Checksum BUF_SIZE bytes of BUF with ALGO until TOTAL_SIZE
+ *              bytes have been processed.
+ * Return:      Throughput in MB/s
+ */
+static double
+do_checksum_test(algo_t algo, const uint8_t *buf, size_t buf_size)
+{
+    struct timeval timer_start, timer_stop;
+    size_t niters = MAX(total_size / buf_size, 1);
+    size_t u;
+    uint32_t sum = 0;
+    double elapsed;
+
+    HDgettimeofday(&timer_start, NULL);
+    for(u = 0; u < niters; u++) {
+        switch(algo) {
+            case ALGO_FLETCHER32:
+                sum += H5_checksum_fletcher32(buf, buf_size);
+                break;
+            case ALGO_METADATA:
+                sum += H5_checksum_metadata(buf, buf_size, (uint32_t)u);
+                break;
+            case ALGO_CRC:
+                sum += H5_checksum_crc(buf, buf_size);
+                break;
+            case ALGO_NTYPES:
+            default:
+                error("unknown checksum algorithm");
+        }
+    }
+    HDgettimeofday(&timer_stop, NULL);
+
+    /* Keep the checksums from being optimized away */
+    sum_sink = sum;
+
+    elapsed = ((double)timer_stop.tv_sec + ((double)timer_stop.tv_usec) / MICROSECOND) -
+        ((double)timer_start.tv_sec + ((double)timer_start.tv_usec) / MICROSECOND);
+
+    return MB_PER_SEC((niters * buf_size), elapsed);
+}
+
+/*
+ * Function:    main
+ * Purpose:     Run the program
+ * Return:      EXIT_SUCCESS or EXIT_FAILURE
+ */
+int
+main(int argc, const char *argv[])
+{
+    uint8_t *buf;
+    size_t u;
+    int opt;
+    int algo;
+
+    prog = argv[0];
+
+    /* Initialize h5tools lib */
+    h5tools_init();
+
+    max_size = buf_sizes[NBUF_SIZES - 1];
+    while((opt = get_option(argc, argv, s_opts, l_opts)) > 0) {
+        switch((char)opt) {
+            case 'm':
+                max_size = (size_t)HDstrtoul(opt_arg, NULL, 10);
+                break;
+            case 'o':
+                offset = (size_t)HDstrtoul(opt_arg, NULL, 10);
+                break;
+            case 't':
+                total_size = (size_t)HDstrtoul(opt_arg, NULL, 10) * ONE_MB;
+                break;
+            case '?':
+                usage();
+                HDexit(EXIT_FAILURE);
+                break;
+            case 'h':
+            default:
+                usage();
+                HDexit(EXIT_SUCCESS);
+                break;
+        }
+    }
+
+    if(0 == max_size || 0 == total_size)
+        error("buffer and total sizes must be positive");
+
+    if(NULL == (buf = (uint8_t *)HDmalloc(max_size + offset)))
+        error("out of memory");
+    for(u = 0; u < max_size + offset; u++)
+        buf[u] = (uint8_t)HDrandom();
+
+    HDfprintf(stdout, "Total: %lu MB per buffer size, offset: %lu\n",
+        (unsigned long)(total_size / ONE_MB), (unsigned long)offset);
+    HDfprintf(stdout, "%-12s", "Buffer(B)");
+    for(algo = 0; algo < ALGO_NTYPES; algo++)
+        HDfprintf(stdout, " %12s", algo_names[algo]);
+    HDfprintf(stdout, "   (MB/s)\n");
+
+    for(u = 0; u < NBUF_SIZES && buf_sizes[u] <= max_size; u++) {
+        HDfprintf(stdout, "%-12lu", (unsigned long)buf_sizes[u]);
+        for(algo = 0; algo < ALGO_NTYPES; algo++)
+            HDfprintf(stdout, " %12.2f", do_checksum_test((algo_t)algo, buf + offset, buf_sizes[u]));
+        HDfprintf(stdout, "\n");
+    }
+
+    HDfree(buf);
+
+    return EXIT_SUCCESS;
+}
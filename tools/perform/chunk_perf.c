@@ -0,0 +1,668 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* ===========================================================================
+ * Usage:  chunk_perf [OPTIONS]
+ *
+ * Purpose:	Chunked-I/O benchmark.  Creates a square 2-D integer dataset
+ *		once per filter pipeline and then reads it back with several
+ *		access patterns (chunk aligned, partial chunk, column order
+ *		and strided) under a sweep of raw data chunk cache settings
+ *		(nbytes, nslots, w0).
+ *
+ *		For each configuration the number of chunk cache hits and
+ *		misses and the read throughput are reported.  Misses are
+ *		measured with a pass-through "counter" filter that is always
+ *		placed first in the pipeline, so on the read path it is
+ *		invoked once for every chunk brought into memory from the
+ *		file.  The number of chunk accesses is derived from the
+ *		selections themselves and hits are the difference of the two.
+ *
+ *		Because the counter filter makes every dataset "filtered",
+ *		the "none" pipeline measures the cache path of an unfiltered
+ *		dataset but never the cache bypass that the library takes for
+ *		unfiltered chunks larger than the cache.
+ */
+
+/* our header files */
+#include "h5test.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+#define ONE_KB              1024
+#define ONE_MB              (ONE_KB * ONE_KB)
+
+#define MICROSECOND         1000000.0F
+
+/* report 0.0 in case t is zero too */
+#define MB_PER_SEC(bytes,t) ((fabs(t)<0.0000000001F) ? 0.0F : ((((double)(bytes)) / ONE_MB) / (t)))
+
+#define CHUNK_PERF_FILE     "chunk_perf.h5"
+#define DSET_NAME           "dset"
+#define FILTER_COUNTER      306
+
+/* Default geometry (elements along each dimension) */
+#define DEF_DSET_SIZE       512
+#define DEF_CHUNK_SIZE      64
+
+/* Number of significant bits in the generated data, used for N-bit */
+#define DATA_PRECISION      12
+
+/* Filter pipelines */
+typedef enum {
+    PIPE_NONE = 0,
+    PIPE_SHUFFLE_DEFLATE,
+    PIPE_DEFLATE,
+    PIPE_SCALEOFFSET,
+    PIPE_NBIT,
+    PIPE_NTYPES
+} pipe_t;
+
+static const char *pipe_names[PIPE_NTYPES] = {
+    "none",
+    "shuffle+deflate",
+    "deflate",
+    "scaleoffset",
+    "nbit"
+};
+
+/* Access patterns */
+typedef enum {
+    PATTERN_CHUNK = 0,          /* chunk aligned blocks, row order      */
+    PATTERN_PARTIAL,            /* chunk sized blocks offset by half a
+                                 * chunk, each one straddles 4 chunks   */
+    PATTERN_COLUMN,             /* chunk aligned blocks, column order   */
+    PATTERN_STRIDED,            /* strided rows across the whole width  */
+    PATTERN_NTYPES
+} pattern_t;
+
+static const char *pattern_names[PATTERN_NTYPES] = {
+    "chunk",
+    "partial",
+    "column",
+    "strided"
+};
+
+/* Chunk cache configurations.  Sizes are in chunks, or in rows of chunks
+ * when in_rows is set.  nslots of 0 means "pick a prime at least ten times
+ * the number of chunks that fit in the cache".
+ */
+typedef struct {
+    size_t      nchunks;        /* cache size in chunks (or rows)       */
+    hbool_t     in_rows;        /* nchunks is a number of chunk rows    */
+    hbool_t     all;            /* cache holds the whole dataset        */
+    size_t      nslots;         /* hash table slots, 0 for automatic    */
+    double      w0;             /* preemption policy                    */
+} cache_config_t;
+
+static const cache_config_t cache_configs[] = {
+    { 0, FALSE, FALSE, 0, 0.75F },      /* no cache                     */
+    { 1, FALSE, FALSE, 0, 0.75F },      /* a single chunk               */
+    { 1, TRUE,  FALSE, 0, 0.0F },       /* one row of chunks            */
+    { 1, TRUE,  FALSE, 0, 0.75F },
+    { 1, TRUE,  FALSE, 0, 1.0F },
+    { 1, TRUE,  FALSE, 7, 0.75F },      /* one row, too few slots       */
+    { 0, FALSE, TRUE,  0, 0.75F }       /* the whole dataset            */
+};
+
+#define NCACHE_CONFIGS      (sizeof(cache_configs) / sizeof(cache_configs[0]))
+
+/* internal variables */
+static const char *prog = NULL;
+static const char *option_prefix = NULL;
+static char *filename = NULL;
+static hsize_t dset_size = DEF_DSET_SIZE;
+static hsize_t chunk_size = DEF_CHUNK_SIZE;
+static int num_iters = 1;
+static hsize_t stride = 0;
+static size_t nmisses_g;
+
+/* commandline options : long and short form */
+static const char *s_opts = "hc:d:i:p:s:";
+static struct long_options l_opts[] = {
+    { "help", no_arg, 'h' },
+    { "chunk-size", require_arg, 'c' },
+    { "chunk-siz", require_arg, 'c' },
+    { "chunk-si", require_arg, 'c' },
+    { "chunk-s", require_arg, 'c' },
+    { "chunk", require_arg, 'c' },
+    { "chun", require_arg, 'c' },
+    { "chu", require_arg, 'c' },
+    { "ch", require_arg, 'c' },
+    { "dset-size", require_arg, 'd' },
+    { "dset-siz", require_arg, 'd' },
+    { "dset-si", require_arg, 'd' },
+    { "dset-s", require_arg, 'd' },
+    { "dset", require_arg, 'd' },
+    { "dse", require_arg, 'd' },
+    { "ds", require_arg, 'd' },
+    { "num-iterations", require_arg, 'i' },
+    { "num-iteration", require_arg, 'i' },
+    { "num-iteratio", require_arg, 'i' },
+    { "num-iterati", require_arg, 'i' },
+    { "num-iterat", require_arg, 'i' },
+    { "num-itera", require_arg, 'i' },
+    { "num-iter", require_arg, 'i' },
+    { "num-ite", require_arg, 'i' },
+    { "num-it", require_arg, 'i' },
+    { "num-i", require_arg, 'i' },
+    { "prefix", require_arg, 'p' },
+    { "prefi", require_arg, 'p' },
+    { "pref", require_arg, 'p' },
+    { "pre", require_arg, 'p' },
+    { "pr", require_arg, 'p' },
+    { "stride", require_arg, 's' },
+    { "strid", require_arg, 's' },
+    { "stri", require_arg, 's' },
+    { "str", require_arg, 's' },
+    { "st", require_arg, 's' },
+    { NULL, 0, '\0' }
+};
+
+/* internal functions */
+static void error(const char *fmt, ...);
+static size_t counter(unsigned flags, size_t cd_nelmts,
+    const unsigned *cd_values, size_t nbytes, size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+static const H5Z_class2_t H5Z_COUNTER[1] = {{
+    H5Z_CLASS_T_VERS,           /* H5Z_class_t version          */
+    FILTER_COUNTER,             /* Filter id number             */
+    1, 1,                       /* Encoding and decoding enabled */
+    "counter",                  /* Filter name for debugging    */
+    NULL,                       /* The "can apply" callback     */
+    NULL,                       /* The "set local" callback     */
+    counter,                    /* The actual filter function   */
+}};
+
+/*
+ * Function:    error
+ * Purpose:     Display error message and exit.
+ */
+static void
+error(const char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    HDfprintf(stderr, "%s: error: ", prog);
+    HDvfprintf(stderr, fmt, ap);
+    HDfprintf(stderr, "\n");
+    va_end(ap);
+    HDexit(EXIT_FAILURE);
+}
+
+/*
+ * Function:    counter
+ * Purpose:     Pass-through filter which counts the chunks read from the
+ *              file, i.e. the chunk cache misses.
+ * Return:      nbytes, never fails
+ */
+static size_t
+counter(unsigned flags, size_t H5_ATTR_UNUSED cd_nelmts,
+    const unsigned H5_ATTR_UNUSED *cd_values, size_t nbytes,
+    size_t H5_ATTR_UNUSED *buf_size, void H5_ATTR_UNUSED **buf)
+{
+    if(flags & H5Z_FLAG_REVERSE)
+        nmisses_g++;
+
+    return nbytes;
+}
+
+/*
+ * Function:    cleanup
+ * Purpose:     Cleanup the output file.
+ */
+static void
+cleanup(void)
+{
+    if(!HDgetenv("HDF5_NOCLEANUP"))
+        HDunlink(filename);
+    HDfree(filename);
+}
+
+/*
+ * Function:    get_unique_name
+ * Purpose:     Build the name of the output file from the prefix.
+ */
+static void
+get_unique_name(void)
+{
+    const char *prefix = HDgetenv("HDF5_PREFIX");
+
+    if(option_prefix)
+        prefix = option_prefix;
+
+    /* 2 = 1 for '/' + 1 for null terminator */
+    if(NULL == (filename = (char *)HDmalloc((prefix ? HDstrlen(prefix) : 0) + HDstrlen(CHUNK_PERF_FILE) + 2)))
+        error("out of memory");
+
+    filename[0] = '\0';
+    if(prefix) {
+        HDstrcpy(filename, prefix);
+        HDstrcat(filename, "/");
+    }
+    HDstrcat(filename, CHUNK_PERF_FILE);
+}
+
+/*
+ * Function:    usage
+ * Purpose:     Print a usage message.
+ */
+static void
+usage(void)
+{
+    HDfprintf(stdout, "usage: %s [OPTIONS]\n", prog);
+    HDfprintf(stdout, "  OPTIONS\n");
+    HDfprintf(stdout, "     -h, --help                 Print this usage message and exit\n");
+    HDfprintf(stdout, "     -d N, --dset-size=N        Size of each dimension of the square dataset\n");
+    HDfprintf(stdout, "                                in elements [default: %d]\n", DEF_DSET_SIZE);
+    HDfprintf(stdout, "     -c N, --chunk-size=N       Size of each dimension of the square chunks\n");
+    HDfprintf(stdout, "                                in elements [default: %d]\n", DEF_CHUNK_SIZE);
+    HDfprintf(stdout, "     -i N, --num-iterations=N   Number of times each read pattern is repeated\n");
+    HDfprintf(stdout, "                                [default: 1]\n");
+    HDfprintf(stdout, "     -s N, --stride=N           Row stride of the strided pattern\n");
+    HDfprintf(stdout, "                                [default: half the chunk size]\n");
+    HDfprintf(stdout, "     -p D, --prefix=D           The directory prefix to place the file\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "  Every filter pipeline is combined with every access pattern and\n");
+    HDfprintf(stdout, "  chunk cache setting; pipelines whose filters are not available are\n");
+    HDfprintf(stdout, "  skipped.\n");
+    HDfprintf(stdout, "\n");
+    HDfflush(stdout);
+}
+
+/*
+ * Function:    elapsed
+ * Purpose:     Seconds between two timevals.
+ */
+static double
+elapsed(const struct timeval *start, const struct timeval *stop)
+{
+    return ((double)stop->tv_sec + ((double)stop->tv_usec) / MICROSECOND) -
+           ((double)start->tv_sec + ((double)start->tv_usec) / MICROSECOND);
+}
+
+/*
+ * Function:    pipe_avail
+ * Purpose:     Check whether all the filters of a pipeline are available.
+ */
+static hbool_t
+pipe_avail(pipe_t pipe)
+{
+    switch(pipe) {
+        case PIPE_NONE:
+            return TRUE;
+        case PIPE_SHUFFLE_DEFLATE:
+            return H5Zfilter_avail(H5Z_FILTER_SHUFFLE) > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0;
+        case PIPE_DEFLATE:
+            return H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0;
+        case PIPE_SCALEOFFSET:
+            return H5Zfilter_avail(H5Z_FILTER_SCALEOFFSET) > 0;
+        case PIPE_NBIT:
+            return H5Zfilter_avail(H5Z_FILTER_NBIT) > 0;
+        case PIPE_NTYPES:
+        default:
+            return FALSE;
+    }
+}
+
+/*
+ * Function:    create_dataset
+ * Purpose:     Create the file and write the dataset through the given
+ *              filter pipeline.
+ * Return:      Write throughput in MB/s
+ */
+static double
+create_dataset(pipe_t pipe, const int *buf, hsize_t *stored)
+{
+    hid_t file, space, dcpl, dset, ftype;
+    hsize_t dims[2], cdims[2];
+    struct timeval timer_start, timer_stop;
+    double total_time;
+
+    dims[0] = dims[1] = dset_size;
+    cdims[0] = cdims[1] = chunk_size;
+
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        error("unable to create file %s", filename);
+    if((space = H5Screate_simple(2, dims, NULL)) < 0)
+        error("unable to create dataspace");
+    if((ftype = H5Tcopy(H5T_NATIVE_INT)) < 0)
+        error("unable to copy datatype");
+
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        error("unable to create dataset creation property list");
+    if(H5Pset_chunk(dcpl, 2, cdims) < 0)
+        error("unable to set chunk dimensions");
+    if(H5Pset_filter(dcpl, FILTER_COUNTER, 0, 0, NULL) < 0)
+        error("unable to set counter filter");
+
+    switch(pipe) {
+        case PIPE_SHUFFLE_DEFLATE:
+            if(H5Pset_shuffle(dcpl) < 0)
+                error("unable to set shuffle filter");
+            /* FALLTHROUGH */
+        case PIPE_DEFLATE:
+            if(H5Pset_deflate(dcpl, 6) < 0)
+                error("unable to set deflate filter");
+            break;
+        case PIPE_SCALEOFFSET:
+            if(H5Pset_scaleoffset(dcpl, H5Z_SO_INT, H5Z_SO_INT_MINBITS_DEFAULT) < 0)
+                error("unable to set scaleoffset filter");
+            break;
+        case PIPE_NBIT:
+            if(H5Tset_precision(ftype, (size_t)DATA_PRECISION) < 0)
+                error("unable to set datatype precision");
+            if(H5Pset_nbit(dcpl) < 0)
+                error("unable to set nbit filter");
+            break;
+        case PIPE_NONE:
+        case PIPE_NTYPES:
+        default:
+            break;
+    }
+
+    if((dset = H5Dcreate2(file, DSET_NAME, ftype, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        error("unable to create dataset");
+
+    HDgettimeofday(&timer_start, NULL);
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        error("unable to write dataset");
+    if(H5Dclose(dset) < 0)
+        error("unable to close dataset");
+    if(H5Fflush(file, H5F_SCOPE_LOCAL) < 0)
+        error("unable to flush file");
+    HDgettimeofday(&timer_stop, NULL);
+    total_time = elapsed(&timer_start, &timer_stop);
+
+    if((dset = H5Dopen2(file, DSET_NAME, H5P_DEFAULT)) < 0)
+        error("unable to open dataset");
+    *stored = H5Dget_storage_size(dset);
+
+    H5Dclose(dset);
+    H5Pclose(dcpl);
+    H5Tclose(ftype);
+    H5Sclose(space);
+    H5Fclose(file);
+
+    return MB_PER_SEC(dset_size * dset_size * sizeof(int), total_time);
+}
+
+/*
+ * Function:    chunk_span
+ * Purpose:     Number of chunks along one dimension touched by the rows
+ *              start, start+step, ..., start+(count-1)*step, each of which
+ *              is block elements wide.
+ */
+static hsize_t
+chunk_span(hsize_t start, hsize_t step, hsize_t count, hsize_t block)
+{
+    hsize_t nchunks = 0;
+    hsize_t last = HSIZET_MAX;
+    hsize_t u;
+
+    for(u = 0; u < count; u++) {
+        hsize_t first_chunk = (start + u * step) / chunk_size;
+        hsize_t last_chunk = (start + u * step + block - 1) / chunk_size;
+
+        if(last != HSIZET_MAX && first_chunk <= last)
+            first_chunk = last + 1;
+        if(last_chunk >= first_chunk)
+            nchunks += (last_chunk - first_chunk) + 1;
+        if(last == HSIZET_MAX || last_chunk > last)
+            last = last_chunk;
+    }
+
+    return nchunks;
+}
+
+/*
+ * Function:    read_block
+ * Purpose:     Read one (possibly strided) hyperslab from the dataset.
+ * Return:      Number of chunks the selection touches
+ */
+static hsize_t
+read_block(hid_t dset, hid_t file_space, int *buf, const hsize_t *start,
+    const hsize_t *step, const hsize_t *count, const hsize_t *block)
+{
+    hid_t mem_space;
+    hsize_t mem_dims[2];
+
+    mem_dims[0] = count[0] * block[0];
+    mem_dims[1] = count[1] * block[1];
+
+    if((mem_space = H5Screate_simple(2, mem_dims, NULL)) < 0)
+        error("unable to create memory dataspace");
+    if(H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, step, count, block) < 0)
+        error("unable to select hyperslab");
+    if(H5Dread(dset, H5T_NATIVE_INT, mem_space, file_space, H5P_DEFAULT, buf) < 0)
+        error("unable to read dataset");
+    H5Sclose(mem_space);
+
+    return chunk_span(start[0], step[0], count[0], block[0]) *
+           chunk_span(start[1], step[1], count[1], block[1]);
+}
+
+/*
+ * Function:    do_read_test
+ * Purpose:     Read the whole dataset with one access pattern and one
+ *              chunk cache configuration and report the results.
+ */
+static void
+do_read_test(pipe_t pipe, pattern_t pattern, const cache_config_t *cfg, int *buf)
+{
+    hid_t file, dapl, dset, file_space;
+    hsize_t start[2], step[2], count[2], block[2];
+    hsize_t nchunks_row = (dset_size + chunk_size - 1) / chunk_size;
+    hsize_t naccesses = 0, nbytes = 0;
+    hsize_t i, j;
+    size_t chunk_nbytes = (size_t)(chunk_size * chunk_size * sizeof(int));
+    size_t rdcc_nbytes, rdcc_nslots;
+    struct timeval timer_start, timer_stop;
+    double total_time;
+    int iter;
+
+    /* Work out the chunk cache geometry */
+    if(cfg->all)
+        rdcc_nbytes = (size_t)(nchunks_row * nchunks_row) * chunk_nbytes;
+    else if(cfg->in_rows)
+        rdcc_nbytes = cfg->nchunks * (size_t)nchunks_row * chunk_nbytes;
+    else
+        rdcc_nbytes = cfg->nchunks * chunk_nbytes;
+    if(cfg->nslots)
+        rdcc_nslots = cfg->nslots;
+    else {
+        size_t n, d;
+
+        /* Smallest prime at least ten times the cached chunk count */
+        for(n = MAX(rdcc_nbytes / chunk_nbytes, 1) * 10 + 1; ; n++) {
+            for(d = 2; d * d <= n; d++)
+                if(0 == n % d)
+                    break;
+            if(d * d > n)
+                break;
+        }
+        rdcc_nslots = n;
+    }
+
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        error("unable to create dataset access property list");
+    if(H5Pset_chunk_cache(dapl, rdcc_nslots, rdcc_nbytes, cfg->w0) < 0)
+        error("unable to set chunk cache");
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+        error("unable to open file %s", filename);
+    if((dset = H5Dopen2(file, DSET_NAME, dapl)) < 0)
+        error("unable to open dataset");
+    if((file_space = H5Dget_space(dset)) < 0)
+        error("unable to get dataspace");
+
+    nmisses_g = 0;
+    HDgettimeofday(&timer_start, NULL);
+
+    for(iter = 0; iter < num_iters; iter++) {
+        step[0] = step[1] = 1;
+        count[0] = count[1] = 1;
+
+        switch(pattern) {
+            case PATTERN_CHUNK:
+            case PATTERN_PARTIAL:
+            case PATTERN_COLUMN:
+            {
+                hsize_t base = (PATTERN_PARTIAL == pattern) ? chunk_size / 2 : 0;
+
+                for(i = base; i < dset_size; i += chunk_size)
+                    for(j = base; j < dset_size; j += chunk_size) {
+                        /* Column order swaps the inner and outer loops */
+                        start[0] = (PATTERN_COLUMN == pattern) ? j : i;
+                        start[1] = (PATTERN_COLUMN == pattern) ? i : j;
+                        block[0] = MIN(chunk_size, dset_size - start[0]);
+                        block[1] = MIN(chunk_size, dset_size - start[1]);
+                        naccesses += read_block(dset, file_space, buf, start, step, count, block);
+                        nbytes += block[0] * block[1] * sizeof(int);
+                    }
+                break;
+            }
+
+            case PATTERN_STRIDED:
+                for(i = 0; i < stride && i < dset_size; i++) {
+                    start[0] = i;
+                    start[1] = 0;
+                    step[0] = stride;
+                    count[0] = (dset_size - i + stride - 1) / stride;
+                    block[0] = 1;
+                    block[1] = dset_size;
+                    naccesses += read_block(dset, file_space, buf, start, step, count, block);
+                    nbytes += count[0] * dset_size * sizeof(int);
+                }
+                break;
+
+            case PATTERN_NTYPES:
+            default:
+                break;
+        }
+    }
+
+    HDgettimeofday(&timer_stop, NULL);
+    total_time = elapsed(&timer_start, &timer_stop);
+
+    H5Sclose(file_space);
+    H5Dclose(dset);
+    H5Fclose(file);
+    H5Pclose(dapl);
+
+    HDfprintf(stdout, "%-16s %-8s %10Zu %7Zu %5.2f %9Hu %9Zu %10.2f\n",
+        pipe_names[pipe], pattern_names[pattern], rdcc_nbytes, rdcc_nslots,
+        cfg->w0, (naccesses > (hsize_t)nmisses_g ? naccesses - (hsize_t)nmisses_g : (hsize_t)0),
+        nmisses_g, MB_PER_SEC(nbytes, total_time));
+}
+
+/*
+ * Function:    main
+ * Purpose:     Run the program
+ * Return:      EXIT_SUCCESS or EXIT_FAILURE
+ */
+int
+main(int argc, const char *argv[])
+{
+    int *buf;
+    hsize_t u;
+    int opt;
+    int pipe, pattern;
+    size_t c;
+
+    prog = argv[0];
+
+    /* Initialize h5tools lib */
+    h5tools_init();
+
+    while((opt = get_option(argc, argv, s_opts, l_opts)) > 0) {
+        switch((char)opt) {
+            case 'c':
+                chunk_size = (hsize_t)HDstrtoul(opt_arg, NULL, 10);
+                break;
+            case 'd':
+                dset_size = (hsize_t)HDstrtoul(opt_arg, NULL, 10);
+                break;
+            case 'i':
+                num_iters = (int)HDstrtol(opt_arg, NULL, 10);
+                break;
+            case 'p':
+                option_prefix = opt_arg;
+                break;
+            case 's':
+                stride = (hsize_t)HDstrtoul(opt_arg, NULL, 10);
+                break;
+            case '?':
+                usage();
+                HDexit(EXIT_FAILURE);
+                break;
+            case 'h':
+            default:
+                usage();
+                HDexit(EXIT_SUCCESS);
+                break;
+        }
+    }
+
+    if(0 == dset_size || 0 == chunk_size)
+        error("dataset and chunk sizes must be positive");
+    if(chunk_size > dset_size)
+        error("chunk size (%Hu) exceeds dataset size (%Hu)", chunk_size, dset_size);
+    if(num_iters < 1)
+        num_iters = 1;
+    if(0 == stride)
+        stride = MAX(chunk_size / 2, 1);
+
+    if(H5Zregister(H5Z_COUNTER) < 0)
+        error("unable to register counter filter");
+
+    /* Non-negative data that fits in a signed DATA_PRECISION-bit integer
+     * so that every pipeline, including N-bit, is lossless */
+    if(NULL == (buf = (int *)HDmalloc((size_t)(dset_size * dset_size) * sizeof(int))))
+        error("out of memory");
+    for(u = 0; u < dset_size * dset_size; u++)
+        buf[u] = (int)((u % dset_size) + (hsize_t)(HDrandom() & 0xff)) & ((1 << (DATA_PRECISION - 1)) - 1);
+
+    get_unique_name();
+
+    HDfprintf(stdout, "Dataset: %Hu x %Hu int, chunk: %Hu x %Hu, iterations: %d, stride: %Hu\n",
+        dset_size, dset_size, chunk_size, chunk_size, num_iters, stride);
+
+    for(pipe = 0; pipe < PIPE_NTYPES; pipe++) {
+        hsize_t stored = 0;
+        double write_rate;
+
+        if(!pipe_avail((pipe_t)pipe)) {
+            HDfprintf(stdout, "\nPipeline %s: not available, skipped\n", pipe_names[pipe]);
+            continue;
+        }
+
+        write_rate = create_dataset((pipe_t)pipe, buf, &stored);
+        HDfprintf(stdout, "\nPipeline %s: write %.2fMB/s, stored %Hu bytes (ratio %.2f)\n",
+            pipe_names[pipe], write_rate, stored,
+            stored ? (double)(dset_size * dset_size * sizeof(int)) / (double)stored : 0.0F);
+        HDfprintf(stdout, "%-16s %-8s %10s %7s %5s %9s %9s %10s\n",
+            "Pipeline", "Pattern", "Cache(B)", "Slots", "w0", "Hits", "Misses", "Read MB/s");
+
+        for(pattern = 0; pattern < PATTERN_NTYPES; pattern++)
+            for(c = 0; c < NCACHE_CONFIGS; c++)
+                do_read_test((pipe_t)pipe, (pattern_t)pattern, &cache_configs[c], buf);
+    }
+
+    HDfree(buf);
+    cleanup();
+
+    return EXIT_SUCCESS;
+}